@@ -0,0 +1,98 @@
+/*****************************************************************************
+* | File      	:  	epd_remote.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Message protocol between the High Level app and the EPD engine running
+*                   on the Real Time core
+* | Info        :   Shared by both cores and the host simulation (Tools/EpdSim), so only
+*                   stdint types and no platform headers.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Reset, command sequence and RAM rectangle messages, completion reply
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_REMOTE_H
+#define EPD_REMOTE_H
+
+#include <stdint.h>
+
+// Largest message the OS passes between the cores, header included
+#define EPD_RMT_MAX_MSG			1024
+#define EPD_RMT_MAX_PAYLOAD		(EPD_RMT_MAX_MSG - (uint32_t)sizeof(EPD_RMT_MSG))
+
+// Message types, High Level -> Real Time
+#define EPD_RMT_RESET			0x01	// Hardware reset of the display, then wait for BUSY
+#define EPD_RMT_SEQ				0x02	// Payload is a command sequence table (EPD_SEQ_xxx format)
+#define EPD_RMT_RECT			0x03	// Payload is a piece of a RAM rectangle, row by row
+// Real Time -> High Level
+#define EPD_RMT_DONE			0x80	// Completion of the message with the same Seq, see EPD_RMT_DONE_INFO
+
+// Message flags
+#define EPD_RMT_FLAG_ACK		0x01	// Reply with EPD_RMT_DONE once the display is not BUSY anymore
+
+// Status in the Flags of EPD_RMT_DONE
+#define EPD_RMT_OK				0
+#define EPD_RMT_ERR_MSG			1		// Malformed or out of order message
+#define EPD_RMT_ERR_SPI			2		// SPI transfer failed
+#define EPD_RMT_ERR_TIMEOUT		3		// BUSY did not drop in time
+
+// BUSY is given up on after this long
+#define EPD_RMT_BUSY_TIMEOUT_US	(10u * 1000u * 1000u)
+// Reset pulse, same timing as EPD_reset on the High Level core
+#define EPD_RMT_RESET_US		(200u * 1000u)
+
+// Command sequence table encoding, same as the IL3820 driver. EPD_SEQ_END_CMD with 
+// EPD_SEQ_END_FLAGS always ends the table, it is never sent as a command.
+#ifndef EPD_SEQ_DELAY
+#define EPD_SEQ_DELAY			0x80	// Wait the delay byte in ms after the command
+#define EPD_SEQ_BUSY			0x40	// Wait for BUSY after the command (and delay)
+#define EPD_SEQ_LEN				0x3F	// Parameter count, up to 63
+#define EPD_SEQ_END_CMD			0xFF
+#define EPD_SEQ_END_FLAGS		0xFF
+#define EPD_SEQ_END				EPD_SEQ_END_CMD, EPD_SEQ_END_FLAGS
+#endif
+
+// Every message starts with this header, Len payload bytes follow. Both cores are little endian.
+// EPD_RMT_RECT : the rectangle is (Xbyte, Ystart) WidthByte x Height in panel RAM, the payload
+// holds bytes Offset .. Offset + Len - 1 of it. Pieces must come in order, Offset 0 sets the
+// RAM window and the engine keeps writing RAM till the rectangle is complete.
+typedef struct {
+    uint8_t Type;			// EPD_RMT_xxx
+    uint8_t Flags;			// EPD_RMT_FLAG_xxx, status for EPD_RMT_DONE
+    uint16_t Seq;			// Echoed by EPD_RMT_DONE
+    uint16_t Xbyte;
+    uint16_t Ystart;
+    uint16_t WidthByte;
+    uint16_t Height;
+    uint16_t Offset;
+    uint16_t Len;
+} EPD_RMT_MSG;
+
+// Payload of EPD_RMT_DONE
+typedef struct {
+    uint32_t BusyUs;		// Time the display was BUSY for this message
+    uint32_t ElapsedUs;		// From the start of the message till the reply
+} EPD_RMT_DONE_INFO;
+
+#endif
@@ -0,0 +1,170 @@
+/*****************************************************************************
+* | File      	:  	epd_ring.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Ring buffer of the inter-core shared memory, one per direction
+* | Info        :   Same layout as the buffers the OS sets up between the cores : a 64 byte header with
+*                   the read / write positions, then 16 byte aligned blocks of a 32 bit size and the data.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Single producer / single consumer ring, used by the RT core and Tools/EpdSim
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <string.h>
+
+#include "epd_ring.h"
+
+// Orders the data accesses against the position updates of the other side
+#define EPD_RING_BARRIER()	__sync_synchronize()
+
+#define EPD_RING_ROUND(x)	(((x) + EPD_RING_ALIGN - 1) & ~(uint32_t)(EPD_RING_ALIGN - 1))
+
+/******************************************************************************
+function    : Copies into the data area, wrapping at its end
+******************************************************************************/
+static uint32_t EPD_Ring_Put(EPD_RING *Ring, uint32_t Pos, const void *Src, uint32_t Len) {
+    uint32_t first = Ring->Size - Pos;
+
+    if (first > Len) {
+        first = Len;
+    }
+    memcpy(&Ring->Data[Pos], Src, first);
+    memcpy(&Ring->Data[0], (const uint8_t *)Src + first, Len - first);
+    Pos += Len;
+    return (Pos >= Ring->Size) ? Pos - Ring->Size : Pos;
+}
+
+/******************************************************************************
+function    : Copies out of the data area, wrapping at its end
+******************************************************************************/
+static uint32_t EPD_Ring_Get(const EPD_RING *Ring, uint32_t Pos, void *Dst, uint32_t Len) {
+    uint32_t first = Ring->Size - Pos;
+
+    if (first > Len) {
+        first = Len;
+    }
+    memcpy(Dst, &Ring->Data[Pos], first);
+    memcpy((uint8_t *)Dst + first, &Ring->Data[0], Len - first);
+    Pos += Len;
+    return (Pos >= Ring->Size) ? Pos - Ring->Size : Pos;
+}
+
+/******************************************************************************
+function    : Attaches to a shared buffer
+parameter   :
+       Ring :   Ring to set up
+       Base :   Start of the buffer (the header)
+       Size :   Size of the whole buffer in bytes
+******************************************************************************/
+void EPD_Ring_Attach(EPD_RING *Ring, void *Base, uint32_t Size) {
+    Ring->Header = (EPD_RING_HEADER *)Base;
+    Ring->Data = (uint8_t *)Base + sizeof(EPD_RING_HEADER);
+    Ring->Size = (Size - (uint32_t)sizeof(EPD_RING_HEADER)) & ~(uint32_t)(EPD_RING_ALIGN - 1);
+}
+
+/******************************************************************************
+function    : Empties the ring
+******************************************************************************/
+void EPD_Ring_Reset(EPD_RING *Ring) {
+    Ring->Header->WritePosition = 0;
+    Ring->Header->ReadPosition = 0;
+    EPD_RING_BARRIER();
+}
+
+/******************************************************************************
+function    : Largest message (without prefix) that fits in the ring right now
+******************************************************************************/
+uint32_t EPD_Ring_Free(const EPD_RING *Ring) {
+    uint32_t used = (Ring->Header->WritePosition + Ring->Size - Ring->Header->ReadPosition) % Ring->Size;
+    // One aligned slot stays empty so that a full ring is not taken as empty
+    uint32_t room = Ring->Size - used - EPD_RING_ALIGN;
+    uint32_t overhead = sizeof(uint32_t) + EPD_RING_PREFIX;
+
+    room &= ~(uint32_t)(EPD_RING_ALIGN - 1);
+    return (room > overhead) ? room - overhead : 0;
+}
+
+/******************************************************************************
+function    : Writes one message
+parameter   :
+       Ring   :   Ring written by this side
+       Prefix :   EPD_RING_PREFIX bytes put in front of the message
+       Msg    :   Message
+       Len    :   Message length
+return      : 0 / -1 if there is no room, nothing is written then
+******************************************************************************/
+int EPD_Ring_Write(EPD_RING *Ring, const uint8_t *Prefix, const void *Msg, uint32_t Len) {
+    uint32_t pos = Ring->Header->WritePosition;
+    uint32_t block = EPD_RING_PREFIX + Len;
+
+    if (Len > EPD_Ring_Free(Ring)) {
+        return -1;
+    }
+    EPD_RING_BARRIER();
+
+    pos = EPD_Ring_Put(Ring, pos, &block, sizeof(block));
+    pos = EPD_Ring_Put(Ring, pos, Prefix, EPD_RING_PREFIX);
+    EPD_Ring_Put(Ring, pos, Msg, Len);
+
+    // Publish the block only once its data is in place
+    EPD_RING_BARRIER();
+    Ring->Header->WritePosition = (Ring->Header->WritePosition + EPD_RING_ROUND(sizeof(block) + block)) % Ring->Size;
+    return 0;
+}
+
+/******************************************************************************
+function    : Reads one message
+parameter   :
+       Ring   :   Ring read by this side
+       Prefix :   Gets the EPD_RING_PREFIX bytes in front of the message, may be NULL
+       Msg    :   Buffer for the message
+       Max    :   Size of Msg
+return      : Message length, 0 if the ring is empty, -1 if the message was
+              larger than Max (it is dropped)
+******************************************************************************/
+int EPD_Ring_Read(EPD_RING *Ring, uint8_t *Prefix, void *Msg, uint32_t Max) {
+    uint32_t pos = Ring->Header->ReadPosition;
+    uint32_t block;
+    uint8_t prefix[EPD_RING_PREFIX];
+    int ret;
+
+    if (pos == Ring->Header->WritePosition) {
+        return 0;
+    }
+    EPD_RING_BARRIER();
+
+    pos = EPD_Ring_Get(Ring, pos, &block, sizeof(block));
+    if (block < EPD_RING_PREFIX || block - EPD_RING_PREFIX > Max) {
+        ret = -1;
+    } else {
+        pos = EPD_Ring_Get(Ring, pos, (Prefix != NULL) ? Prefix : prefix, EPD_RING_PREFIX);
+        EPD_Ring_Get(Ring, pos, Msg, block - EPD_RING_PREFIX);
+        ret = (int)(block - EPD_RING_PREFIX);
+    }
+
+    // Give the space back only after the data is copied out
+    EPD_RING_BARRIER();
+    Ring->Header->ReadPosition = (Ring->Header->ReadPosition + EPD_RING_ROUND(sizeof(block) + block)) % Ring->Size;
+    return ret;
+}
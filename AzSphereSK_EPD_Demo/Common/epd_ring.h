@@ -0,0 +1,61 @@
+/*****************************************************************************
+* | File      	:  	epd_ring.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Ring buffer of the inter-core shared memory, one per direction
+* | Info        :   Same layout as the buffers the OS sets up between the cores : a 64 byte header with
+*                   the read / write positions, then 16 byte aligned blocks of a 32 bit size and the data.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Single producer / single consumer ring, used by the RT core and Tools/EpdSim
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_RING_H
+#define EPD_RING_H
+
+#include <stdint.h>
+
+#define EPD_RING_ALIGN		16		// Blocks start on 16 byte boundaries
+#define EPD_RING_PREFIX		20		// Component id (16) and a reserved word in front of every message
+
+// Start of the shared buffer, the data area follows
+typedef struct {
+    volatile uint32_t WritePosition;	// Owned by the producer, offset in the data area
+    volatile uint32_t ReadPosition;		// Owned by the consumer
+    uint32_t Reserved[14];
+} EPD_RING_HEADER;
+
+typedef struct {
+    EPD_RING_HEADER *Header;
+    uint8_t *Data;
+    uint32_t Size;					// Bytes in the data area, multiple of EPD_RING_ALIGN
+} EPD_RING;
+
+void EPD_Ring_Attach(EPD_RING *Ring, void *Base, uint32_t Size);	// Size of the whole buffer, header included
+void EPD_Ring_Reset(EPD_RING *Ring);		// Empties the ring, only for the side creating the buffer
+int EPD_Ring_Write(EPD_RING *Ring, const uint8_t *Prefix, const void *Msg, uint32_t Len);	// 0, -1 if there is no room
+int EPD_Ring_Read(EPD_RING *Ring, uint8_t *Prefix, void *Msg, uint32_t Max);	// Message length, 0 if empty, -1 if it did not fit
+uint32_t EPD_Ring_Free(const EPD_RING *Ring);	// Largest message that can be written now
+
+#endif
@@ -0,0 +1,60 @@
+/*****************************************************************************
+* | File      	:  	epd_trace.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Binary trace of the EPD command stream, written by the capture mode of
+*                   AzSphere_Interface.c and read by Tools/EpdReplay
+* | Info        :   stdint types only, shared by the device and the host tool.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Command / data bytes with the D/C level, BUSY and reset edges, delays, us timestamps
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_TRACE_H
+#define EPD_TRACE_H
+
+#include <stdint.h>
+
+// File header : EPD_TRACE_MAGIC, then the version byte
+#define EPD_TRACE_MAGIC			"EPDT"
+#define EPD_TRACE_VERSION		1
+#define EPD_TRACE_HEADER_BYTES	5
+
+// A record is a tag byte, the time since the previous record in us (varint), then the payload.
+// The low nibble of the tag is the type, the high nibble the display index (EPD_TRACE_NO_DEVICE 
+// for records of no display). Varints are 7 bits per byte, low first, bit 7 set if more follow.
+#define EPD_TRACE_CMD			0x01	// SPI bytes sent with D/C low : varint length, bytes
+#define EPD_TRACE_DATA			0x02	// SPI bytes sent with D/C high : varint length, bytes
+#define EPD_TRACE_BUSY			0x03	// BUSY seen : one byte, EPD_TRACE_BUSY_xxx
+#define EPD_TRACE_RST			0x04	// Reset pin written : one byte, the level
+#define EPD_TRACE_DELAY			0x05	// Fixed delay starts : varint length in us
+#define EPD_TRACE_TYPE_MASK		0x0F
+#define EPD_TRACE_NO_DEVICE		0x0F
+
+#define EPD_TRACE_BUSY_HIGH		0x01	// Level read
+#define EPD_TRACE_BUSY_WAIT		0x02	// Read at the start of a BUSY wait, otherwise a change of level
+
+#define EPD_TRACE_TAG(Type, Device)	((uint8_t)(((Device) << 4) | (Type)))
+
+#endif
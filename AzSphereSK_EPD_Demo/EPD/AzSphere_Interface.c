@@ -44,6 +44,8 @@
 //Global Includes
 #include <time.h>
 #include <errno.h>
+#include <string.h>
+#include <unistd.h>
 
 #include "../HighLevelCore/applibs_versions.h"
 
@@ -52,6 +54,9 @@
 #include <applibs/log.h>
 
 #include "AzSphere_Interface.h"
+#include "EPD_Telemetry.h"
+#include "../Common/epd_trace.h"
+#include "../Tools/Log/Log.h"
 #include "hw/avnet_mt3620_sk.h"
 
 
@@ -65,6 +70,65 @@ rstfd = -1;
 dcfd = -1;
 busyfd = -1;
 
+// Last level driven on the D/C pin (dcLevelFd), -1 if unknown. The pin is only written when it changes.
+static int dcLevel = -1;
+static int dcLevelFd = -1;
+
+// Opened displays, and the CLICK_SLOT pins standing in for a display that was not opened
+static EPD_DEVICE Devices[EPD_MAX_DEVICES];
+static uint8_t DeviceCount;
+static EPD_DEVICE DefaultDevice;
+
+// Capture of the command stream, see Common/epd_trace.h
+typedef struct {
+    uint8_t Active;
+    uint8_t Overflow;			// Buffer full without a file, the trace ends at the last whole record
+    uint8_t *Buf;
+    uint32_t Size;
+    uint32_t Len;				// Bytes in Buf
+    uint32_t Written;			// Bytes written to the file
+    int FileFd;					// -1 to keep the trace in Buf only
+    uint32_t LastUs;			// Time of the previous record
+    uint8_t Busy[EPD_MAX_DEVICES];	// Last BUSY level recorded
+} EPD_CAPTURE;
+static EPD_CAPTURE Capture;
+
+/******************************************************************************
+function    : Pins of a display, the CLICK_SLOT ones if it was not opened
+parameter   : 
+        fd      :   Spi Fd of the display
+return      : Device
+******************************************************************************/
+static const EPD_DEVICE *EPD_Device_Pins(int fd) {
+    const EPD_DEVICE *dev = EPD_Device(fd);
+
+    if (dev == NULL) {
+        DefaultDevice.SpiFd = fd;
+        DefaultDevice.RstFd = rstfd;
+        DefaultDevice.DcFd = dcfd;
+        DefaultDevice.BusyFd = busyfd;
+        dev = &DefaultDevice;
+    }
+    return dev;
+}
+
+/******************************************************************************
+function    : Drives the D/C pin, skipped if it is already at that level
+parameter   : 
+        level   :   GPIO_Value_Low for Command, GPIO_Value_High for Data
+return      : NONE
+******************************************************************************/
+static void Set_DC(int fd, GPIO_Value_Type level) {
+    int pin = EPD_Device_Pins(fd)->DcFd;
+
+    if (dcLevel != level || dcLevelFd != pin) {
+        GPIO_SetValue(pin, level);
+        EPD_Telemetry_Gpio(fd);
+        dcLevel = level;
+        dcLevelFd = pin;
+    }
+}
+
 //Constants Defined for Custom Delay Generation
 const struct timespec delay_1s = { 1, 0 };
 const struct timespec delay_1us = { 0, 1000 };
@@ -90,14 +154,185 @@ typedef enum {
     ExitCode_SpiTransfers = 8,
 
     ExitCode_Spi_Read = 9,
-    ExitCode_SPi_Write = 10
+    ExitCode_SPi_Write = 10,
+
+    ExitCode_Capture = 11
 
 }ExitCode;
 
+/******************************************************************************
+function    : Writes the trace collected in Buf to the capture file
+******************************************************************************/
+static void Capture_Flush(void) {
+    if (Capture.FileFd < 0 || Capture.Len == 0) {
+        return;
+    }
+    if (write(Capture.FileFd, Capture.Buf, Capture.Len) != (ssize_t)Capture.Len) {
+        Log_Debug("ERROR : EPD_Capture : Could not write the trace file : %d\n", errno);
+        Capture.Overflow = 1;
+        Capture.Active = 0;
+        return;
+    }
+    Capture.Written += Capture.Len;
+    Capture.Len = 0;
+}
+
+/******************************************************************************
+function    : Appends bytes to the trace, flushing to the file when Buf is full
+******************************************************************************/
+static void Capture_Put(const uint8_t *Data, uint32_t Len) {
+    while (Len != 0 && Capture.Active) {
+        uint32_t n = Capture.Size - Capture.Len;
+
+        if (n == 0) {
+            if (Capture.FileFd < 0) {
+                Capture.Overflow = 1;
+                Capture.Active = 0;
+                break;
+            }
+            Capture_Flush();
+            continue;
+        }
+        if (n > Len) {
+            n = Len;
+        }
+        memcpy(&Capture.Buf[Capture.Len], Data, n);
+        Capture.Len += n;
+        Data += n;
+        Len -= n;
+    }
+}
+
+static uint8_t Capture_Varint(uint8_t *Out, uint32_t Value) {
+    uint8_t n = 0;
+
+    while (Value >= 0x80) {
+        Out[n++] = (uint8_t)(Value | 0x80);
+        Value >>= 7;
+    }
+    Out[n++] = (uint8_t)Value;
+    return n;
+}
+
+/******************************************************************************
+function    : Starts a trace record : tag and time since the previous record, then 
+              the value as a varint. Without a file the record must fit in Buf whole, 
+              otherwise the capture stops.
+parameter   :
+        Type     :   EPD_TRACE_xxx
+        Device   :   Display index, EPD_TRACE_NO_DEVICE for none
+        Value    :   Varint after the time (length or delay)
+        Payload  :   Bytes that will follow the record head
+return      : 1 if the record is taken
+******************************************************************************/
+static int Capture_Record(uint8_t Type, uint8_t Device, uint32_t Value, uint32_t Payload) {
+    uint8_t head[1 + 5 + 5];
+    uint8_t n = 0;
+    uint32_t now = EPD_Telemetry_Now_Us();
+
+    head[n++] = EPD_TRACE_TAG(Type, Device);
+    n += Capture_Varint(&head[n], now - Capture.LastUs);
+    n += Capture_Varint(&head[n], Value);
+    if (Capture.FileFd < 0 && Capture.Len + n + Payload > Capture.Size) {
+        Capture.Overflow = 1;
+        Capture.Active = 0;
+        return 0;
+    }
+    Capture.LastUs = now;
+    Capture_Put(head, n);
+    return 1;
+}
+
+/******************************************************************************
+function    : Records the bytes of an SPI transfer with the D/C level they went out with
+******************************************************************************/
+static void Capture_Spi(int fd, uint8_t Type, const uint8_t *Data, uint32_t Len) {
+    int dev = EPD_Device_Index(fd);
+
+    // Displays that were not opened have no device number in the trace
+    if (Capture.Active && dev >= 0 && Capture_Record(Type, (uint8_t)dev, Len, Len)) {
+        Capture_Put(Data, Len);
+    }
+}
+
+/******************************************************************************
+function    : Records a BUSY level, at the start of a wait or when it changed
+******************************************************************************/
+static void Capture_Busy(int fd, uint8_t High, uint8_t Wait) {
+    int dev = EPD_Device_Index(fd);
+
+    if (!Capture.Active || dev < 0 || (!Wait && Capture.Busy[dev] == High)) {
+        return;
+    }
+    Capture.Busy[dev] = High;
+    // The level goes in the place of the varint, it is below 0x80
+    Capture_Record(EPD_TRACE_BUSY, (uint8_t)dev, (High ? EPD_TRACE_BUSY_HIGH : 0) | (Wait ? EPD_TRACE_BUSY_WAIT : 0), 0);
+}
+
+/******************************************************************************
+function    : Records a write of the reset pin
+******************************************************************************/
+static void Capture_Rst(int fd, uint8_t Level) {
+    int dev = EPD_Device_Index(fd);
+
+    if (Capture.Active && dev >= 0) {
+        Capture_Record(EPD_TRACE_RST, (uint8_t)dev, Level, 0);
+    }
+}
+
+/******************************************************************************
+function    : Starts capturing every byte, D/C level, BUSY / reset edge and delay 
+              of all displays as an epd_trace (Common/epd_trace.h). Replay it on a 
+              PC with Tools/EpdReplay.
+parameter   :
+        Buf     :   Trace buffer, must stay valid till EPD_Capture_Stop
+        Size    :   Bytes in Buf, 64 at least
+        FileFd  :   File the trace is written to whenever Buf is full, e.g. from 
+                    Storage_OpenMutableFile; -1 keeps the trace in Buf only and 
+                    stops the capture once it is full
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Capture_Start(uint8_t *Buf, uint32_t Size, int FileFd) {
+    static const uint8_t header[EPD_TRACE_HEADER_BYTES] = { 'E', 'P', 'D', 'T', EPD_TRACE_VERSION };
+
+    if (Buf == NULL || Size < 64) {
+        Log_Debug("ERROR : EPD_Capture_Start : Trace buffer too small\n");
+        return ExitCode_Capture;
+    }
+    memset(&Capture, 0, sizeof(Capture));
+    memset(Capture.Busy, 0xFF, sizeof(Capture.Busy));
+    Capture.Buf = Buf;
+    Capture.Size = Size;
+    Capture.FileFd = FileFd;
+    Capture.LastUs = EPD_Telemetry_Now_Us();
+    Capture.Active = 1;
+    Capture_Put(header, sizeof(header));
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Stops the capture and writes what is left in Buf to the file
+parameter   : NONE
+return      : Trace bytes, in Buf without a file or written to the file
+******************************************************************************/
+uint32_t EPD_Capture_Stop(void) {
+    if (Capture.Active) {
+        Capture_Flush();
+    }
+    Capture.Active = 0;
+    if (Capture.Overflow) {
+        Log_Debug("INFO : EPD_Capture_Stop : Trace buffer was full, the trace is cut short\n");
+    }
+    return (Capture.FileFd < 0) ? Capture.Len : Capture.Written;
+}
+
 // Global Universal Functions Definitations
  
 // Milisec delay generator
 int delay_ms(uint32_t delay) {
+    if (Capture.Active) {
+        Capture_Record(EPD_TRACE_DELAY, EPD_TRACE_NO_DEVICE, delay * 1000u, 0);
+    }
     while (delay != 0) {
         nanosleep(&delay_1ms, NULL);
         --delay;
@@ -107,6 +342,9 @@ int delay_ms(uint32_t delay) {
 
 // Microsec delay generator
 int delay_us(uint32_t delay) {
+    if (Capture.Active) {
+        Capture_Record(EPD_TRACE_DELAY, EPD_TRACE_NO_DEVICE, delay, 0);
+    }
     while (delay != 0) {
         nanosleep(&delay_1us, NULL);
         --delay;
@@ -116,6 +354,9 @@ int delay_us(uint32_t delay) {
 
 // Sec delay generator
 int delay_s(uint32_t delay) {
+    if (Capture.Active) {
+        Capture_Record(EPD_TRACE_DELAY, EPD_TRACE_NO_DEVICE, delay * 1000000u, 0);
+    }
     while (delay != 0) {
         nanosleep(&delay_1s, NULL);
         --delay;
@@ -132,6 +373,10 @@ return      : Success Signal / Error Code
 int EPD_gpio_init(void) {
     int ret;
 
+    if (rstfd >= 0) {
+        return ExitCode_Success;    // Already opened, by EPD_Device_Open too
+    }
+
     // initialiazing Extra Pins required for Display operation.
     // This is automatically calculated based on the Click Board parameter selected by your program 
     // Pl refer readme on how to use this. DO NOT MODIFY THIS IS AUTOMATICALLY SELECTED. 
@@ -150,6 +395,8 @@ int EPD_gpio_init(void) {
         Log_Debug("ERROR : EPD_gpio_init : Could not set dcfd gpio\n");
         return ExitCode_Gpio_Open;
     }
+    dcLevel = GPIO_Value_High;
+    dcLevelFd = dcfd;
 
     // Setting RST Pin to RESET Pos. 
     ret = GPIO_SetValue(rstfd, GPIO_Value_High);
@@ -167,59 +414,73 @@ parameter   : NONE
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_reset(void) {
+    return EPD_Device_Reset(-1);
+}
+
+/******************************************************************************
+function    : Resets one EPD Display 
+parameter   : 
+        SpiFd   :   Spi Fd of the display
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Device_Reset(int SpiFd) {
     int ret; 
+    int pin = EPD_Device_Pins(SpiFd)->RstFd;
 
-    ret = GPIO_SetValue(rstfd, GPIO_Value_High);
+    ret = GPIO_SetValue(pin, GPIO_Value_High);
     if (ret != 0) {
         Log_Debug("ERROR : EPD_reset : Could not set RstFd gpio\n");
         return ExitCode_Gpio_Open;
     }
+    EPD_Telemetry_Gpio(SpiFd);
+    Capture_Rst(SpiFd, 1);
 
-    ret = GPIO_SetValue(rstfd, GPIO_Value_Low);
+    ret = GPIO_SetValue(pin, GPIO_Value_Low);
     if (ret != 0) {
         Log_Debug("ERROR : EPD_reset : Could not set RstFd gpio\n");
         return ExitCode_Gpio_Open;
     }
+    EPD_Telemetry_Gpio(SpiFd);
+    Capture_Rst(SpiFd, 0);
 
     delay_ms(200);
-    ret = GPIO_SetValue(rstfd, GPIO_Value_High);
+    ret = GPIO_SetValue(pin, GPIO_Value_High);
     if (ret != 0) {
         Log_Debug("ERROR : EPD_reset : Could not set RstFd gpio\n");
         return ExitCode_Gpio_Open;
     }
-    // Kinna Over Kill
-    /*
-    ret = GPIO_SetValue(rstfd, GPIO_Value_Low);
-    if (ret != 0) {
-        Log_Debug("ERROR : EPD_reset : Could not set RstFd gpio\n");
-        return ExitCode_Gpio_Open;
-    }
-
-    delay_ms(100);
-    ret = GPIO_SetValue(rstfd, GPIO_Value_High);
-    if (ret != 0) {
-        Log_Debug("ERROR : EPD_reset : Could not set RstFd gpio\n");
-        return ExitCode_Gpio_Open;
-    }
-    delay_ms(10);
-    */
+    EPD_Telemetry_Gpio(SpiFd);
+    Capture_Rst(SpiFd, 1);
     return ExitCode_Success;
 }
  
 /******************************************************************************
-function: Initialiases the SPI interface and returns the SPI FD
+function: Opens the SPI master of the CLICK_SLOT display, see AzSphere_Spi_Open
 parameter:
-    fd   :   File Discripter for SPI Interface to be intialiased by the user refer Readme
-return      : Success Signal / Error Code
+    fd   :   Not used, kept for API compatibility
+return      : New SPI FD / Error Code
 ******************************************************************************/
 int AzSphere_Spi_Init(int fd) {
+    (void)fd;       // Kept for API compatibility, the fd is opened here
+    return AzSphere_Spi_Open(ILI9341_SK_ISU1_SPI, ILI9341_SPI_CS);
+}
+
+/******************************************************************************
+function: Opens an SPI master for an EPD Display and returns the SPI FD
+parameter:
+    Isu  :   SPI interface, e.g. AVNET_MT3620_SK_ISU0_SPI / ILI9341_SK_ISU1_SPI (needs to be in the app manifest)
+    Cs   :   Chip select, MT3620_SPI_CS_A / MT3620_SPI_CS_B
+return      : SPI FD / Error Code
+******************************************************************************/
+int AzSphere_Spi_Open(SPI_InterfaceId Isu, SPI_ChipSelectId Cs) {
+    int fd;
     int ret = SPIMaster_InitConfig(&config);    // init spi 
     if (ret != 0) {
         Log_Debug("ERROR : AzSphere_Spi_Init : SPIMaster_InitConfig = %d\n", ret);
         return ExitCode_Init_InitConfig;
     }
     config.csPolarity = SPI_ChipSelectPolarity_ActiveLow;   // CS as active low refere EPD Datasheet 
-    fd = SPIMaster_Open(ILI9341_SK_ISU1_SPI, ILI9341_SPI_CS, &config);
+    fd = SPIMaster_Open(Isu, Cs, &config);
     if (fd < 0) {
         Log_Debug("ERROR: SPIMaster_Open : %d\n", fd);
         return ExitCode_Init_OpenSpiMaster;
@@ -247,33 +508,178 @@ int AzSphere_Spi_Init(int fd) {
     return fd; // returns FD as  this will be used by all other functions Ensure this is not -1; 
 }
 
+/******************************************************************************
+function: Opens the SPI master of the display on a click slot 
+parameter:
+    Slot :   Click slot, 1 or 2. Both are on ISU1, with CS A and CS B
+return      : SPI FD / Error Code
+******************************************************************************/
+int AzSphere_Spi_Open_Slot(uint8_t Slot) {
+    return AzSphere_Spi_Open(ILI9341_SK_ISU1_SPI, (Slot == 2) ? MT3620_SPI_CS_B : MT3620_SPI_CS_A);
+}
+
+/******************************************************************************
+function    : Registers a display and opens its pins. A pin already opened for 
+              another display (the shared D/C) is reused.
+parameter   :
+    SpiFd   :   Spi Fd of the display
+    RstPin  :   Reset pin
+    DcPin   :   Data / Command pin
+    BusyPin :   Busy pin
+return      : Index of the display / Error Code (negative)
+******************************************************************************/
+int EPD_Device_Open_Pins(int SpiFd, GPIO_Id RstPin, GPIO_Id DcPin, GPIO_Id BusyPin) {
+    // Pins opened so far, the CLICK_SLOT ones from EPD_gpio_init included
+    static GPIO_Id OpenPins[EPD_MAX_DEVICES * 3 + 3];
+    static int OpenFds[EPD_MAX_DEVICES * 3 + 3];
+    static uint8_t OpenCount;
+    GPIO_Id pins[3] = { RstPin, DcPin, BusyPin };
+    int fds[3];
+    int index;
+
+    for (uint8_t i = 0; i < DeviceCount; i++) {
+        if (Devices[i].SpiFd == SpiFd) {
+            return i;
+        }
+    }
+    if (DeviceCount == EPD_MAX_DEVICES) {
+        Log_Debug("ERROR : EPD_Device_Open_Pins : Only %d displays supported\n", EPD_MAX_DEVICES);
+        return -ExitCode_Gpio_Open;
+    }
+
+    if (OpenCount == 0 && rstfd >= 0) {
+        OpenPins[OpenCount] = RST_PIN;  OpenFds[OpenCount++] = rstfd;
+        OpenPins[OpenCount] = DC_PIN;   OpenFds[OpenCount++] = dcfd;
+        OpenPins[OpenCount] = BUSY_PIN; OpenFds[OpenCount++] = busyfd;
+    }
+
+    for (uint8_t p = 0; p < 3; p++) {
+        fds[p] = -1;
+        for (uint8_t i = 0; i < OpenCount; i++) {
+            if (OpenPins[i] == pins[p]) {
+                fds[p] = OpenFds[i];
+            }
+        }
+        if (fds[p] < 0) {
+            fds[p] = (p == 2) ? GPIO_OpenAsInput(pins[p]) : GPIO_OpenAsOutput(pins[p], GPIO_OutputMode_PushPull, GPIO_Value_High);
+            if (fds[p] < 0) {
+                Log_Debug("ERROR : EPD_Device_Open_Pins : Could not open gpio %d\n", pins[p]);
+                return -ExitCode_Gpio_Open;
+            }
+            OpenPins[OpenCount] = pins[p];
+            OpenFds[OpenCount++] = fds[p];
+        }
+    }
+
+    // The CLICK_SLOT display also serves the functions without an fd
+    if (rstfd < 0 && RstPin == RST_PIN && DcPin == DC_PIN && BusyPin == BUSY_PIN) {
+        rstfd = fds[0];
+        dcfd = fds[1];
+        busyfd = fds[2];
+    }
+
+    index = DeviceCount++;
+    Devices[index].SpiFd = SpiFd;
+    Devices[index].RstFd = fds[0];
+    Devices[index].DcFd = fds[1];
+    Devices[index].BusyFd = fds[2];
+    return index;
+}
+
+/******************************************************************************
+function    : Registers the display on a click slot and opens its pins
+parameter   :
+    SpiFd   :   Spi Fd of the display, see AzSphere_Spi_Open_Slot
+    Slot    :   Click slot, 1 or 2
+return      : Index of the display / Error Code (negative)
+******************************************************************************/
+int EPD_Device_Open(int SpiFd, uint8_t Slot) {
+    if (Slot == 2) {
+        return EPD_Device_Open_Pins(SpiFd, EPD_SLOT2_RST_PIN, EPD_SLOT2_DC_PIN, EPD_SLOT2_BUSY_PIN);
+    }
+    return EPD_Device_Open_Pins(SpiFd, EPD_SLOT1_RST_PIN, EPD_SLOT1_DC_PIN, EPD_SLOT1_BUSY_PIN);
+}
+
+/******************************************************************************
+function    : Looks a display up by its SPI fd
+return      : Device, NULL if not opened
+******************************************************************************/
+const EPD_DEVICE *EPD_Device(int SpiFd) {
+    for (uint8_t i = 0; i < DeviceCount; i++) {
+        if (Devices[i].SpiFd == SpiFd) {
+            return &Devices[i];
+        }
+    }
+    return NULL;
+}
+
+/******************************************************************************
+function    : Index of a display, drivers keep their per display state by it
+return      : Index, -1 if not opened
+******************************************************************************/
+int EPD_Device_Index(int SpiFd) {
+    const EPD_DEVICE *dev = EPD_Device(SpiFd);
+
+    return (dev != NULL) ? (int)(dev - Devices) : -1;
+}
+
 /******************************************************************************
 function    : Checks if EPD is Busy
 parameter   : NONE
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Busy(void) {
+    return EPD_Device_Busy(-1);
+}
+
+/******************************************************************************
+function    : Waits till one EPD is not Busy
+parameter   : 
+        SpiFd   :   Spi Fd of the display
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Device_Busy(int SpiFd) {
     int ret;
+    int pin = EPD_Device_Pins(SpiFd)->BusyFd;
     GPIO_Value_Type readgpio = 0;
 
-    Log_Debug("INFO : EPD_Busy : e-Paper busy \n");   // to know that module is not busy
+    LOG_DEBUG("EPD_Busy : e-Paper busy, fd %d", pin);
     
-    ret = GPIO_GetValue(busyfd, &readgpio); // BUSY pin is High is Module is busy 
+    ret = GPIO_GetValue(pin, &readgpio); // BUSY pin is High is Module is busy 
     if (ret < 0) {
         Log_Debug("ERROR : EPD_Busy : Failed to read GPIO Value : %d\n", ret);
         return ExitCode_Gpio_Read;
     }
+    Capture_Busy(SpiFd, readgpio == GPIO_Value_High, 1);
     
     while (readgpio == GPIO_Value_High) {      //LOW: idle, HIGH: busy
-        GPIO_GetValue(busyfd, &readgpio); // BUSY pin is High is Module is busy 
+        GPIO_GetValue(pin, &readgpio); // BUSY pin is High is Module is busy 
         //delay_ms(100);   //Not ideal but works so :)
     }
     
-    Log_Debug("INFO : EPD_Busy : e-Paper busy released \n"); // to know that module is not busy 
+    Capture_Busy(SpiFd, 0, 0);
+    LOG_DEBUG("EPD_Busy : e-Paper busy released, fd %d", pin);
     
     return ExitCode_Success;
 }
 
+/******************************************************************************
+function    : Reads the BUSY pin of one EPD without waiting
+parameter   : 
+        SpiFd   :   Spi Fd of the display
+return      : 1 if busy, 0 if idle, negative on Error
+******************************************************************************/
+int EPD_Device_Is_Busy(int SpiFd) {
+    GPIO_Value_Type readgpio = 0;
+
+    if (GPIO_GetValue(EPD_Device_Pins(SpiFd)->BusyFd, &readgpio) < 0) {
+        Log_Debug("ERROR : EPD_Device_Is_Busy : Failed to read GPIO Value\n");
+        return -ExitCode_Gpio_Read;
+    }
+    Capture_Busy(SpiFd, readgpio == GPIO_Value_High, 0);
+    return readgpio == GPIO_Value_High;
+}
+
 /******************************************************************************
 function    : Reads the Value from SPI Bus : Vestigial function as MOSI is NC in the Display Module. 
               Stores the Read data into *spiReadData for global use 
@@ -315,16 +721,16 @@ int Spi_Write(int fd, uint8_t dc, uint8_t *buf, uint32_t len) {
     transfers.length = len;     // To send multiple bytes over spi
 
     if (dc == 1) //if sending a Command
-        GPIO_SetValue(dcfd, GPIO_Value_Low);
+        Set_DC(fd, GPIO_Value_Low);
+    else         // spiWriteCmd leaves D/C low, make sure the bytes go out as Data
+        Set_DC(fd, GPIO_Value_High);
 
     spi_transferredBytes = SPIMaster_TransferSequential(fd, &transfers, transferCount);
-    Log_Debug("INFO : Spi_Write : No of Bytes Transfered over SPIFD=%d : %d \n",fd, spi_transferredBytes);
-    
-    if (dc == 1) // changing to Data 
-        GPIO_SetValue(dcfd, GPIO_Value_High);
+    EPD_Telemetry_Spi(fd, (spi_transferredBytes > 0) ? (uint32_t)spi_transferredBytes : 0);
+    Capture_Spi(fd, (dc == 1) ? EPD_TRACE_CMD : EPD_TRACE_DATA, buf, (spi_transferredBytes > 0) ? (uint32_t)spi_transferredBytes : 0);
+    LOG_DEBUG("Spi_Write : SPIFD=%d : %d bytes", fd, spi_transferredBytes);
 
     if (spi_transferredBytes == transfers.length) {
-        Log_Debug("INFO : Spi_Write : Leaving SPIFD=%d : %d \n", fd, spi_transferredBytes);
         return spi_transferredBytes;        // Returning no of Tfr Bytes 
     }
 
@@ -354,13 +760,14 @@ int spiWriteData(int fd, uint8_t buf) {
     transfers.length = 1; //sizeof(buf);    // 1 byte data only 
 
 
-    GPIO_SetValue(dcfd, GPIO_Value_High); // sending data 
+    Set_DC(fd, GPIO_Value_High); // sending data 
 
     spi_transferredBytes = SPIMaster_TransferSequential(fd, &transfers, transferCount);
-    //Log_Debug("INFO : Spi_Write : No of Bytes Transfered over SPIFD=%d : %d \n", fd, spi_transferredBytes);
+    EPD_Telemetry_Spi(fd, (spi_transferredBytes > 0) ? (uint32_t)spi_transferredBytes : 0);
+    Capture_Spi(fd, EPD_TRACE_DATA, &buf, (spi_transferredBytes > 0) ? 1 : 0);
+    LOG_DEBUG("Spi_Write_Data : SPIFD=%d : 0x%x", fd, buf);
 
     if (spi_transferredBytes == transfers.length) {
-        //Log_Debug("INFO : Spi_Write : Leaving SPIFD=%d : %d \n", fd, spi_transferredBytes);
         return spi_transferredBytes;
     }
     Log_Debug("ERROR : Spi_Write_Data : Error sending Data over SPI \n");
@@ -388,14 +795,14 @@ int spiWriteCmd(int fd, uint8_t buf) {
     transfers.writeData = &buf;
     transfers.length = 1; //sizeof(buf);    // fixed to 1 byte 
 
-    GPIO_SetValue(dcfd, GPIO_Value_Low); // Sending Command 
+    Set_DC(fd, GPIO_Value_Low); // Sending Command 
 
     spi_transferredBytes = SPIMaster_TransferSequential(fd, &transfers, transferCount);
-    //Log_Debug("INFO : Spi_Write : No of Bytes Transfered over SPIFD=%d : %d \n", fd, spi_transferredBytes);
-
+    EPD_Telemetry_Spi(fd, (spi_transferredBytes > 0) ? (uint32_t)spi_transferredBytes : 0);
+    Capture_Spi(fd, EPD_TRACE_CMD, &buf, (spi_transferredBytes > 0) ? 1 : 0);
+    LOG_DEBUG("Spi_Write_Cmd : SPIFD=%d : 0x%x", fd, buf);
 
     if (spi_transferredBytes == transfers.length) {
-        //Log_Debug("INFO : Spi_Write : Leaving SPIFD=%d : %d \n", fd, spi_transferredBytes);
         return spi_transferredBytes;
     }
 
@@ -6,10 +6,20 @@
 * | Info        :   This file is specific to AzSphere Device line
 * | NOTE        :   There is No Need to modify this interface lib to change EPD parameters.
 *----------------
-* |	This version:   V1.0
+* |	This version:   V1.1
 * | Date        :   2020-05-08
 * | Info        :
 * -----------------------------------------------------------------------------
+* Change Log V1.1 :
+* 1. Added : D/C pin is only written when its level changes
+* 2. Added : Several displays at once, each one known by its SPI fd (EPD_Device_Open), with 
+*            per display reset / busy. Both click slots share ISU1 and the D/C pin.
+* 3. Changed : Busy and SPI traces go through the deferred LOG_DEBUG (Tools/Log), compiled out
+*            unless LOG_LEVEL is raised to LOG_LEVEL_DEBUG
+* 4. Added : SPI transfers, bytes and output pin writes are counted for the refresh telemetry
+* 5. Added : Capture mode, the command stream of all displays is recorded as a binary trace
+*            (Common/epd_trace.h) for Tools/EpdReplay
+* -----------------------------------------------------------------------------
 * Change Log V1.0 (2020-05-08):
 * 1. Fixed : Reset Bug 
 * 2. Deep Sleep Mode Mow Works. 
@@ -76,6 +86,28 @@
 #define RST_PIN AVNET_MT3620_SK_GPIO16    //Connected to RST Pin on mikroBus Slot 1
 #endif
 
+// Pins of every click slot, to drive displays on both slots at once. The slots share ISU1 SPI 
+// (CS A on slot 1, CS B on slot 2) and the D/C pin.
+#define EPD_SLOT1_DC_PIN AVNET_MT3620_SK_GPIO2
+#define EPD_SLOT1_BUSY_PIN  AVNET_MT3620_SK_GPIO0
+#define EPD_SLOT1_RST_PIN AVNET_MT3620_SK_GPIO16
+#define EPD_SLOT2_DC_PIN AVNET_MT3620_SK_GPIO2
+#define EPD_SLOT2_BUSY_PIN  AVNET_MT3620_SK_GPIO1
+#define EPD_SLOT2_RST_PIN AVNET_MT3620_SK_GPIO17
+
+// No of displays that can be driven at once
+#ifndef EPD_MAX_DEVICES
+#define EPD_MAX_DEVICES 2
+#endif
+
+// One display : the SPI fd it is reached by and its pins. Displays sharing a pin share its fd.
+typedef struct {
+    int SpiFd;
+    int RstFd;
+    int DcFd;
+    int BusyFd;
+} EPD_DEVICE;
+
 #define EPD_COMMAND 1	//Sending if command /Data 
 #define EPD_DATA 0		//Sending if command /Data 
 
@@ -91,11 +123,26 @@ int delay_us(uint32_t delay);  // Microsec delay generator
 int delay_s(uint32_t delay);	  // Sec delay generator
 int EPD_gpio_init(void);   // Initialization of GPIO Reqd for EPD Ref above for Pin Layouts 
 int EPD_reset(void);   // Initialization of GPIO Reqd for EPD Ref above for Pin Layouts
-int AzSphere_Spi_Init(int fd);  // returns the SPI FD, for further use 
+int AzSphere_Spi_Init(int fd);  // Opens the CLICK_SLOT SPI master and returns the new SPI FD, fd is not used
 int EPD_Busy(void);   // Checks weather EPD IS Busy or Not (You can use Fixed Delay if Not using the pin
 int Spi_Write(int fd, uint8_t dc, uint8_t *buf, uint32_t len); //Writes Byte to Spi Bus 
 int Spi_Read(int fd, uint8_t reg); // Reads the Value from SPI Bus : Vestigial function as MOSI is NC in the Display Module. 
 int spiWriteCmd(int fd, uint8_t buf);   // Added for Simplicity of code 
 int spiWriteData(int fd, uint8_t buf);  // Added for Simplicity of code 
 
+// Multiple displays, every display is known by its SPI fd. Functions without an fd use the CLICK_SLOT pins.
+int AzSphere_Spi_Open(SPI_InterfaceId Isu, SPI_ChipSelectId Cs);  // Opens and configures an SPI master, returns the fd
+int AzSphere_Spi_Open_Slot(uint8_t Slot);  // SPI fd of the display on click slot 1 or 2
+int EPD_Device_Open(int SpiFd, uint8_t Slot);  // Opens the pins of a click slot for the display, returns its index
+int EPD_Device_Open_Pins(int SpiFd, GPIO_Id RstPin, GPIO_Id DcPin, GPIO_Id BusyPin);  // Same for a display wired anywhere else
+const EPD_DEVICE *EPD_Device(int SpiFd);  // NULL if not opened
+int EPD_Device_Index(int SpiFd);  // Index of the display, -1 if not opened
+int EPD_Device_Reset(int SpiFd);  // EPD_reset of one display
+int EPD_Device_Busy(int SpiFd);  // EPD_Busy of one display
+int EPD_Device_Is_Busy(int SpiFd);  // 1 if busy, 0 if idle, without waiting
+
+// Capture of the command stream, replayed on a PC by Tools/EpdReplay
+int EPD_Capture_Start(uint8_t *Buf, uint32_t Size, int FileFd);  // FileFd -1 keeps the trace in Buf only
+uint32_t EPD_Capture_Stop(void);  // Returns the trace length
+
 #endif
\ No newline at end of file
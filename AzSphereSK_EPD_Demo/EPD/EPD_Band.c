@@ -0,0 +1,261 @@
+/*****************************************************************************
+* | File      	:  	EPD_Band.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Band (strip) renderer, draws a frame through a buffer of a few rows
+* | Info        :   See EPD_Band.h
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Band rendering, the draw calls of a frame are run once per chunk of panel rows straight into
+*            the SPI chunk of the upload stream, no frame buffer
+* 2. Added : Display lists (EPD_BAND_ITEM tables), items outside a band are skipped
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+// Global Includes 
+#include "../HighLevelCore/applibs_versions.h"
+
+#include <applibs/log.h>
+
+#include "EPD_Band.h"
+#include "../Tools/QRcode/qrcode_gfx.h"
+
+// Errors of the stream itself are the driver ExitCodes
+typedef enum {
+    ExitCode_Success = 0,
+
+    ExitCode_Band_Paint = 9
+} ExitCode;
+
+// Frame being drawn, Ctx of the stream
+typedef struct {
+    uint16_t Color;
+    EPD_BAND_DRAW Draw;
+    void *Ctx;
+} EPD_BAND_JOB;
+
+/******************************************************************************
+function    : Stream fill function, draws the frame into the chunk with the 
+              Paint band set to the rows of the chunk
+parameter   : See EPD_FILL_ROWS, the chunk is always whole panel rows
+return      : NONE
+******************************************************************************/
+static void EPD_Band_Fill(void *Ctx, uint8_t *Chunk, uint16_t Xbyte, uint16_t WidthByte, uint16_t Ystart, uint16_t Rows) {
+    const EPD_BAND_JOB *job = (const EPD_BAND_JOB *)Ctx;
+
+    (void)Xbyte;        // Whole rows, the window is the full panel width
+    (void)WidthByte;
+    Paint_SelectImage(Chunk);
+    Paint_SetBand(Ystart, Rows);
+    Paint_Clear(job->Color);
+    job->Draw(job->Ctx);
+}
+
+/******************************************************************************
+function    : Draws a frame band by band and writes it into the panel RAM, the 
+              display is not updated. Paint is set up for the panel with Rotate 
+              and given back as it was.
+parameter   :
+       fd     :   SPI File Discripter used for read/Write() functions
+       Rotate :   Paint rotation of the drawing calls, 0 / 90 / 180 / 270
+       Color  :   Background, every band is cleared to it
+       Draw   :   Draws the frame, run once per EPD_CHUNK_ROWS rows
+       Ctx    :   Passed as it is to Draw
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Band_Upload(int fd, uint16_t Rotate, uint16_t Color, EPD_BAND_DRAW Draw, void *Ctx) {
+    EPD_BAND_JOB job = { Color, Draw, Ctx };
+    EPD_STREAM stream;
+    PAINT saved = Paint;
+    int ret;
+
+    if (Draw == NULL) {
+        Log_Debug("ERROR : EPD_Band_Upload : No draw function\n");
+        return ExitCode_Band_Paint;
+    }
+
+    // Panel memory layout, 1 bit per pixel, the band buffer is the chunk of the stream
+    Paint_NewImage(stream.Chunk, EPD_2in9_WIDTH, EPD_2in9_HEIGHT, Rotate, Color);
+
+    ret = EPD_Stream_Begin_2in9(&stream, fd, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_Band_Fill, &job);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Stream_Run_2in9(&stream);
+    }
+
+    Paint = saved;
+    return ret;
+}
+
+/******************************************************************************
+function    : EPD_Band_Upload and a display update, parameters as EPD_Band_Upload
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Band_Display(int fd, uint16_t Rotate, uint16_t Color, EPD_BAND_DRAW Draw, void *Ctx) {
+    int ret = EPD_Band_Upload(fd, Rotate, Color, Draw, Ctx);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+
+    EPD_Turn_On_Display_2in9(fd);
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Drawing area of a display list item
+parameter   :
+       Item           :   Display list item
+       Xs, Ys, Xe, Ye :   Output, corners in drawing coordinates (inclusive)
+return      : 1 if the area is known, 0 if the item may draw anywhere
+******************************************************************************/
+static uint8_t EPD_Band_Item_Area(const EPD_BAND_ITEM *Item, int32_t *Xs, int32_t *Ys, int32_t *Xe, int32_t *Ye) {
+    int32_t w = Item->Width;
+
+    switch (Item->Op) {
+    case EPD_BAND_CLEAR_WINDOW:
+        *Xs = Item->X0; *Ys = Item->Y0; *Xe = (int32_t)Item->X1 - 1; *Ye = (int32_t)Item->Y1 - 1;
+        return 1;
+    case EPD_BAND_POINT:
+    case EPD_BAND_LINE:
+    case EPD_BAND_RECT: {
+        // Thick points are drawn around the point, or right and up of it
+        int32_t x1 = (Item->Op == EPD_BAND_POINT) ? Item->X0 : Item->X1;
+        int32_t y1 = (Item->Op == EPD_BAND_POINT) ? Item->Y0 : Item->Y1;
+        *Xs = ((Item->X0 < x1) ? Item->X0 : x1) - w;
+        *Xe = ((Item->X0 > x1) ? Item->X0 : x1) + w;
+        *Ys = ((Item->Y0 < y1) ? Item->Y0 : y1) - w;
+        *Ye = ((Item->Y0 > y1) ? Item->Y0 : y1) + w;
+        return 1;
+    }
+    case EPD_BAND_CIRCLE:
+        *Xs = (int32_t)Item->X0 - Item->X1 - w; *Xe = (int32_t)Item->X0 + Item->X1 + w;
+        *Ys = (int32_t)Item->Y0 - Item->X1 - w; *Ye = (int32_t)Item->Y0 + Item->X1 + w;
+        return 1;
+    case EPD_BAND_TEXT: {
+        if (Item->Data == NULL || Item->Font == NULL) {
+            return 0;
+        }
+        // A string running past the right edge wraps, it may then cover every row below.
+        // Advances as Paint_DrawString_EN, proportional fonts are narrower than Width.
+        uint32_t len = 0;
+        for (const char *c = (const char *)Item->Data; *c != '\0'; c++) {
+            len += Paint_CharWidth(*c, Item->Font);
+        }
+        *Xs = Item->X0; *Ys = Item->Y0;
+        *Xe = Item->X0 + len - 1; *Ye = (int32_t)Item->Y0 + Item->Font->Height - 1;
+        if (*Xe >= Paint.Width) {
+            *Xs = 0; *Ys = 0; *Xe = Paint.Width - 1; *Ye = Paint.Height - 1;
+        }
+        return 1;
+    }
+    case EPD_BAND_QR: {
+        if (Item->Data == NULL) {
+            return 0;
+        }
+        uint16_t side = QRCODE_GFX_SIDE((const QRCode *)Item->Data, Item->Width, Item->Style);
+        *Xs = Item->X0; *Ys = Item->Y0; *Xe = (int32_t)Item->X0 + side - 1; *Ye = (int32_t)Item->Y0 + side - 1;
+        return 1;
+    }
+    default:
+        return 0;
+    }
+}
+
+/******************************************************************************
+function    : Tells if a display list item can touch the rows of the Paint band
+parameter   :
+       Item :   Display list item
+return      : 1 if it has to be drawn for this band
+******************************************************************************/
+static uint8_t EPD_Band_Item_Visible(const EPD_BAND_ITEM *Item) {
+    int32_t xs, ys, xe, ye;
+
+    if (!EPD_Band_Item_Area(Item, &xs, &ys, &xe, &ye)) {
+        return 1;
+    }
+    if (xe < 0 || ye < 0 || xs >= Paint.Width || ys >= Paint.Height || xs > xe || ys > ye) {
+        return 0;
+    }
+    xs = (xs < 0) ? 0 : xs;
+    ys = (ys < 0) ? 0 : ys;
+    xe = (xe >= Paint.Width) ? Paint.Width - 1 : xe;
+    ye = (ye >= Paint.Height) ? Paint.Height - 1 : ye;
+
+    // Memory rows of the corners, rotation and mirroring only swap or flip the axes
+    uint16_t mx, my, lo = UINT16_MAX, hi = 0;
+    const int32_t cx[4] = { xs, xe, xs, xe };
+    const int32_t cy[4] = { ys, ys, ye, ye };
+    for (uint8_t i = 0; i < 4; i++) {
+        Paint_MapPoint((uint16_t)cx[i], (uint16_t)cy[i], &mx, &my);
+        lo = (my < lo) ? my : lo;
+        hi = (my > hi) ? my : hi;
+    }
+    return hi >= Paint.BandStart && lo < Paint.BandStart + Paint.BandRows;
+}
+
+/******************************************************************************
+function    : EPD_BAND_DRAW replaying a display list, items that can not touch 
+              the current band are skipped
+parameter   :
+       Ctx  :   EPD_BAND_LIST
+return      : NONE
+******************************************************************************/
+void EPD_Band_Draw_List(void *Ctx) {
+    const EPD_BAND_LIST *list = (const EPD_BAND_LIST *)Ctx;
+
+    for (uint16_t i = 0; i < list->Count; i++) {
+        const EPD_BAND_ITEM *it = &list->Items[i];
+        if (!EPD_Band_Item_Visible(it)) {
+            continue;
+        }
+
+        switch (it->Op) {
+        case EPD_BAND_CLEAR_WINDOW:
+            Paint_ClearWindows(it->X0, it->Y0, it->X1, it->Y1, it->Color);
+            break;
+        case EPD_BAND_POINT:
+            Paint_DrawPoint(it->X0, it->Y0, it->Color, (DOT_PIXEL)it->Width, (DOT_STYLE)it->Style);
+            break;
+        case EPD_BAND_LINE:
+            Paint_DrawLine(it->X0, it->Y0, it->X1, it->Y1, it->Color, (DOT_PIXEL)it->Width, (LINE_STYLE)it->Style);
+            break;
+        case EPD_BAND_RECT:
+            Paint_DrawRectangle(it->X0, it->Y0, it->X1, it->Y1, it->Color, (DOT_PIXEL)it->Width, (DRAW_FILL)it->Style);
+            break;
+        case EPD_BAND_CIRCLE:
+            Paint_DrawCircle(it->X0, it->Y0, it->X1, it->Color, (DOT_PIXEL)it->Width, (DRAW_FILL)it->Style);
+            break;
+        case EPD_BAND_TEXT:
+            Paint_DrawString_EN(it->X0, it->Y0, (const char *)it->Data, it->Font, it->Color, it->Back);
+            break;
+        case EPD_BAND_QR:
+            Paint_DrawQRCode((QRCode *)it->Data, it->X0, it->Y0, it->Width, it->Style);
+            break;
+        case EPD_BAND_BITMAP:
+            Paint_DrawBitMap((const unsigned char *)it->Data);
+            break;
+        default:
+            Log_Debug("ERROR : EPD_Band_Draw_List : Unknown operation %d in item %d\n", it->Op, i);
+            break;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/*****************************************************************************
+* | File      	:  	EPD_Band.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Band (strip) renderer, draws a frame through a buffer of a few rows
+* | Info        :   The Gfx calls of the frame are run once per band of EPD_CHUNK_ROWS panel rows, into the
+*                   chunk of the upload stream, and each band is sent before the next one is drawn.
+*                   RAM for the frame is EPD_CHUNK_BYTES (512 bytes by default) for any panel height,
+*                   twice that with EPD_STREAM_PIPELINE where a band is drawn while the last one is sent.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Band rendering, the draw calls of a frame are run once per chunk of panel rows straight into
+*            the SPI chunk of the upload stream, no frame buffer
+* 2. Added : Display lists (EPD_BAND_ITEM tables), items outside a band are skipped
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_BAND_H
+#define EPD_BAND_H
+
+#include <stdint.h>
+
+#include "IL3820_2in9_Driver.h"
+#include "../Tools/GFX/Gfx.h"
+#include "../Tools/QRcode/qrcode.h"
+
+// Draws the whole frame with Paint_xxx calls. It is called once per band, Paint is set up with
+// the band (Paint_SetBand) and cleared, so it has to draw the same frame every time.
+typedef void (*EPD_BAND_DRAW)(void *Ctx);
+
+// Display list operations, the fields used are given per operation
+#define EPD_BAND_CLEAR_WINDOW	0	// X0, Y0, X1, Y1 (end excluded), Color
+#define EPD_BAND_POINT			1	// X0, Y0, Color, Width (DOT_PIXEL), Style (DOT_STYLE)
+#define EPD_BAND_LINE			2	// X0, Y0, X1, Y1, Color, Width (DOT_PIXEL), Style (LINE_STYLE)
+#define EPD_BAND_RECT			3	// X0, Y0, X1, Y1, Color, Width (DOT_PIXEL), Style (DRAW_FILL)
+#define EPD_BAND_CIRCLE			4	// X0, Y0 center, X1 radius, Color, Width (DOT_PIXEL), Style (DRAW_FILL)
+#define EPD_BAND_TEXT			5	// X0, Y0, Data (char *), Font, Color, Back (order of Paint_DrawString_EN)
+#define EPD_BAND_QR				6	// X0, Y0, Data (QRCode *), Width scale, Style quiet zone
+#define EPD_BAND_BITMAP			7	// Data, a whole image (Paint_DrawBitMap)
+
+// One drawing call of a display list, a const table of them can stay in flash
+typedef struct {
+    uint8_t Op;				// EPD_BAND_xxx
+    uint8_t Width;
+    uint8_t Style;
+    uint16_t X0, Y0;
+    uint16_t X1, Y1;
+    uint16_t Color;
+    uint16_t Back;
+    const void *Data;
+    sFONT *Font;
+} EPD_BAND_ITEM;
+
+// Ctx of EPD_Band_Draw_List
+typedef struct {
+    const EPD_BAND_ITEM *Items;
+    uint16_t Count;
+} EPD_BAND_LIST;
+
+// User Functions
+int EPD_Band_Upload(int fd, uint16_t Rotate, uint16_t Color, EPD_BAND_DRAW Draw, void *Ctx);	// Draws the frame into the panel RAM
+int EPD_Band_Display(int fd, uint16_t Rotate, uint16_t Color, EPD_BAND_DRAW Draw, void *Ctx);	// Same and updates the display
+void EPD_Band_Draw_List(void *Ctx);		// EPD_BAND_DRAW running an EPD_BAND_LIST
+
+#endif
@@ -0,0 +1,349 @@
+/*****************************************************************************
+* | File      	:  	EPD_Energy.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Energy accounting of the EPD displays and a budget aware refresh scheduler
+* | Info        :   Model coefficients are starting points, measure your board and panel and set your own.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Energy estimate from refreshes per LUT type, SPI bytes, BUSY time and time awake / asleep
+* 2. Added : Budget per hour for energy and refresh count, non-urgent updates are deferred and coalesced
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+// Global Includes 
+#include <string.h>
+#include <time.h>
+
+#include "../HighLevelCore/applibs_versions.h"
+
+#include <applibs/log.h>
+
+#include "AzSphere_Interface.h"
+#include "EPD_Energy.h"
+
+#define EPD_ENERGY_HOUR_MS	3600000u
+
+// Energy sources, each keeps the nJ below one uJ till they add up
+enum { SRC_REFRESH, SRC_SPI, SRC_BUSY, SRC_AWAKE, SRC_SLEEP, SRC_COUNT };
+
+// Scheduler and power state of one display
+typedef struct {
+    uint8_t State;			// EPD_POWER_xxx
+    uint64_t StateSinceMs;
+    uint8_t Pending;		// Submitted and not shown yet
+    uint8_t PendingUrgent;
+    uint8_t DeferCounted;	// Pending update already counted in Deferred
+    uint64_t PendingSinceMs;
+} EPD_ENERGY_DISPLAY;
+
+// 8 mA while the waveform runs, 10 uA awake and idle, 1 uA in deep sleep, 20 us of CPU and 
+// display per byte at 400 kHz
+static const EPD_ENERGY_MODEL DefaultModel = {
+    { 3000, 800, 440 },		// RefreshUj, full / partial / fast partial (11 of the 20 partial frames)
+    26400,					// BusyUw
+    33,						// AwakeUw
+    3,						// SleepUw
+    2000,					// SpiNjPerByte
+    { 2000, 500, 275 },		// TypicalBusyMs, same as the RefreshMs of the built in waveforms
+    { 4800, 4800, 4800 },	// TypicalBytes, a whole panel and its window setup
+};
+
+static EPD_ENERGY_MODEL Model;
+static uint8_t ModelSet;
+static EPD_ENERGY_BUDGET Budget;
+static EPD_ENERGY_COUNTERS Counters;
+static EPD_ENERGY_DISPLAY Displays[EPD_MAX_DEVICES];
+static uint64_t RemNj[SRC_COUNT];
+static uint64_t BudgetLastMs;
+static uint64_t RefillUj;		// uJ x ms / hour not credited yet
+static uint64_t RefillRefreshes;
+
+static uint64_t EPD_Energy_Now_Ms(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000u + (uint64_t)now.tv_nsec / 1000000u;
+}
+
+static const EPD_ENERGY_MODEL *EPD_Energy_Model(void) {
+    if (!ModelSet) {
+        Model = DefaultModel;
+        ModelSet = 1;
+    }
+    return &Model;
+}
+
+/******************************************************************************
+function    : Adds energy of one source to the estimate and takes it from the budget
+parameter   :
+       Source :   SRC_xxx
+       Nj     :   Energy in nJ
+return      : NONE
+******************************************************************************/
+static void EPD_Energy_Add(uint8_t Source, uint64_t Nj) {
+    static uint64_t *const Uj[SRC_COUNT] = {
+        &Counters.RefreshUj, &Counters.SpiUj, &Counters.BusyUj, &Counters.AwakeUj, &Counters.SleepUj
+    };
+    uint64_t uj;
+
+    RemNj[Source] += Nj;
+    uj = RemNj[Source] / 1000u;
+    RemNj[Source] %= 1000u;
+
+    *Uj[Source] += uj;
+    Counters.TotalUj += uj;
+    Counters.BudgetUj -= (int64_t)uj;
+}
+
+/******************************************************************************
+function    : Brings the awake / sleep time of every display and the budget up to now
+******************************************************************************/
+static uint64_t EPD_Energy_Update(void) {
+    const EPD_ENERGY_MODEL *M = EPD_Energy_Model();
+    uint64_t now = EPD_Energy_Now_Ms();
+
+    for (uint8_t i = 0; i < EPD_MAX_DEVICES; i++) {
+        EPD_ENERGY_DISPLAY *D = &Displays[i];
+        uint64_t ms = now - D->StateSinceMs;
+
+        if (D->State == EPD_POWER_AWAKE) {
+            Counters.AwakeMs += ms;
+            EPD_Energy_Add(SRC_AWAKE, ms * M->AwakeUw);		// uW x ms = nJ
+        } else if (D->State == EPD_POWER_SLEEP) {
+            Counters.SleepMs += ms;
+            EPD_Energy_Add(SRC_SLEEP, ms * M->SleepUw);
+        }
+        D->StateSinceMs = now;
+    }
+
+    // Budget comes back at its hourly rate, up to one hour of it
+    if (BudgetLastMs != 0) {
+        uint64_t ms = now - BudgetLastMs;
+
+        RefillUj += ms * Budget.UjPerHour;
+        Counters.BudgetUj += (int64_t)(RefillUj / EPD_ENERGY_HOUR_MS);
+        RefillUj %= EPD_ENERGY_HOUR_MS;
+        if (Counters.BudgetUj > (int64_t)Budget.UjPerHour) {
+            Counters.BudgetUj = Budget.UjPerHour;
+        }
+
+        RefillRefreshes += ms * Budget.RefreshesPerHour;
+        Counters.BudgetRefreshes += (int32_t)(RefillRefreshes / EPD_ENERGY_HOUR_MS);
+        RefillRefreshes %= EPD_ENERGY_HOUR_MS;
+        if (Counters.BudgetRefreshes > (int32_t)Budget.RefreshesPerHour) {
+            Counters.BudgetRefreshes = Budget.RefreshesPerHour;
+        }
+    }
+    BudgetLastMs = now;
+    return now;
+}
+
+/******************************************************************************
+function    : Accounts a finished refresh, called by the driver when BUSY dropped
+parameter   :
+       fd     :   SPI fd of the display
+       Kind   :   EPD_ENERGY_FULL / PART / FAST
+       Bytes  :   SPI bytes sent for it
+       BusyUs :   Waveform time
+return      : NONE
+******************************************************************************/
+void EPD_Energy_Refresh(int fd, uint8_t Kind, uint32_t Bytes, uint32_t BusyUs) {
+    const EPD_ENERGY_MODEL *M = EPD_Energy_Model();
+
+    (void)fd;
+    if (Kind >= EPD_ENERGY_KINDS) {
+        Kind = EPD_ENERGY_FULL;
+    }
+    EPD_Energy_Update();
+
+    Counters.Refreshes[Kind]++;
+    Counters.BudgetRefreshes--;
+    Counters.SpiBytes += Bytes;
+    Counters.BusyUs += BusyUs;
+    EPD_Energy_Add(SRC_REFRESH, (uint64_t)M->RefreshUj[Kind] * 1000u);
+    EPD_Energy_Add(SRC_SPI, (uint64_t)Bytes * M->SpiNjPerByte);
+    EPD_Energy_Add(SRC_BUSY, (uint64_t)BusyUs * M->BusyUw / 1000u);	// uW x us = pJ
+}
+
+/******************************************************************************
+function    : Tells the power state of a display, the time in each state is 
+              accounted from here on
+parameter   :
+       fd     :   SPI fd of the display
+       State  :   EPD_POWER_xxx
+return      : NONE
+******************************************************************************/
+void EPD_Energy_Power(int fd, uint8_t State) {
+    int index = EPD_Device_Index(fd);
+
+    EPD_Energy_Update();
+    if (index >= 0) {
+        Displays[index].State = State;
+    }
+}
+
+/******************************************************************************
+function    : Replaces the energy model
+parameter   :
+       NewModel :   Coefficients, copied; NULL for the defaults
+return      : NONE
+******************************************************************************/
+void EPD_Energy_Set_Model(const EPD_ENERGY_MODEL *NewModel) {
+    EPD_Energy_Update();
+    Model = (NewModel != NULL) ? *NewModel : DefaultModel;
+    ModelSet = 1;
+}
+
+/******************************************************************************
+function    : Sets the budget of the scheduler, the first hour of it is available 
+              right away
+parameter   :
+       NewBudget :   Limits, copied; NULL or 0 limits for no limit
+return      : NONE
+******************************************************************************/
+void EPD_Energy_Set_Budget(const EPD_ENERGY_BUDGET *NewBudget) {
+    EPD_Energy_Update();
+    if (NewBudget != NULL) {
+        Budget = *NewBudget;
+    } else {
+        memset(&Budget, 0, sizeof(Budget));
+    }
+    Counters.BudgetUj = Budget.UjPerHour;
+    Counters.BudgetRefreshes = Budget.RefreshesPerHour;
+    RefillUj = 0;
+    RefillRefreshes = 0;
+}
+
+/******************************************************************************
+function    : Expected cost of one refresh with the current model
+parameter   :
+       Kind  :   EPD_ENERGY_FULL / PART / FAST
+return      : Energy in uJ
+******************************************************************************/
+uint32_t EPD_Energy_Estimate_Uj(uint8_t Kind) {
+    const EPD_ENERGY_MODEL *M = EPD_Energy_Model();
+
+    if (Kind >= EPD_ENERGY_KINDS) {
+        Kind = EPD_ENERGY_FULL;
+    }
+    return M->RefreshUj[Kind] + (uint32_t)((uint64_t)M->TypicalBytes[Kind] * M->SpiNjPerByte / 1000u) +
+           (uint32_t)((uint64_t)M->TypicalBusyMs[Kind] * M->BusyUw / 1000u);
+}
+
+/******************************************************************************
+function    : Marks the content of a display as changed. Changes submitted while 
+              an update is pending join it.
+parameter   :
+       fd     :   SPI fd of the display
+       Urgent :   1 to show it on the next EPD_Energy_Due, over the budget if needed
+return      : NONE
+******************************************************************************/
+void EPD_Energy_Submit(int fd, uint8_t Urgent) {
+    int index = EPD_Device_Index(fd);
+
+    if (index < 0) {
+        Log_Debug("ERROR : EPD_Energy_Submit : Display %d was not opened\n", fd);
+        return;
+    }
+    EPD_ENERGY_DISPLAY *D = &Displays[index];
+    Counters.Submitted++;
+    if (D->Pending) {
+        Counters.Coalesced++;
+    } else {
+        D->Pending = 1;
+        D->DeferCounted = 0;
+        D->PendingSinceMs = EPD_Energy_Now_Ms();
+    }
+    D->PendingUrgent |= Urgent ? 1 : 0;
+}
+
+/******************************************************************************
+function    : Decides if the pending update of a display is shown now. Call it 
+              from the main loop; when it returns 1 render and refresh.
+parameter   :
+       fd    :   SPI fd of the display
+       Kind  :   Refresh it would be, EPD_ENERGY_xxx (EPD_Update_Kind_2in9)
+return      : 1 to refresh now, 0 to wait
+******************************************************************************/
+int EPD_Energy_Due(int fd, uint8_t Kind) {
+    int index = EPD_Device_Index(fd);
+    uint64_t now = EPD_Energy_Update();
+    int fits;
+
+    // Nothing was submitted for a display that was not opened
+    if (index < 0 || !Displays[index].Pending) {
+        return 0;
+    }
+    EPD_ENERGY_DISPLAY *D = &Displays[index];
+    fits = (Budget.UjPerHour == 0 || Counters.BudgetUj >= (int64_t)EPD_Energy_Estimate_Uj(Kind)) &&
+           (Budget.RefreshesPerHour == 0 || Counters.BudgetRefreshes >= 1);
+
+    if (!D->PendingUrgent) {
+        if (now - D->PendingSinceMs < Budget.CoalesceMs) {
+            return 0;
+        }
+        if (!fits) {
+            if (!D->DeferCounted) {
+                Counters.Deferred++;
+                D->DeferCounted = 1;
+            }
+            return 0;
+        }
+    } else if (!fits) {
+        Counters.Urgent++;
+    }
+
+    D->Pending = 0;
+    D->PendingUrgent = 0;
+    return 1;
+}
+
+/******************************************************************************
+function    : Copies the estimate and scheduler counters, brought up to now
+******************************************************************************/
+void EPD_Energy_Get_Counters(EPD_ENERGY_COUNTERS *Out) {
+    EPD_Energy_Update();
+    *Out = Counters;
+}
+
+/******************************************************************************
+function    : Logs the counters
+parameter   : NONE
+return      : NONE
+******************************************************************************/
+void EPD_Energy_Dump(void) {
+    EPD_ENERGY_COUNTERS c;
+
+    EPD_Energy_Get_Counters(&c);
+    Log_Debug("EPD energy : %lu uJ, refreshes full %lu partial %lu fast %lu\n", (unsigned long)c.TotalUj,
+              (unsigned long)c.Refreshes[EPD_ENERGY_FULL], (unsigned long)c.Refreshes[EPD_ENERGY_PART],
+              (unsigned long)c.Refreshes[EPD_ENERGY_FAST]);
+    Log_Debug("  refresh %lu uJ, SPI %lu uJ (%lu bytes), BUSY %lu uJ (%lu ms)\n", (unsigned long)c.RefreshUj,
+              (unsigned long)c.SpiUj, (unsigned long)c.SpiBytes, (unsigned long)c.BusyUj, (unsigned long)(c.BusyUs / 1000u));
+    Log_Debug("  awake %lu uJ (%lu s), sleep %lu uJ (%lu s)\n", (unsigned long)c.AwakeUj, (unsigned long)(c.AwakeMs / 1000u),
+              (unsigned long)c.SleepUj, (unsigned long)(c.SleepMs / 1000u));
+    Log_Debug("  budget left %ld uJ / %ld refreshes; submitted %lu, coalesced %lu, deferred %lu, urgent %lu\n",
+              (long)c.BudgetUj, (long)c.BudgetRefreshes, (unsigned long)c.Submitted, (unsigned long)c.Coalesced,
+              (unsigned long)c.Deferred, (unsigned long)c.Urgent);
+}
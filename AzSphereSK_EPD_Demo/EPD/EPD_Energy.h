@@ -0,0 +1,97 @@
+/*****************************************************************************
+* | File      	:  	EPD_Energy.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Energy accounting of the EPD displays and a budget aware refresh scheduler
+* | Info        :   Model coefficients are starting points, measure your board and panel and set your own.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Energy estimate from refreshes per LUT type, SPI bytes, BUSY time and time awake / asleep
+* 2. Added : Budget per hour for energy and refresh count, non-urgent updates are deferred and coalesced
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_ENERGY_H
+#define EPD_ENERGY_H
+
+#include <stdint.h>
+
+// Refresh kinds, by the flags of the waveform used
+#define EPD_ENERGY_FULL		0
+#define EPD_ENERGY_PART		1
+#define EPD_ENERGY_FAST		2
+#define EPD_ENERGY_KINDS	3
+
+// What one thing costs. Defaults are for a 2.9" IL3820 module at 3.3 V and SPI at 400 kHz.
+typedef struct {
+    uint32_t RefreshUj[EPD_ENERGY_KINDS];	// Fixed cost of a refresh (booster and source start up)
+    uint32_t BusyUw;		// Display power while the waveform runs
+    uint32_t AwakeUw;		// Display power while awake and idle
+    uint32_t SleepUw;		// Display power in deep sleep
+    uint32_t SpiNjPerByte;	// Display and CPU energy per SPI byte
+    uint32_t TypicalBusyMs[EPD_ENERGY_KINDS];	// Used to estimate a refresh before it runs
+    uint32_t TypicalBytes[EPD_ENERGY_KINDS];
+} EPD_ENERGY_MODEL;
+
+// Budget of the scheduler, 0 for no limit
+typedef struct {
+    uint32_t UjPerHour;		// Modelled energy per hour
+    uint16_t RefreshesPerHour;
+    uint32_t CoalesceMs;	// A non-urgent update waits this long for more changes to join it
+} EPD_ENERGY_BUDGET;
+
+// Estimate so far, all displays
+typedef struct {
+    uint32_t Refreshes[EPD_ENERGY_KINDS];
+    uint64_t SpiBytes;
+    uint64_t BusyUs;
+    uint64_t AwakeMs;
+    uint64_t SleepMs;
+    uint64_t RefreshUj;		// Energy by source
+    uint64_t SpiUj;
+    uint64_t BusyUj;
+    uint64_t AwakeUj;
+    uint64_t SleepUj;
+    uint64_t TotalUj;
+    int64_t BudgetUj;		// Energy left in the budget, negative after urgent updates
+    int32_t BudgetRefreshes;	// Refreshes left in the budget
+    uint32_t Submitted;		// EPD_Energy_Submit calls
+    uint32_t Coalesced;		// Of them, joined a pending update
+    uint32_t Deferred;		// Pending updates held back by the budget
+    uint32_t Urgent;		// Updates let through over the budget
+} EPD_ENERGY_COUNTERS;
+
+// Driver side, called by IL3820_2in9_Driver.c
+void EPD_Energy_Refresh(int fd, uint8_t Kind, uint32_t Bytes, uint32_t BusyUs);	// A refresh is done
+void EPD_Energy_Power(int fd, uint8_t State);	// Display changed to EPD_POWER_xxx
+
+// Application side
+void EPD_Energy_Set_Model(const EPD_ENERGY_MODEL *NewModel);	// NULL for the defaults
+void EPD_Energy_Set_Budget(const EPD_ENERGY_BUDGET *NewBudget);	// Starts with a full hour of budget
+void EPD_Energy_Submit(int fd, uint8_t Urgent);	// Content of the display changed
+int EPD_Energy_Due(int fd, uint8_t Kind);	// 1 if the pending update should be shown now
+uint32_t EPD_Energy_Estimate_Uj(uint8_t Kind);	// Expected cost of one refresh
+void EPD_Energy_Get_Counters(EPD_ENERGY_COUNTERS *Counters);
+void EPD_Energy_Dump(void);		// Counters through Log_Debug
+
+#endif
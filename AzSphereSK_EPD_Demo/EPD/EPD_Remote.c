@@ -0,0 +1,325 @@
+/*****************************************************************************
+* | File      	:  	EPD_Remote.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   High Level side of the Real Time core EPD engine, sends frames and rectangles
+*                   and waits for their completion
+* | Info        :   The Real Time core owns SPI, reset and BUSY (RealTimeCore/epd_engine.c), this app
+*                   only renders. Messages are in Common/epd_remote.h.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Reset, command sequence, RAM rectangle / frame upload, completion wait
+* 2. Added : Pluggable link, the inter-core socket on the device or shared memory in Tools/EpdSim
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+// Global Includes 
+#include <errno.h>
+#include <string.h>
+
+#ifndef EPD_REMOTE_HOST
+#include "../HighLevelCore/applibs_versions.h"
+
+#include <sys/socket.h>
+#include <applibs/application.h>
+#include <applibs/log.h>
+#else
+int Log_Debug(const char *fmt, ...);
+#endif
+
+#include "EPD_Remote.h"
+
+// Panel memory, same as the IL3820 driver
+#define EPD_REMOTE_WIDTH_BYTE	16
+#define EPD_REMOTE_HEIGHT		296
+#define EPD_REMOTE_LUT_SIZE		30
+
+typedef enum {
+    ExitCode_Success = 0,
+
+    ExitCode_Remote_Connect = 1,
+    ExitCode_Remote_Send = 2,
+    ExitCode_Remote_Recv = 3,
+    ExitCode_Remote_Size = 4,
+    ExitCode_Remote_Status = 5
+}ExitCode;
+
+#ifndef EPD_REMOTE_HOST
+/******************************************************************************
+function    : Inter-core socket link, one send / recv per message
+******************************************************************************/
+static int EPD_Remote_Sock_Send(void *Ctx, const void *Msg, uint32_t Len) {
+    int fd = *(int *)Ctx;
+    return (send(fd, Msg, Len, 0) == (ssize_t)Len) ? 0 : -1;
+}
+
+static int EPD_Remote_Sock_Recv(void *Ctx, void *Msg, uint32_t Max) {
+    int fd = *(int *)Ctx;
+    return (int)recv(fd, Msg, Max, 0);
+}
+
+/******************************************************************************
+function    : Connects to the Real Time app, its component id must be in the
+              AllowedApplicationConnections of both manifests
+parameter   :
+       Remote      :   Client state
+       ComponentId :   Component id of the Real Time app, EPD_RT_COMPONENT_ID
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Open(EPD_REMOTE *Remote, const char *ComponentId) {
+    memset(Remote, 0, sizeof(*Remote));
+    Remote->Sock = Application_Connect(ComponentId);
+    if (Remote->Sock < 0) {
+        Log_Debug("ERROR : EPD_Remote_Open : Application_Connect %s (%d)\n", strerror(errno), errno);
+        return ExitCode_Remote_Connect;
+    }
+    Remote->Link.Send = EPD_Remote_Sock_Send;
+    Remote->Link.Recv = EPD_Remote_Sock_Recv;
+    Remote->Link.Ctx = &Remote->Sock;
+    return ExitCode_Success;
+}
+#endif
+
+/******************************************************************************
+function    : Uses a custom link instead of the inter-core socket
+******************************************************************************/
+void EPD_Remote_Attach(EPD_REMOTE *Remote, const EPD_REMOTE_LINK *Link) {
+    memset(Remote, 0, sizeof(*Remote));
+    Remote->Sock = -1;
+    Remote->Link = *Link;
+}
+
+/******************************************************************************
+function    : Sends the message in Remote->Buf with a new Seq
+******************************************************************************/
+static int EPD_Remote_Send(EPD_REMOTE *Remote, uint8_t Type, uint8_t Ack) {
+    EPD_RMT_MSG *hdr = (EPD_RMT_MSG *)Remote->Buf;
+
+    hdr->Type = Type;
+    hdr->Flags = Ack ? EPD_RMT_FLAG_ACK : 0;
+    hdr->Seq = ++Remote->Seq;
+    if (Remote->Link.Send(Remote->Link.Ctx, Remote->Buf, sizeof(*hdr) + hdr->Len) != 0) {
+        Log_Debug("ERROR : EPD_Remote_Send : Message %d not sent\n", Type);
+        return ExitCode_Remote_Send;
+    }
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Hardware reset of the display, the engine waits for BUSY after it
+parameter   :
+       Remote :   Client state
+       Ack    :   1 to get a completion, Remote->Seq is the Seq to wait for
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Reset(EPD_REMOTE *Remote, uint8_t Ack) {
+    memset(Remote->Buf, 0, sizeof(EPD_RMT_MSG));
+    return EPD_Remote_Send(Remote, EPD_RMT_RESET, Ack);
+}
+
+/******************************************************************************
+function    : Runs a command sequence table (EPD_SEQ_xxx) on the engine
+parameter   :
+       Remote :   Client state
+       Seq    :   Sequence table ending with EPD_SEQ_END
+       Ack    :   1 to get a completion once BUSY dropped after the last command
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Sequence(EPD_REMOTE *Remote, const uint8_t *Seq, uint8_t Ack) {
+    EPD_RMT_MSG *hdr = (EPD_RMT_MSG *)Remote->Buf;
+    uint32_t len = 0;
+
+    // Table length, the end marker included
+    while (!(Seq[len] == EPD_SEQ_END_CMD && Seq[len + 1] == EPD_SEQ_END_FLAGS)) {
+        len += 2 + (Seq[len + 1] & EPD_SEQ_LEN) + ((Seq[len + 1] & EPD_SEQ_DELAY) ? 1 : 0);
+    }
+    len += 2;
+    if (len > EPD_RMT_MAX_PAYLOAD) {
+        Log_Debug("ERROR : EPD_Remote_Sequence : Table of %d bytes too long\n", len);
+        return ExitCode_Remote_Size;
+    }
+
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->Len = (uint16_t)len;
+    memcpy(&Remote->Buf[sizeof(*hdr)], Seq, len);
+    return EPD_Remote_Send(Remote, EPD_RMT_SEQ, Ack);
+}
+
+/******************************************************************************
+function    : Sends one command with its parameters
+parameter   :
+       Remote :   Client state
+       Cmd    :   IL3820 command
+       Data   :   Parameters
+       Len    :   Parameter count, up to EPD_SEQ_LEN
+       Ack    :   1 to get a completion
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Command(EPD_REMOTE *Remote, uint8_t Cmd, const uint8_t *Data, uint8_t Len, uint8_t Ack) {
+    uint8_t seq[2 + EPD_SEQ_LEN + 2];
+
+    if (Len > EPD_SEQ_LEN) {
+        Log_Debug("ERROR : EPD_Remote_Command : %d parameters\n", Len);
+        return ExitCode_Remote_Size;
+    }
+    seq[0] = Cmd;
+    seq[1] = Len;
+    memcpy(&seq[2], Data, Len);
+    seq[2 + Len] = 0xFF;
+    seq[3 + Len] = 0xFF;
+    return EPD_Remote_Sequence(Remote, seq, Ack);
+}
+
+/******************************************************************************
+function    : Resets and initialiazes the display, acked
+parameter   :
+       Remote  :   Client state
+       InitSeq :   Register setup, EPD_Sequence_2in9(EPD_SEQUENCE_INIT)
+       Lut     :   EPD_REMOTE_LUT_SIZE bytes of WRITE_LUT_REGISTER
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Init(EPD_REMOTE *Remote, const uint8_t *InitSeq, const uint8_t *Lut) {
+    int ret;
+
+    ret = EPD_Remote_Reset(Remote, 0);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Remote_Sequence(Remote, InitSeq, 0);
+    }
+    if (ret == ExitCode_Success) {
+        ret = EPD_Remote_Command(Remote, 0x32, Lut, EPD_REMOTE_LUT_SIZE, 1);	// WRITE_LUT_REGISTER
+    }
+    return ret;
+}
+
+/******************************************************************************
+function    : Writes a rectangle of panel RAM, in pieces that fit a message
+parameter   :
+       Remote    :   Client state
+       Xbyte     :   Position in the panel RAM, X in bytes (8 pixel steps)
+       Ystart    :   Position in the panel RAM, Y in rows
+       WidthByte :   Rectangle width in bytes
+       Height    :   Rectangle height in rows
+       Image     :   First byte of the rectangle
+       Stride    :   Bytes per row of Image
+       Ack       :   1 to get a completion after the last piece
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Rect(EPD_REMOTE *Remote, uint16_t Xbyte, uint16_t Ystart, uint16_t WidthByte, uint16_t Height, 
+                    const uint8_t *Image, uint16_t Stride, uint8_t Ack) {
+    EPD_RMT_MSG *hdr = (EPD_RMT_MSG *)Remote->Buf;
+    uint32_t total = (uint32_t)WidthByte * Height;
+    uint32_t offset = 0;
+    int ret;
+
+    if (total == 0 || Xbyte + WidthByte > EPD_REMOTE_WIDTH_BYTE || Ystart + Height > EPD_REMOTE_HEIGHT) {
+        Log_Debug("ERROR : EPD_Remote_Rect : Rectangle out of the panel\n");
+        return ExitCode_Remote_Size;
+    }
+
+    while (offset < total) {
+        uint32_t len = total - offset;
+        uint8_t *out = &Remote->Buf[sizeof(*hdr)];
+        uint32_t i;
+
+        if (len > EPD_RMT_MAX_PAYLOAD) {
+            len = EPD_RMT_MAX_PAYLOAD;
+        }
+        for (i = 0; i < len; i++) {
+            uint32_t pos = offset + i;
+            out[i] = Image[(pos / WidthByte) * Stride + pos % WidthByte];
+        }
+
+        hdr->Xbyte = Xbyte;
+        hdr->Ystart = Ystart;
+        hdr->WidthByte = WidthByte;
+        hdr->Height = Height;
+        hdr->Offset = (uint16_t)offset;
+        hdr->Len = (uint16_t)len;
+        offset += len;
+
+        ret = EPD_Remote_Send(Remote, EPD_RMT_RECT, Ack && offset == total);
+        if (ret != ExitCode_Success) {
+            return ret;
+        }
+    }
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Uploads a full frame and shows it. Returns once the messages are 
+              queued, wait for Remote->Seq to know the update is done.
+parameter   :
+       Remote    :   Client state
+       Image     :   Frame in the panel memory layout
+       TurnOnSeq :   EPD_Sequence_2in9(EPD_SEQUENCE_TURN_ON)
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Remote_Frame(EPD_REMOTE *Remote, const uint8_t *Image, const uint8_t *TurnOnSeq) {
+    int ret;
+
+    ret = EPD_Remote_Rect(Remote, 0, 0, EPD_REMOTE_WIDTH_BYTE, EPD_REMOTE_HEIGHT, Image, EPD_REMOTE_WIDTH_BYTE, 0);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Remote_Sequence(Remote, TurnOnSeq, 1);
+    }
+    return ret;
+}
+
+/******************************************************************************
+function    : Waits for the completion of a message. Errors of other messages 
+              received meanwhile are logged.
+parameter   :
+       Remote :   Client state
+       Seq    :   Seq of an acked message, Remote->Seq after sending it
+return      : Success Signal / Error Code, ExitCode_Remote_Status if the engine 
+              reported an error (Remote->LastStatus)
+******************************************************************************/
+int EPD_Remote_Wait(EPD_REMOTE *Remote, uint16_t Seq) {
+    const EPD_RMT_MSG *hdr = (const EPD_RMT_MSG *)Remote->Buf;
+
+    // Already seen, or not sent yet
+    if ((int16_t)(Remote->LastDone - Seq) >= 0 || (int16_t)(Remote->Seq - Seq) < 0) {
+        return (Remote->LastDone == Seq && Remote->LastStatus != EPD_RMT_OK) ? ExitCode_Remote_Status : ExitCode_Success;
+    }
+
+    for (;;) {
+        int len = Remote->Link.Recv(Remote->Link.Ctx, Remote->Buf, sizeof(Remote->Buf));
+        if (len < 0) {
+            Log_Debug("ERROR : EPD_Remote_Wait : recv %s (%d)\n", strerror(errno), errno);
+            return ExitCode_Remote_Recv;
+        }
+        if ((uint32_t)len < sizeof(*hdr) + sizeof(EPD_RMT_DONE_INFO) || hdr->Type != EPD_RMT_DONE) {
+            continue;
+        }
+
+        Remote->LastDone = hdr->Seq;
+        Remote->LastStatus = hdr->Flags;
+        memcpy(&Remote->LastInfo, &Remote->Buf[sizeof(*hdr)], sizeof(Remote->LastInfo));
+        if (hdr->Flags != EPD_RMT_OK) {
+            Log_Debug("ERROR : EPD_Remote_Wait : Message %d failed with %d\n", hdr->Seq, hdr->Flags);
+        }
+        // Completions come in order, a later Seq means Seq itself was not acked
+        if ((int16_t)(hdr->Seq - Seq) >= 0) {
+            return (hdr->Seq == Seq && hdr->Flags != EPD_RMT_OK) ? ExitCode_Remote_Status : ExitCode_Success;
+        }
+    }
+}
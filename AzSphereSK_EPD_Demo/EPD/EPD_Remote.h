@@ -0,0 +1,75 @@
+/*****************************************************************************
+* | File      	:  	EPD_Remote.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   High Level side of the Real Time core EPD engine, sends frames and rectangles
+*                   and waits for their completion
+* | Info        :   The Real Time core owns SPI, reset and BUSY (RealTimeCore/epd_engine.c), this app
+*                   only renders. Messages are in Common/epd_remote.h.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Reset, command sequence, RAM rectangle / frame upload, completion wait
+* 2. Added : Pluggable link, the inter-core socket on the device or shared memory in Tools/EpdSim
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_REMOTE_CLIENT_H
+#define EPD_REMOTE_CLIENT_H
+
+#include <stdint.h>
+
+#include "../Common/epd_remote.h"
+
+// Component id of RealTimeCore/app_manifest.json
+#define EPD_RT_COMPONENT_ID "98e512c6-f46f-4548-8501-a0fdaec9cd8a"
+
+// How messages get to the engine and back
+typedef struct {
+    int (*Send)(void *Ctx, const void *Msg, uint32_t Len);	// 0 on Success, waits for room
+    int (*Recv)(void *Ctx, void *Msg, uint32_t Max);		// Message length, waits for a message
+    void *Ctx;
+} EPD_REMOTE_LINK;
+
+typedef struct {
+    EPD_REMOTE_LINK Link;
+    int Sock;					// Inter-core socket of EPD_Remote_Open, -1 with an attached link
+    uint16_t Seq;				// Seq of the last message sent
+    uint16_t LastDone;			// Seq of the last completion received
+    uint8_t LastStatus;			// EPD_RMT_OK / EPD_RMT_ERR_xxx of it
+    EPD_RMT_DONE_INFO LastInfo;
+    uint8_t Buf[EPD_RMT_MAX_MSG];
+} EPD_REMOTE;
+
+// User Functions
+int EPD_Remote_Open(EPD_REMOTE *Remote, const char *ComponentId);	// Connects to the Real Time app
+void EPD_Remote_Attach(EPD_REMOTE *Remote, const EPD_REMOTE_LINK *Link);	// Or uses a custom link
+int EPD_Remote_Reset(EPD_REMOTE *Remote, uint8_t Ack);		// Hardware reset of the display
+int EPD_Remote_Sequence(EPD_REMOTE *Remote, const uint8_t *Seq, uint8_t Ack);	// Runs a command sequence table
+int EPD_Remote_Command(EPD_REMOTE *Remote, uint8_t Cmd, const uint8_t *Data, uint8_t Len, uint8_t Ack);	// One command
+int EPD_Remote_Init(EPD_REMOTE *Remote, const uint8_t *InitSeq, const uint8_t *Lut);	// Reset, init sequence and LUT
+int EPD_Remote_Rect(EPD_REMOTE *Remote, uint16_t Xbyte, uint16_t Ystart, uint16_t WidthByte, uint16_t Height, 
+                    const uint8_t *Image, uint16_t Stride, uint8_t Ack);	// Writes a RAM rectangle
+int EPD_Remote_Frame(EPD_REMOTE *Remote, const uint8_t *Image, const uint8_t *TurnOnSeq);	// Full frame and update, acked
+int EPD_Remote_Wait(EPD_REMOTE *Remote, uint16_t Seq);		// Waits for the completion of Seq
+
+#endif
@@ -0,0 +1,337 @@
+/*****************************************************************************
+* | File      	:  	EPD_Telemetry.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Per refresh telemetry of the EPD driver : phase timing, SPI / GPIO counters,
+*                   latency histograms and frame reports
+* | Info        :   Fixed size, no allocation. The driver feeds it, the application queries or dumps it.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Window, RAM upload, LUT, turn on, BUSY, sleep and wake timing in log2 histograms
+* 2. Added : Bytes, transfers and GPIO toggles per refresh, frame reports tagged full / partial
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+// Global Includes 
+#include <string.h>
+#include <time.h>
+
+#include "../HighLevelCore/applibs_versions.h"
+
+#include <applibs/log.h>
+
+#include "AzSphere_Interface.h"
+#include "EPD_Telemetry.h"
+
+typedef enum {
+    ExitCode_Success = 0,
+
+    ExitCode_Telemetry_NoReport = 1
+}ExitCode;
+
+// Refresh being collected for one display
+typedef struct {
+    uint8_t Active;			// Something was counted since the last refresh
+    uint32_t FirstUs;
+    uint16_t Xstart, Ystart, Xend, Yend;	// Bounding box of the uploads, end exclusive
+    EPD_TEL_REPORT Report;
+} EPD_TEL_FRAME;
+
+static const char *const PhaseNames[EPD_TEL_PHASES] = {
+    "Window", "Upload", "LUT", "Turn on", "BUSY", "Sleep", "Wake"
+};
+
+static EPD_TEL_FRAME Frames[EPD_MAX_DEVICES];
+static EPD_TEL_HIST PhaseHist[EPD_TEL_PHASES];
+static EPD_TEL_HIST FrameHist[2];
+static EPD_TEL_HIST BytesHist[2];
+static EPD_TEL_REPORT Reports[EPD_TEL_REPORTS];
+static uint32_t ReportCount;	// Reports filed so far, also the next Frame number
+
+/******************************************************************************
+function    : Adds a value to a histogram
+******************************************************************************/
+static void EPD_Telemetry_Hist_Add(EPD_TEL_HIST *Hist, uint8_t Shift, uint32_t Value) {
+    uint32_t v = Value >> Shift;
+    uint8_t bucket = 0;
+
+    while (v != 0 && bucket < EPD_TEL_BUCKETS - 1) {
+        v >>= 1;
+        bucket++;
+    }
+
+    if (Hist->Count == 0 || Value < Hist->Min) {
+        Hist->Min = Value;
+    }
+    if (Value > Hist->Max) {
+        Hist->Max = Value;
+    }
+    Hist->Shift = Shift;
+    Hist->Count++;
+    Hist->Sum += Value;
+    Hist->Bucket[bucket]++;
+}
+
+/******************************************************************************
+function    : Refresh being collected for a display, started on its first use
+return      : Frame, NULL for a display that was not opened
+******************************************************************************/
+static EPD_TEL_FRAME *EPD_Telemetry_Frame(int fd) {
+    int index = EPD_Device_Index(fd);
+
+    if (index < 0) {
+        return NULL;
+    }
+    EPD_TEL_FRAME *F = &Frames[index];
+    if (!F->Active) {
+        memset(F, 0, sizeof(*F));
+        F->Active = 1;
+        F->FirstUs = EPD_Telemetry_Now_Us();
+        F->Report.Fd = fd;
+    }
+    return F;
+}
+
+/******************************************************************************
+function    : Monotonic time in us, only differences of it are used
+******************************************************************************/
+uint32_t EPD_Telemetry_Now_Us(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u);
+}
+
+/******************************************************************************
+function    : Ends a phase, adds its time to the refresh of the display and to 
+              the phase histogram
+parameter   :
+       fd      :   SPI fd of the display
+       Phase   :   EPD_TEL_xxx
+       StartUs :   EPD_Telemetry_Now_Us at the start of the phase
+return      : Time of the phase in us
+******************************************************************************/
+uint32_t EPD_Telemetry_Phase(int fd, uint8_t Phase, uint32_t StartUs) {
+    EPD_TEL_FRAME *F = EPD_Telemetry_Frame(fd);
+    uint32_t us = EPD_Telemetry_Now_Us() - StartUs;
+
+    if (F == NULL || Phase >= EPD_TEL_PHASES) {
+        return us;
+    }
+    F->Report.PhaseUs[Phase] += us;
+    EPD_Telemetry_Hist_Add(&PhaseHist[Phase], EPD_TEL_US_SHIFT, us);
+    return us;
+}
+
+/******************************************************************************
+function    : Counts one SPI transaction of a display
+******************************************************************************/
+void EPD_Telemetry_Spi(int fd, uint32_t Bytes) {
+    EPD_TEL_FRAME *F = EPD_Telemetry_Frame(fd);
+
+    if (F != NULL) {
+        F->Report.Bytes += Bytes;
+        F->Report.Transfers++;
+    }
+}
+
+/******************************************************************************
+function    : Counts one output pin write of a display
+******************************************************************************/
+void EPD_Telemetry_Gpio(int fd) {
+    EPD_TEL_FRAME *F = EPD_Telemetry_Frame(fd);
+
+    if (F != NULL) {
+        F->Report.GpioToggles++;
+    }
+}
+
+/******************************************************************************
+function    : Grows the upload rectangle of the refresh by a RAM window
+******************************************************************************/
+void EPD_Telemetry_Rect(int fd, uint16_t Xbyte, uint16_t Ystart, uint16_t WidthByte, uint16_t Height) {
+    EPD_TEL_FRAME *F = EPD_Telemetry_Frame(fd);
+
+    if (F == NULL) {
+        return;
+    }
+    if (F->Xend == 0 || Xbyte < F->Xstart) {
+        F->Xstart = Xbyte;
+    }
+    if (F->Yend == 0 || Ystart < F->Ystart) {
+        F->Ystart = Ystart;
+    }
+    if (Xbyte + WidthByte > F->Xend) {
+        F->Xend = Xbyte + WidthByte;
+    }
+    if (Ystart + Height > F->Yend) {
+        F->Yend = Ystart + Height;
+    }
+}
+
+/******************************************************************************
+function    : Ends the refresh of a display once BUSY dropped and files its report
+parameter   :
+       fd   :   SPI fd of the display
+       Full :   1 if it was a full refresh
+return      : NONE
+******************************************************************************/
+void EPD_Telemetry_Frame_End(int fd, uint8_t Full) {
+    EPD_TEL_FRAME *F = EPD_Telemetry_Frame(fd);
+
+    if (F == NULL) {
+        return;
+    }
+    EPD_TEL_REPORT *R = &F->Report;
+    R->Frame = ReportCount;
+    R->Full = Full ? 1 : 0;
+    R->Xbyte = F->Xstart;
+    R->Ystart = F->Ystart;
+    R->WidthByte = F->Xend - F->Xstart;
+    R->Height = F->Yend - F->Ystart;
+    R->TotalUs = EPD_Telemetry_Now_Us() - F->FirstUs;
+
+    EPD_Telemetry_Hist_Add(&FrameHist[R->Full], EPD_TEL_US_SHIFT, R->TotalUs);
+    EPD_Telemetry_Hist_Add(&BytesHist[R->Full], EPD_TEL_BYTES_SHIFT, R->Bytes);
+    Reports[ReportCount % EPD_TEL_REPORTS] = *R;
+    ReportCount++;
+
+    F->Active = 0;
+}
+
+/******************************************************************************
+function    : Histograms, valid till EPD_Telemetry_Reset
+******************************************************************************/
+const EPD_TEL_HIST *EPD_Telemetry_Phase_Hist(uint8_t Phase) {
+    return (Phase < EPD_TEL_PHASES) ? &PhaseHist[Phase] : NULL;
+}
+
+const EPD_TEL_HIST *EPD_Telemetry_Frame_Hist(uint8_t Full) {
+    return &FrameHist[Full ? 1 : 0];
+}
+
+const EPD_TEL_HIST *EPD_Telemetry_Bytes_Hist(uint8_t Full) {
+    return &BytesHist[Full ? 1 : 0];
+}
+
+/******************************************************************************
+function    : Estimates a percentile from the buckets
+parameter   :
+       Hist :   Histogram
+       Pct  :   0 .. 100
+return      : Upper bound of the bucket the percentile falls in (Max for the 
+              last one), 0 for an empty histogram
+******************************************************************************/
+uint32_t EPD_Telemetry_Percentile(const EPD_TEL_HIST *Hist, uint8_t Pct) {
+    uint64_t rank;
+    uint64_t seen = 0;
+
+    if (Hist == NULL || Hist->Count == 0) {
+        return 0;
+    }
+    rank = ((uint64_t)Hist->Count * (Pct > 100 ? 100 : Pct) + 99) / 100;
+    if (rank == 0) {
+        return Hist->Min;
+    }
+
+    for (uint8_t i = 0; i < EPD_TEL_BUCKETS - 1; i++) {
+        seen += Hist->Bucket[i];
+        if (seen >= rank) {
+            uint32_t upper = ((uint32_t)1 << (Hist->Shift + i)) - 1;
+            return (upper < Hist->Max) ? upper : Hist->Max;
+        }
+    }
+    return Hist->Max;
+}
+
+/******************************************************************************
+function    : Copies a frame report
+parameter   :
+       Back   :   0 for the last refresh, 1 for the one before, ...
+       Report :   Output
+return      : Success Signal / Error Code if that refresh is not kept
+******************************************************************************/
+int EPD_Telemetry_Report(uint8_t Back, EPD_TEL_REPORT *Report) {
+    if (Back >= EPD_TEL_REPORTS || Back >= ReportCount) {
+        return ExitCode_Telemetry_NoReport;
+    }
+    *Report = Reports[(ReportCount - 1 - Back) % EPD_TEL_REPORTS];
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Logs one histogram line
+******************************************************************************/
+static void EPD_Telemetry_Dump_Hist(const char *Name, const EPD_TEL_HIST *Hist) {
+    if (Hist->Count == 0) {
+        return;
+    }
+    Log_Debug("  %-12s %6lu %9lu %9lu %9lu %9lu %9lu\n", Name, (unsigned long)Hist->Count,
+              (unsigned long)Hist->Min, (unsigned long)EPD_Telemetry_Percentile(Hist, 50),
+              (unsigned long)EPD_Telemetry_Percentile(Hist, 90), (unsigned long)Hist->Max,
+              (unsigned long)(Hist->Sum / Hist->Count));
+}
+
+/******************************************************************************
+function    : Logs the histograms and the last frame report
+parameter   : NONE
+return      : NONE
+******************************************************************************/
+void EPD_Telemetry_Dump(void) {
+    EPD_TEL_REPORT r;
+
+    Log_Debug("EPD telemetry (us)    count       min      ~p50      ~p90       max       avg\n");
+    for (uint8_t i = 0; i < EPD_TEL_PHASES; i++) {
+        EPD_Telemetry_Dump_Hist(PhaseNames[i], &PhaseHist[i]);
+    }
+    EPD_Telemetry_Dump_Hist("Full frame", &FrameHist[1]);
+    EPD_Telemetry_Dump_Hist("Part frame", &FrameHist[0]);
+    Log_Debug("EPD telemetry (bytes)\n");
+    EPD_Telemetry_Dump_Hist("Full frame", &BytesHist[1]);
+    EPD_Telemetry_Dump_Hist("Part frame", &BytesHist[0]);
+
+    if (EPD_Telemetry_Report(0, &r) == ExitCode_Success) {
+        Log_Debug("Last frame %lu (fd %d) : %s, rect %d,%d %dx%d bytes x rows, %lu us\n", (unsigned long)r.Frame, r.Fd,
+                  r.Full ? "full" : "partial", r.Xbyte, r.Ystart, r.WidthByte, r.Height, (unsigned long)r.TotalUs);
+        for (uint8_t i = 0; i < EPD_TEL_PHASES; i++) {
+            if (r.PhaseUs[i] != 0) {
+                Log_Debug("  %-12s %9lu\n", PhaseNames[i], (unsigned long)r.PhaseUs[i]);
+            }
+        }
+        Log_Debug("  %lu bytes in %lu transfers, %lu GPIO toggles\n", (unsigned long)r.Bytes,
+                  (unsigned long)r.Transfers, (unsigned long)r.GpioToggles);
+    }
+}
+
+/******************************************************************************
+function    : Clears the histograms, reports and the refreshes being collected
+parameter   : NONE
+return      : NONE
+******************************************************************************/
+void EPD_Telemetry_Reset(void) {
+    memset(Frames, 0, sizeof(Frames));
+    memset(PhaseHist, 0, sizeof(PhaseHist));
+    memset(FrameHist, 0, sizeof(FrameHist));
+    memset(BytesHist, 0, sizeof(BytesHist));
+    ReportCount = 0;
+}
@@ -0,0 +1,103 @@
+/*****************************************************************************
+* | File      	:  	EPD_Telemetry.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Per refresh telemetry of the EPD driver : phase timing, SPI / GPIO counters,
+*                   latency histograms and frame reports
+* | Info        :   Fixed size, no allocation. The driver feeds it, the application queries or dumps it.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Window, RAM upload, LUT, turn on, BUSY, sleep and wake timing in log2 histograms
+* 2. Added : Bytes, transfers and GPIO toggles per refresh, frame reports tagged full / partial
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_TELEMETRY_H
+#define EPD_TELEMETRY_H
+
+#include <stdint.h>
+
+// Timed phases
+#define EPD_TEL_WINDOW		0	// RAM window, address counters and WRITE_RAM command
+#define EPD_TEL_UPLOAD		1	// RAM rows, filling the chunks included
+#define EPD_TEL_LUT			2	// WRITE_LUT_REGISTER
+#define EPD_TEL_TURN_ON		3	// DISPLAY_UPDATE_CONTROL_2 / MASTER_ACTIVATION sequence
+#define EPD_TEL_BUSY		4	// Waveform, from MASTER_ACTIVATION till BUSY drops
+#define EPD_TEL_SLEEP		5	// DEEP_SLEEP_MODE sequence
+#define EPD_TEL_WAKE		6	// Reset, BUSY and init after deep sleep, its LUT load included
+#define EPD_TEL_PHASES		7
+
+// Histogram buckets are powers of two : bucket 0 holds values below 1 << Shift, 
+// bucket i values from 1 << (Shift + i - 1), the last one everything above
+#define EPD_TEL_BUCKETS		20
+#define EPD_TEL_US_SHIFT	4	// Time histograms start at 16 us, the last bucket is above 4 s
+#define EPD_TEL_BYTES_SHIFT	4	// Byte histograms start at 16 bytes
+
+// Frame reports kept, oldest are overwritten
+#ifndef EPD_TEL_REPORTS
+#define EPD_TEL_REPORTS		8
+#endif
+
+typedef struct {
+    uint32_t Count;
+    uint32_t Min;
+    uint32_t Max;
+    uint64_t Sum;
+    uint8_t Shift;
+    uint32_t Bucket[EPD_TEL_BUCKETS];
+} EPD_TEL_HIST;
+
+// One refresh : everything sent to a display since its last refresh, up to the BUSY release
+typedef struct {
+    uint32_t Frame;			// Running number over all displays
+    int Fd;					// SPI fd of the display
+    uint8_t Full;			// 1 full refresh, 0 partial
+    uint16_t Xbyte;			// Bounding box of the RAM uploads, Height 0 if nothing was uploaded
+    uint16_t Ystart;
+    uint16_t WidthByte;
+    uint16_t Height;
+    uint32_t PhaseUs[EPD_TEL_PHASES];
+    uint32_t TotalUs;		// First transfer till the BUSY release
+    uint32_t Bytes;			// SPI bytes, commands included
+    uint32_t Transfers;		// SPI transactions
+    uint32_t GpioToggles;	// D/C and reset pin writes
+} EPD_TEL_REPORT;
+
+// Driver side, called by IL3820_2in9_Driver.c and AzSphere_Interface.c
+uint32_t EPD_Telemetry_Now_Us(void);	// Monotonic, wraps after 71 minutes
+uint32_t EPD_Telemetry_Phase(int fd, uint8_t Phase, uint32_t StartUs);	// Ends a phase begun at StartUs, returns its time
+void EPD_Telemetry_Spi(int fd, uint32_t Bytes);		// One SPI transaction
+void EPD_Telemetry_Gpio(int fd);	// One output pin write
+void EPD_Telemetry_Rect(int fd, uint16_t Xbyte, uint16_t Ystart, uint16_t WidthByte, uint16_t Height);	// RAM window uploaded
+void EPD_Telemetry_Frame_End(int fd, uint8_t Full);	// The refresh is done, files its report
+
+// Application side
+const EPD_TEL_HIST *EPD_Telemetry_Phase_Hist(uint8_t Phase);	// us per phase, all displays
+const EPD_TEL_HIST *EPD_Telemetry_Frame_Hist(uint8_t Full);	// us per refresh
+const EPD_TEL_HIST *EPD_Telemetry_Bytes_Hist(uint8_t Full);	// SPI bytes per refresh
+uint32_t EPD_Telemetry_Percentile(const EPD_TEL_HIST *Hist, uint8_t Pct);	// Upper bound of the bucket holding Pct %
+int EPD_Telemetry_Report(uint8_t Back, EPD_TEL_REPORT *Report);	// 0 for the last refresh, 1 the one before ...
+void EPD_Telemetry_Dump(void);		// Histograms and the last report through Log_Debug
+void EPD_Telemetry_Reset(void);
+
+#endif
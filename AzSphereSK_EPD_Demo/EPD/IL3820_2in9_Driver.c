@@ -10,6 +10,10 @@
 * | Date        :   2020-05-08
 * | Info        :
 * -----------------------------------------------------------------------------
+* Change Log V1.3 (2026-10-19):
+* 1. Added : Chunked frame streaming, EPD_Display_Image/Clear now send a block of rows per SPI transfer
+* 2. Added : Layer compositor, const flash images and RAM overlays are merged while uploading
+* -----------------------------------------------------------------------------
 * Change Log V1.2 (2020-05-08):
 * 1. Added : GFx lib ( provided as Paint lib by Waveshare )
 *		   : Font 8,12, 16, 20, 24 Support added (Will add bigger fonts later
@@ -43,6 +47,9 @@
 
 // Global Includes 
 #include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "../HighLevelCore/applibs_versions.h"
 
@@ -52,6 +59,8 @@
 
 #include "AzSphere_Interface.h"
 #include "IL3820_2in9_Driver.h"
+#include "EPD_Telemetry.h"
+#include "EPD_Energy.h"
 
 /// <summary>
 /// Termination codes for this application. These are used for the
@@ -69,9 +78,31 @@ typedef enum {
     ExitCode_GPIO_ReadValue = 4,
     ExitCode_GPIO_WriteValue = 5,
 
-    ExitCode_RST = 6
+    ExitCode_RST = 6,
+    ExitCode_Window = 7,
+    ExitCode_Temperature = 8,
+
+    ExitCode_Device = 12
 }ExitCode;
 
+// Layers handed to the compositor for one frame
+typedef struct {
+    const EPD_LAYER *Layers;
+    uint8_t Count;
+} EPD_COMPOSITION;
+
+// Canvas in the drawing orientation, rotated to the panel layout while uploading
+typedef struct {
+    const uint8_t *Image;
+    uint16_t Rotate;
+    uint8_t Mirror;
+    uint16_t Stride;	// Bytes per canvas row
+} EPD_ROTATION;
+
+#if (EPD_CHUNK_ROWS % 8) || (EPD_2in9_WIDTH % 8) || (EPD_2in9_HEIGHT % 8)
+#error "Rotated upload works on 8x8 pixel blocks, EPD_CHUNK_ROWS and the panel size must be multiples of 8"
+#endif
+
 // LUT Values for 2.9" EPd Display 
 // Origanl WaveShare Full Update LUT Table 
 const unsigned char EPD_2IN9_lut_full_update[] = {
@@ -106,36 +137,588 @@ const unsigned char LUTDefault_part[] = {
     0x00,0x00,0x00 
 };
 
+// Fast partial update LUT, same source voltage phases as the Waveshare partial LUT with 
+// every TP frame count (bytes 20..29, two 4 bit phases per byte) halved, none below 1 so 
+// no phase is dropped : 1+1+1+2+2+2+1+1 = 11 frames instead of 1+3+1+4+4+4+1+2 = 20.
+// Good for counters and clocks; leaves more ghosting, so a full update is needed from 
+// time to time. Tune the timing bytes per panel batch.
+const unsigned char EPD_2IN9_lut_fast_partial_update[] = {
+    0x10, 0x18, 0x18, 0x08, 0x18, 0x18,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x12, 0x22, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Update time per LUT frame, the 500 ms of the Waveshare partial LUT over its 20 frames
+#define EPD_LUT_FRAME_MS		25
+
+// Waveform registry, ids 0..3 are the Mode values of EPD_Init_2in9.
+// The u8g2 tables start with the WRITE_LUT_REGISTER command byte, so the LUT itself is at +1.
+static EPD_WAVEFORM Waveforms[EPD_WAVEFORM_MAX] = {
+    { EPD_2IN9_lut_full_update,                         2000, EPD_WAVEFORM_FULL,                      "WaveShare Full" },
+    { EPD_2IN9_lut_partial_update,                       500, EPD_WAVEFORM_PART,                      "WaveShare Part" },
+    { LUTDefault_full + 1,                              1800, EPD_WAVEFORM_FULL,                      "u8g2 Full" },
+    { LUTDefault_part + 1,                               500, EPD_WAVEFORM_PART,                      "u8g2 Part" },
+    { EPD_2IN9_lut_fast_partial_update, 11 * EPD_LUT_FRAME_MS, EPD_WAVEFORM_PART | EPD_WAVEFORM_FAST, "Fast Part" },
+};
+static uint8_t WaveformCount = EPD_WAVEFORM_BUILTIN;
+
+// Temperature bands, coldest first. Only the gate line width (0x3B) and dummy lines (0x3A) 
+// change per band, every band keeps the stock LUTs : the fast partial LUT has not been 
+// characterised over temperature, select it with EPD_Set_Waveform_2in9 or your own bands.
+// Starting points, tune them with the panel datasheet of your batch.
+static const EPD_TEMP_BAND DefaultTempBands[] = {
+    // MinTemp, Full waveform,           Partial waveform,         0x3A, 0x3B
+    { -128,     WaveShare_2in9_EPD_FULL, WaveShare_2in9_EPD_PART,  0x1F, 0x0A },   // Below 5 C
+    {    5,     WaveShare_2in9_EPD_FULL, WaveShare_2in9_EPD_PART,  0x1A, 0x08 },   // 5 .. 15 C
+    {   15,     WaveShare_2in9_EPD_FULL, WaveShare_2in9_EPD_PART,  0x1A, 0x08 },   // 15 .. 35 C, the Init values
+    {   35,     WaveShare_2in9_EPD_FULL, WaveShare_2in9_EPD_PART,  0x16, 0x08 },   // Above 35 C
+};
+static const EPD_TEMP_BAND *TempBands = DefaultTempBands;
+static uint8_t TempBandCount = sizeof(DefaultTempBands) / sizeof(DefaultTempBands[0]);
+static EPD_TEMP_SOURCE TempSource;
+static void *TempSourceCtx;
+
+// Control registers whose last value is kept. Writes of an unchanged value are skipped,
+// everything is forgotten on reset / deep sleep where the controller loses it.
+static const uint8_t ShadowRegs[] = {
+    DRIVER_OUTPUT_CONTROL, BOOSTER_SOFT_START_CONTROL, WRITE_VCOM_REGISTER,
+    SET_DUMMY_LINE_PERIOD, SET_GATE_TIME, BORDER_WAVEFORM_CONTROL,
+    DATA_ENTRY_MODE_SETTING, TEMPERATURE_SENSOR_CONTROL, DISPLAY_UPDATE_CONTROL_2,
+    SET_RAM_X_ADDRESS_START_END_POSITION, SET_RAM_Y_ADDRESS_START_END_POSITION,
+    SET_RAM_X_ADDRESS_COUNTER, SET_RAM_Y_ADDRESS_COUNTER,
+};
+#define EPD_SHADOW_REGS (sizeof(ShadowRegs) / sizeof(ShadowRegs[0]))
+#define EPD_SHADOW_BYTES 4
+typedef struct {
+    uint8_t Len;
+    uint8_t Valid;
+    uint8_t Value[EPD_SHADOW_BYTES];
+} EPD_SHADOW;
+
+// State of one display, displays are told apart by their SPI fd (see EPD_Device_Open)
+typedef struct {
+    uint8_t Used;
+    uint8_t PowerState;
+    int8_t ActiveWaveform;                  // Loaded in the display, -1 if none
+    int8_t TempBand;                        // Applied temperature band, -1 if none
+    EPD_SHADOW Shadow[EPD_SHADOW_REGS];
+
+    // Update started by EPD_Update_Start_2in9 and not waited for yet
+    uint8_t UpdatePending;
+    uint8_t UpdateFull;
+    uint8_t UpdateKind;                     // EPD_ENERGY_xxx of the waveform used
+    int8_t UpdateRestore;                   // Partial waveform to load back after a ghosting full refresh, -1 if none
+    struct timespec UpdateStart;
+    uint32_t UpdateStartUs;                 // Same, for the BUSY time of the telemetry
+
+    // Ghosting scheduler. LastFrame is what the panel RAM holds, the flips of every upload are 
+    // counted against it per tile till the next full refresh.
+    uint8_t LastFrame[EPD_HeightByte][EPD_WidthByte];
+    uint16_t TileFlips[EPD_GHOST_TILES_Y][EPD_GHOST_TILES_X];
+    uint16_t GhostWorstTile;                // Highest count in TileFlips
+    uint8_t GhostFrameKnown;                // LastFrame covers the whole panel
+    struct timespec GhostLastFull;
+} EPD_PANEL;
+
+static EPD_PANEL Panels[EPD_MAX_DEVICES];
+static uint16_t GhostFlipLimit = EPD_GHOST_FLIPS;
+static uint32_t GhostMaxAgeS = EPD_GHOST_AGE_S;
+
+// Register setup of EPD_Init_2in9. The frame timing (0x3A, 0x3B) comes from the temperature band 
+// and the LUT from the Mode, both are written after this.
+// Gate Driving Voltage (0x03), Source Driving Voltage (0x04) : Testing Only, left at the defaults
+static const uint8_t InitSequence[] = {
+    DRIVER_OUTPUT_CONTROL, 3, (EPD_2in9_HEIGHT - 1) & 0xFF, ((EPD_2in9_HEIGHT - 1) >> 8) & 0xFF, 0x00,  // GD = 0; SM = 0; TB = 0;
+    BOOSTER_SOFT_START_CONTROL, 3, 0xD7, 0xD6, 0x9D,
+    WRITE_VCOM_REGISTER, 1, 0xA8,           //vcom 7C
+    BORDER_WAVEFORM_CONTROL, 1, 0x03,
+    DATA_ENTRY_MODE_SETTING, 1, 0x03,       // X and Y increment, X first
+    EPD_SEQ_END
+};
+
+static const uint8_t SleepSequence[] = {
+    DEEP_SLEEP_MODE, 1, 0x01,
+    EPD_SEQ_END
+};
+
+// Shows the RAM content on the panel
+static const uint8_t TurnOnSequence[] = {
+    DISPLAY_UPDATE_CONTROL_2, 1, 0xC4,
+    MASTER_ACTIVATION, 0,
+    TERMINATE_FRAME_READ_WRITE, 0,
+    EPD_SEQ_END
+};
+
+/******************************************************************************
+function    : State of a display
+parameter   :
+       fd   :   SPI File Discripter of the display
+return      : Display state, NULL if the display was not opened (Display_Init_2in9 
+              or EPD_Device_Open); callers reject those with ExitCode_Device
+******************************************************************************/
+static EPD_PANEL *EPD_Panel(int fd) {
+    int index = EPD_Device_Index(fd);
+
+    if (index < 0) {
+        Log_Debug("ERROR : EPD_Panel : Display %d was not opened\n", fd);
+        return NULL;
+    }
+    EPD_PANEL *P = &Panels[index];
+    if (!P->Used) {
+        P->Used = 1;
+        P->PowerState = EPD_POWER_OFF;
+        P->ActiveWaveform = -1;
+        P->TempBand = -1;
+        P->UpdateRestore = -1;
+    }
+    return P;
+}
+
+/******************************************************************************
+function    : Writes a command and its parameters, the parameters in one transfer. 
+              Shadowed registers are skipped when the value did not change.
+parameter   :
+       fd   :   SPI File Discripter used for read/Write() functions
+       Cmd  :   Command / register
+       Data :   Parameters
+       Len  :   No of parameters
+return      : Success Signal / Error Code
+******************************************************************************/
+static int EPD_Write_Reg(int fd, uint8_t Cmd, const uint8_t *Data, uint8_t Len) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    EPD_SHADOW *reg = NULL;
+
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    // The controller takes no commands while it updates the panel
+    if (P->UpdatePending) {
+        EPD_Update_Wait_2in9(fd);
+    }
+
+    for (uint8_t i = 0; i < EPD_SHADOW_REGS; i++) {
+        if (ShadowRegs[i] == Cmd) {
+            reg = &P->Shadow[i];
+            break;
+        }
+    }
+    if (reg != NULL && reg->Valid && reg->Len == Len && memcmp(reg->Value, Data, Len) == 0) {
+        return ExitCode_Success;
+    }
+
+    if (spiWriteCmd(fd, Cmd) < 0 || (Len > 0 && Spi_Write(fd, EPD_DATA, (uint8_t *)Data, Len) != Len)) {
+        Log_Debug("ERROR : EPD_Write_Reg : Register 0x%02X Tfr ERROR\n", Cmd);
+        if (reg != NULL) {
+            reg->Valid = 0;
+        }
+        return ExitCode_SPI_WriteData;
+    }
+
+    if (reg != NULL && Len <= EPD_SHADOW_BYTES) {
+        memcpy(reg->Value, Data, Len);
+        reg->Len = Len;
+        reg->Valid = 1;
+    }
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Forgets the shadowed registers of one command, -1 for all of them and the LUT
+******************************************************************************/
+static void EPD_Forget_Reg(EPD_PANEL *P, int Cmd) {
+    for (uint8_t i = 0; i < EPD_SHADOW_REGS; i++) {
+        if (Cmd < 0 || ShadowRegs[i] == Cmd) {
+            P->Shadow[i].Valid = 0;
+        }
+    }
+    if (Cmd < 0) {
+        P->ActiveWaveform = -1;
+    }
+}
+
 // User Functions 
 
-int NoBurnLoop(int fd) {
-    while(1){
-        EPD_Clear_2in9(fd);
-        delay_ms(500);
+/******************************************************************************
+function    : Runs a command sequence table (see EPD_SEQ_xxx). Every command goes 
+              out with all its parameters in one transfer, unchanged shadowed 
+              registers are skipped.
+parameter   :
+       fd   :   SPI File Discripter used for read/Write() functions
+       Seq  :   Sequence table ending with EPD_SEQ_END. An entry with that command 
+                and flags ends the table, it is never sent as a NOP.
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Run_Sequence_2in9(int fd, const uint8_t *Seq) {
+    int ret;
+
+    while (!(Seq[0] == EPD_SEQ_END_CMD && Seq[1] == EPD_SEQ_END_FLAGS)) {
+        uint8_t cmd = Seq[0];
+        uint8_t flags = Seq[1];
+        uint8_t len = flags & EPD_SEQ_LEN;
+
+        ret = EPD_Write_Reg(fd, cmd, &Seq[2], len);
+        if (ret != ExitCode_Success) {
+            return ret;
+        }
+        Seq += 2 + len;
+
+        if (flags & EPD_SEQ_DELAY) {
+            delay_ms(*Seq++);
+        }
+        if (flags & EPD_SEQ_BUSY) {
+            EPD_Device_Busy(fd);
+        }
+    }
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Built in command sequence table
+parameter   :
+       Id   :   EPD_SEQUENCE_INIT / EPD_SEQUENCE_SLEEP / EPD_SEQUENCE_TURN_ON
+return      : Sequence table, NULL for an unknown Id
+******************************************************************************/
+const uint8_t *EPD_Sequence_2in9(uint8_t Id) {
+    switch (Id) {
+    case EPD_SEQUENCE_INIT:
+        return InitSequence;
+    case EPD_SEQUENCE_SLEEP:
+        return SleepSequence;
+    case EPD_SEQUENCE_TURN_ON:
+        return TurnOnSequence;
+    default:
+        return NULL;
+    }
+}
+
+/******************************************************************************
+function    : Power state of the display as tracked by the driver, EPD_POWER_xxx
+******************************************************************************/
+int EPD_Power_State_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+
+    return (P != NULL) ? P->PowerState : EPD_POWER_OFF;
+}
+
+/******************************************************************************
+function    : Forgets every shadowed register and the loaded LUT, so the next 
+              writes go out. Needed only if the display was reset or re-powered 
+              behind the back of the driver.
+******************************************************************************/
+void EPD_Invalidate_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+
+    if (P == NULL) {
+        return;
     }
+    EPD_Forget_Reg(P, -1);
+    P->GhostFrameKnown = 0;
+    P->PowerState = EPD_POWER_OFF;
 }
+
 /******************************************************************************
-function    : Wakes EPD Display from Deep Sleep Mode
-parameter   : fd : SPI File Discripter used for read/Write() functions 
+function    : Adds a user waveform to the registry 
+parameter   :
+       Waveform :   Copied into the registry, Waveform->Lut (30 bytes) must stay valid
+return      : Waveform id, or -1 if the registry is full
+******************************************************************************/
+int EPD_Register_Waveform_2in9(const EPD_WAVEFORM *Waveform) {
+    if (WaveformCount >= EPD_WAVEFORM_MAX || Waveform == NULL || Waveform->Lut == NULL) {
+        Log_Debug("ERROR : EPD_Register_Waveform_2in9 : Registry full or no LUT\n");
+        return -1;
+    }
+    Waveforms[WaveformCount] = *Waveform;
+    return WaveformCount++;
+}
+
+/******************************************************************************
+function    : Looks up a registered waveform
+parameter   :
+       Id   :   Waveform id
+return      : Waveform, or NULL for an unknown id
+******************************************************************************/
+const EPD_WAVEFORM *EPD_Get_Waveform_2in9(uint8_t Id) {
+    return (Id < WaveformCount) ? &Waveforms[Id] : NULL;
+}
+
+/******************************************************************************
+function    : Id of the waveform loaded in the display, -1 if none yet
+******************************************************************************/
+int EPD_Active_Waveform_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+
+    return (P != NULL) ? P->ActiveWaveform : -1;
+}
+
+/******************************************************************************
+function    : Loads a waveform into the display. Only WRITE_LUT_REGISTER (0x32) 
+              is written, so it can be used to switch between full, partial and 
+              fast updates at any time after EPD_Init_2in9.
+parameter   :
+       fd   :   SPI File Discripter used for read/Write() functions
+       Id   :   Waveform id
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Set_Waveform_2in9(int fd, uint8_t Id) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    uint32_t start;
+
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    if (Id >= WaveformCount) {
+        Log_Debug("ERROR : EPD_Set_Waveform_2in9 : Unknown waveform %d\n", Id);
+        return ExitCode_Window;
+    }
+    if (Id == P->ActiveWaveform) {
+        return ExitCode_Success;    // Already loaded
+    }
+
+    // WRITE_LUT_REGISTER, the 30 bytes in one transfer. A running update is waited for 
+    // first so its BUSY time is not counted as LUT load.
+    EPD_Update_Wait_2in9(fd);
+    start = EPD_Telemetry_Now_Us();
+    if (EPD_Write_Reg(fd, WRITE_LUT_REGISTER, Waveforms[Id].Lut, EPD_LUT_SIZE) != ExitCode_Success) {
+        Log_Debug("ERROR : EPD_Set_Waveform_2in9 : LUT Bytes Tfr ERROR\n");
+        return ExitCode_SPI_WriteData;
+    }
+    EPD_Telemetry_Phase(fd, EPD_TEL_LUT, start);
+
+    P->ActiveWaveform = Id;
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Replaces the temperature band table
+parameter   :
+       Bands :   Table sorted by MinTemp, coldest first; must stay valid. NULL for the default table
+       Count :   No of bands
+return      : NONE
+******************************************************************************/
+void EPD_Set_Temp_Bands_2in9(const EPD_TEMP_BAND *Bands, uint8_t Count) {
+    if (Bands == NULL || Count == 0) {
+        Bands = DefaultTempBands;
+        Count = sizeof(DefaultTempBands) / sizeof(DefaultTempBands[0]);
+    }
+    TempBands = Bands;
+    TempBandCount = Count;
+    for (uint8_t i = 0; i < EPD_MAX_DEVICES; i++) {
+        Panels[i].TempBand = -1;  // Applied on the next EPD_Set_Temperature_2in9
+    }
+}
+
+/******************************************************************************
+function    : Sets where EPD_Update_Temperature_2in9 reads the temperature from,
+              e.g. the on board sensor 
+parameter   :
+       Source :   Returns 0 and the temperature in C, NULL to remove
+       Ctx    :   Passed as it is to Source
+return      : NONE
+******************************************************************************/
+void EPD_Set_Temp_Source_2in9(EPD_TEMP_SOURCE Source, void *Ctx) {
+    TempSource = Source;
+    TempSourceCtx = Ctx;
+}
+
+/******************************************************************************
+function    : Tells the display the ambient temperature. Writes the temperature 
+              register (0x1A) and, when the band changes, the frame timing (0x3A, 
+              0x3B) and the LUT of the band, keeping the full / partial kind of 
+              the loaded waveform.
+parameter   :
+       fd    :   SPI File Discripter used for read/Write() functions
+       TempC :   Temperature in C
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Set_Temperature_2in9(int fd, int8_t TempC) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    int ret;
+
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    // TEMPERATURE_SENSOR_CONTROL, 12 bit two's complement in 1/16 C, MSB first
+    uint16_t reg = ((int16_t)TempC * 16) & 0x0FFF;
+    uint8_t temp[2] = { (reg >> 4) & 0xFF, (reg << 4) & 0xF0 };
+    ret = EPD_Write_Reg(fd, TEMPERATURE_SENSOR_CONTROL, temp, 2);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+
+    int8_t band = 0;
+    while (band + 1 < TempBandCount && TempC >= TempBands[band + 1].MinTemp) {
+        band++;
+    }
+    if (band == P->TempBand) {
+        return ExitCode_Success;
+    }
+    P->TempBand = band;
+
+    ret = EPD_Write_Reg(fd, SET_DUMMY_LINE_PERIOD, &TempBands[band].DummyLine, 1);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Write_Reg(fd, SET_GATE_TIME, &TempBands[band].GateTime, 1);
+    }
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+
+    const EPD_WAVEFORM *active = (P->ActiveWaveform >= 0) ? &Waveforms[P->ActiveWaveform] : NULL;
+    if (active != NULL) {
+        return EPD_Set_Waveform_2in9(fd, (active->Flags & EPD_WAVEFORM_FULL) ? TempBands[band].FullWaveform : TempBands[band].PartWaveform);
+    }
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Reads the temperature source and applies it, see EPD_Set_Temperature_2in9
+parameter   :
+       fd    :   SPI File Discripter used for read/Write() functions
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Update_Temperature_2in9(int fd) {
+    int8_t TempC;
+
+    if (TempSource == NULL || TempSource(TempSourceCtx, &TempC) != 0) {
+        Log_Debug("ERROR : EPD_Update_Temperature_2in9 : No temperature\n");
+        return ExitCode_Temperature;
+    }
+    return EPD_Set_Temperature_2in9(fd, TempC);
+}
+
+/******************************************************************************
+function    : Waveforms of the current temperature band, load them with 
+              EPD_Set_Waveform_2in9
+******************************************************************************/
+uint8_t EPD_Full_Waveform_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    int8_t band = (P != NULL) ? P->TempBand : -1;
+    return TempBands[(band >= 0) ? band : 0].FullWaveform;
+}
+
+uint8_t EPD_Part_Waveform_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    int8_t band = (P != NULL) ? P->TempBand : -1;
+    return TempBands[(band >= 0) ? band : 0].PartWaveform;
+}
+
+/******************************************************************************
+function    : Sets when the ghosting scheduler does a full refresh
+parameter   :
+       FlipLimit :   Pixel flips a 16x16 tile may collect, 0 for no limit
+       MaxAgeS   :   Seconds since the last full refresh, 0 for no limit
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Set_Ghost_Limits_2in9(uint16_t FlipLimit, uint32_t MaxAgeS) {
+    GhostFlipLimit = FlipLimit;
+    GhostMaxAgeS = MaxAgeS;
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Tells if the next update is turned into a full refresh. Lets the 
+              application bring a pending content change forward, so the slow 
+              refresh shows new content instead of being an extra one.
+return      : 1 if due, 0 if not
+******************************************************************************/
+int EPD_Ghost_Due_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    struct timespec now;
+
+    if (P == NULL || (GhostFlipLimit == 0 && GhostMaxAgeS == 0)) {
+        return 0;
+    }
+    if (!P->GhostFrameKnown) {
+        return 1;   // Panel content unknown, a full refresh gets it to a known state
+    }
+    if (GhostFlipLimit != 0 && P->GhostWorstTile >= GhostFlipLimit) {
+        return 1;
+    }
+    if (GhostMaxAgeS != 0 && P->GhostWorstTile != 0) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if ((uint32_t)(now.tv_sec - P->GhostLastFull.tv_sec) >= GhostMaxAgeS) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/******************************************************************************
+function    : Counts the pixel flips of an uploaded chunk per tile and keeps the 
+              chunk as the new panel content
+parameter   :
+       P         :   Display the chunk went to
+       Chunk     :   Rows x WidthByte bytes
+       Xbyte     :   First byte column of the chunk on the panel
+       WidthByte :   Bytes per chunk row
+       Ystart    :   First panel row of the chunk
+       Rows      :   No of rows in the chunk
+return      : NONE
+******************************************************************************/
+static void EPD_Ghost_Account(EPD_PANEL *P, const uint8_t *Chunk, uint16_t Xbyte, uint16_t WidthByte, uint16_t Ystart, uint16_t Rows) {
+    for (uint16_t r = 0; r < Rows; r++) {
+        uint8_t *old = &P->LastFrame[Ystart + r][Xbyte];
+        const uint8_t *new = &Chunk[r * WidthByte];
+        uint16_t *tiles = P->TileFlips[(Ystart + r) / EPD_GHOST_TILE_ROWS];
+
+        for (uint16_t b = 0; b < WidthByte; b++) {
+            uint8_t diff = old[b] ^ new[b];
+            if (diff == 0) {
+                continue;
+            }
+            uint16_t *tile = &tiles[(Xbyte + b) / EPD_GHOST_TILE_BYTES];
+            uint32_t flips = *tile + __builtin_popcount(diff);
+            *tile = (flips > 0xFFFF) ? 0xFFFF : flips;
+            if (*tile > P->GhostWorstTile) {
+                P->GhostWorstTile = *tile;
+            }
+            old[b] = new[b];
+        }
+    }
+}
+
+/******************************************************************************
+function    : Wakes EPD Display from Deep Sleep Mode. Deep sleep is only left through 
+              a hardware reset, which also restores the register defaults, so the 
+              display is reset and initialiazed. An awake display only gets the LUT.
+parameter   : 
+       fd   :   SPI File Discripter used for read/Write() functions 
+       mode :   Waveform id to load
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Wake_2in9(int fd, uint8_t mode) {
-    int ret = -1;
+    EPD_PANEL *P = EPD_Panel(fd);
+    uint32_t start;
+    int ret;
+
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    if (P->PowerState == EPD_POWER_AWAKE) {
+        return EPD_Set_Waveform_2in9(fd, mode);
+    }
+
     Log_Debug("Entering Wake Routine\n");
-    ret = EPD_reset();
-    ret = EPD_Init_2in9(fd, mode);
-    //Disable deep sleep Mode 
-    ret = spiWriteCmd(fd, 0x10);
-    ret = spiWriteData(fd, 0x00);
-    EPD_Busy();
-    if (ret < 0) {
+    start = EPD_Telemetry_Now_Us();
+    P->UpdatePending = 0;
+    ret = EPD_Device_Reset(fd);
+    EPD_Forget_Reg(P, -1);
+    // The RAM content does not survive the reset, LastFrame is known again after a whole frame
+    P->GhostFrameKnown = 0;
+    if (ret != ExitCode_Success) {
         Log_Debug("ERROR : EPD_Wake_2in9 : Error Comming out of DEEP_SLEEP_MODE \n");
-        return ExitCode_SPI_WriteData;
-    }  
+        return ExitCode_RST;
+    }
+    EPD_Device_Busy(fd);
 
-    Log_Debug("INFO : EPD_Wake_2in9 : EPD Waking from DEEP_SLEEP_MODE\n");
-    delay_ms(50);
+    ret = EPD_Init_2in9(fd, mode);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+    EPD_Telemetry_Phase(fd, EPD_TEL_WAKE, start);
 
+    Log_Debug("INFO : EPD_Wake_2in9 : EPD Waking from DEEP_SLEEP_MODE\n");
     return ExitCode_Success;
 }
 
@@ -143,80 +726,39 @@ int EPD_Wake_2in9(int fd, uint8_t mode) {
 function    : Main Initialization routine for the Display
 parameter   : 
        fd   :   SPI File Discripter used for read/Write() functions
-       Mode :   Defines which LUT Table will you use
+       Mode :   Defines which LUT Table will you use (waveform id)
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Init_2in9(int fd, uint8_t Mode) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    // Frame timing of the temperature band, 4 dummy lines per gate and 2us per line till one is set
+    uint8_t DummyLine = 0x1A, GateTime = 0x08;
     int ret;
 
-    // Setting DRIVER_OUTPUT_CONTROL
-    ret = spiWriteCmd(fd, 0x01);
-    ret = spiWriteData(fd, ((EPD_2in9_HEIGHT - 1) & 0xFF));
-    ret += spiWriteData(fd, (((EPD_2in9_HEIGHT - 1) >> 8) & 0xFF));
-    ret += spiWriteData(fd, 0x00); // GD = 0; SM = 0; TB = 0;
-
-    // Gate Driving Voltage : Testing Only 
-    //  ret = spiWriteCmd(fd, 0x03);
-    //  ret = spiWriteData(fd, 0x00);
-
-    // Source Driving Violtage  : Testing Only 
-    //  ret = spiWriteCmd(fd, 0x04);
-    //  ret = spiWriteData(fd, 0x0A);
-
-    // BOOSTER_SOFT_START_CONTROL
-    ret = spiWriteCmd(fd, 0x0C);
-    ret = spiWriteData(fd, 0xD7);
-    ret += spiWriteData(fd, 0xD6);
-    ret += spiWriteData(fd, 0x9D);
-
-    // WRITE_VCOM_REGISTER
-    ret = spiWriteCmd(fd, 0x2C);
-    ret = spiWriteData(fd, 0xA8); //vcom 7C
-
-    // SET_DUMMY_LINE_PERIOD
-    ret = spiWriteCmd(fd, 0x3A);
-    ret = spiWriteData(fd, 0x1A); //4 dummy lines per gate  
-
-    // SET_GATE_TIME
-    ret = spiWriteCmd(fd, 0x3B);
-    ret = spiWriteData(fd, 0x08); //2us per line 
-
-    // BORDER_WAVEFORM_CONTROL
-    ret = spiWriteCmd(fd, 0x3C);
-    ret = spiWriteData(fd, 0x03);
-    // DATA_ENTRY_MODE_SETTING
-    ret = spiWriteCmd(fd, 0x11);
-    ret = spiWriteData(fd, 0x03);
-
-    // WRITE_LUT_REGISTER
-    ret = spiWriteCmd(fd, 0x32);
-    // Switches the Mode of operation by changing the LUT values; Will add more LUT Tables after testing them. 
-    switch (Mode) {                    
-        case WaveShare_2in9_EPD_FULL :              // Origanl Waveshare LUT for Full update 
-            for (uint16_t i = 0; i < 30; i++) {
-                ret += spiWriteData(fd, EPD_2IN9_lut_full_update[i]);
-            }
-            break;
-        case WaveShare_2in9_EPD_PART : 
-            for (uint16_t i = 0; i < 30; i++) {
-                ret += spiWriteData(fd, EPD_2IN9_lut_partial_update[i]);
-            }
-            break;
-        case U8G2_2in9_EPD_FULL : 
-            for (uint16_t i = 0; i < 30; i++) {
-                ret += spiWriteData(fd, LUTDefault_full[i]);
-            }
-            break;
-        case U8G2_2in9_EPD_PART:
-            for (uint16_t i = 0; i < 30; i++) {
-                ret += spiWriteData(fd, LUTDefault_part[i]);
-            }
-            break;
-        default :   Log_Debug("ERROR : EPD_Init_2in9 : ONLY Mode is EPD_2IN9_FULL or EPD_2IN9_PART");
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    if (P->TempBand >= 0) {
+        DummyLine = TempBands[P->TempBand].DummyLine;
+        GateTime = TempBands[P->TempBand].GateTime;
+    }
+    // Unchanged registers are skipped, on an initialiazed display this is only the LUT
+    ret = EPD_Run_Sequence_2in9(fd, InitSequence);
+    ret |= EPD_Write_Reg(fd, SET_DUMMY_LINE_PERIOD, &DummyLine, 1);
+    ret |= EPD_Write_Reg(fd, SET_GATE_TIME, &GateTime, 1);
+    if (ret != ExitCode_Success) {
+        Log_Debug("ERROR : EPD_Init_2in9 : Register Tfr ERROR\n");
+        return ExitCode_SPI_WriteData;
+    }
+
+    // WRITE_LUT_REGISTER, Mode is a waveform id (WaveShare_2in9_EPD_FULL ... or a registered one)
+    ret = EPD_Set_Waveform_2in9(fd, Mode);
+    if (ret != ExitCode_Success) {
+        Log_Debug("ERROR : EPD_Init_2in9 : Mode should be a registered waveform\n");
     }
 
-    delay_ms(500);
-    //ret = EPD_Busy(); // wait for EPD to configure properly 
+    P->PowerState = EPD_POWER_AWAKE;
+    EPD_Energy_Power(fd, EPD_POWER_AWAKE);
     return ExitCode_Success;
 }
 
@@ -228,54 +770,272 @@ parameter   :
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Clear_2in9(int fd) {
-    uint16_t W, H;
-    int ret = -1;
+    // A composition without layers is all white
+    return EPD_Display_Layers_2in9(fd, NULL, 0);
+}
 
-    W = EPD_WidthByte;
-    H = EPD_HeightByte;
+/******************************************************************************
+function    : Routine to Display images onthe display 
+parameter   :
+       fd    :   SPI File Discripter used for read/Write() functions
+       Image :   Image pointer in the proper format 8 pixels = 1 byte 
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Display_Image_2in9(int fd, const uint8_t *Image) {
+    EPD_LAYER frame = { Image, NULL, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_LAYER_COPY };
 
-    EPD_Set_Display_Area_2in9(fd, 0, 0, EPD_2in9_WIDTH, EPD_2in9_HEIGHT);
+    return EPD_Display_Layers_2in9(fd, &frame, 1);
+}
 
-    for (uint16_t j = 0; j < H; j++) {
-        EPD_Set_Cursor_2in9(fd, 0, j);
-        ret += spiWriteCmd(fd, 0x24);
-        for (uint16_t i = 0; i < W; i++) {
-            ret += spiWriteData(fd, 0xFF);
+/******************************************************************************
+function    : Stream fill function of the compositor. Starts from a white chunk and 
+              merges every layer that overlaps it, bottom layer first.
+parameter   :
+       Ctx       :   EPD_COMPOSITION of the frame
+       Chunk     :   Output, Rows x WidthByte bytes
+       Xbyte     :   First byte column of the chunk on the panel
+       WidthByte :   Bytes per chunk row
+       Ystart    :   First panel row of the chunk
+       Rows      :   No of rows in the chunk
+return      : NONE
+******************************************************************************/
+static void EPD_Compose_Rows(void *Ctx, uint8_t *Chunk, uint16_t Xbyte, uint16_t WidthByte, uint16_t Ystart, uint16_t Rows) {
+    const EPD_COMPOSITION *comp = (const EPD_COMPOSITION *)Ctx;
+
+    memset(Chunk, 0xFF, (size_t)WidthByte * Rows);  // White background 
+
+    for (uint8_t l = 0; l < comp->Count; l++) {
+        const EPD_LAYER *layer = &comp->Layers[l];
+
+        // Part of the layer that falls inside this chunk
+        uint16_t y0 = (layer->Ystart > Ystart) ? layer->Ystart : Ystart;
+        uint16_t y1 = (layer->Ystart + layer->Height < Ystart + Rows) ? layer->Ystart + layer->Height : Ystart + Rows;
+        uint16_t x0 = (layer->Xbyte > Xbyte) ? layer->Xbyte : Xbyte;
+        uint16_t x1 = (layer->Xbyte + layer->WidthByte < Xbyte + WidthByte) ? layer->Xbyte + layer->WidthByte : Xbyte + WidthByte;
+        if (y0 >= y1 || x0 >= x1) {
+            continue;
         }
+
+        uint16_t len = x1 - x0;
+        for (uint16_t y = y0; y < y1; y++) {
+            uint8_t *out = &Chunk[(uint32_t)(y - Ystart) * WidthByte + (x0 - Xbyte)];
+            uint32_t src = (uint32_t)(y - layer->Ystart) * layer->WidthByte + (x0 - layer->Xbyte);
+            const uint8_t *img = &layer->Image[src];
+
+            if (layer->Mode == EPD_LAYER_INK) {
+                for (uint16_t i = 0; i < len; i++) {
+                    out[i] &= img[i];   // Black is 0, so AND keeps the black pixels of both 
+                }
+            } else if (layer->Mode == EPD_LAYER_MASK && layer->Mask != NULL) {
+                const uint8_t *mask = &layer->Mask[src];
+                for (uint16_t i = 0; i < len; i++) {
+                    out[i] = (out[i] & ~mask[i]) | (img[i] & mask[i]);
+                }
+            } else {
+                memcpy(out, img, len);
+            }
+        }
+    }
+}
+
+/******************************************************************************
+function    : Composes the layers on the fly while uploading a full frame, and displays it.
+              Nothing is copied into a frame buffer, each SPI chunk is merged from the layers.
+parameter   :
+       fd     :   SPI File Discripter used for read/Write() functions
+       Layers :   Layers from bottom to top, area not covered by any layer is white
+       Count  :   No of Layers
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Display_Layers_2in9(int fd, const EPD_LAYER *Layers, uint8_t Count) {
+    EPD_COMPOSITION comp = { Layers, Count };
+    EPD_STREAM stream;
+    int ret;
+
+    ret = EPD_Stream_Begin_2in9(&stream, fd, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_Compose_Rows, &comp);
+    if (ret != ExitCode_Success) {
+        return ret;
     }
-    
-    delay_ms(100);
+
+    ret = EPD_Stream_Run_2in9(&stream);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+
     EPD_Turn_On_Display_2in9(fd);
     return ExitCode_Success;
 }
 
 /******************************************************************************
-function    : Routine to Display images onthe display 
+function    : Uploads only some rectangles of a frame and displays it. The IL3820 
+              toggles between two RAM buffers on every update, so the rectangles are 
+              written again after the update to keep both buffers the same.
 parameter   :
-       fd    :   SPI File Discripter used for read/Write() functions
-       Image :   Image pointer in the proper format 8 pixels = 1 byte 
+       fd     :   SPI File Discripter used for read/Write() functions
+       Image  :   Whole frame in the panel layout, 8 pixels = 1 byte
+       Rects  :   Parts of the panel RAM that changed
+       Count  :   No of Rects
 return      : Success Signal / Error Code
 ******************************************************************************/
-int EPD_Display_Image_2in9(int fd, uint8_t *Image) {
-    uint16_t W, H;
-    uint32_t Addr = 0;
-    int ret = -1;
+int EPD_Display_Rects_2in9(int fd, const uint8_t *Image, const EPD_RECT *Rects, uint8_t Count) {
+    EPD_LAYER frame = { Image, NULL, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_LAYER_COPY };
+    EPD_COMPOSITION comp = { &frame, 1 };
+    EPD_STREAM stream;
+    int ret;
+
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        for (uint8_t r = 0; r < Count; r++) {
+            ret = EPD_Stream_Begin_2in9(&stream, fd, Rects[r].Xbyte, Rects[r].Ystart, Rects[r].WidthByte, Rects[r].Height, EPD_Compose_Rows, &comp);
+            if (ret != ExitCode_Success) {
+                return ret;
+            }
+            ret = EPD_Stream_Run_2in9(&stream);
+            if (ret != ExitCode_Success) {
+                return ret;
+            }
+        }
+        if (pass == 0) {
+            ret = EPD_Turn_On_Display_2in9(fd);
+            if (ret != ExitCode_Success) {
+                return ret;
+            }
+        }
+    }
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Transposes an 8x8 bit matrix, byte 0 (MSB) is row 0 and bit 7 is column 0.
+              Plain 64 bit SWAR, 3 delta swaps instead of 64 single bit moves.
+parameter   :
+       x     :   8 rows of 8 pixels
+return      : Transposed matrix
+******************************************************************************/
+static inline uint64_t EPD_Transpose_8x8(uint64_t x) {
+    uint64_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;    // 1x1 blocks
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;   // 2x2 blocks
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;   // 4x4 blocks
+    x = x ^ t ^ (t << 28);
+    return x;
+}
+
+/******************************************************************************
+function    : Reverses the bits of every byte, flips an 8x8 block left to right
+******************************************************************************/
+static inline uint64_t EPD_Flip_Columns_8x8(uint64_t x) {
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return x;
+}
+
+/******************************************************************************
+function    : Stream fill function of the rotated upload. Every 8x8 pixel block of 
+              the chunk is read from the canvas as one 64 bit word, transposed and 
+              flipped as needed and written back as 8 panel bytes. 
+              Mapping is the inverse of Paint_SetPixel, so a native canvas shows up 
+              exactly like the same drawing done in the panel layout.
+parameter   :
+       Ctx       :   EPD_ROTATION of the frame
+       Chunk     :   Output, Rows x WidthByte bytes
+       Xbyte     :   First byte column of the chunk on the panel
+       WidthByte :   Bytes per chunk row
+       Ystart    :   First panel row of the chunk, multiple of 8
+       Rows      :   No of rows in the chunk, multiple of 8
+return      : NONE
+******************************************************************************/
+static void EPD_Rotate_Rows(void *Ctx, uint8_t *Chunk, uint16_t Xbyte, uint16_t WidthByte, uint16_t Ystart, uint16_t Rows) {
+    const EPD_ROTATION *rot = (const EPD_ROTATION *)Ctx;
+    const uint16_t WM = EPD_2in9_WIDTH, HM = EPD_2in9_HEIGHT;
+    uint8_t transpose = (rot->Rotate == 90 || rot->Rotate == 270);
+    uint8_t rowflip = (rot->Mirror & 0x02) ? 1 : 0;  // MIRROR_VERTICAL
+    uint8_t colflip = (rot->Mirror & 0x01) ? 1 : 0;  // MIRROR_HORIZONTAL
+
+    // Flips that come from the rotation itself
+    if (rot->Rotate == 90) {
+        colflip ^= 1;
+    } else if (rot->Rotate == 180) {
+        rowflip ^= 1;
+        colflip ^= 1;
+    } else if (rot->Rotate == 270) {
+        rowflip ^= 1;
+    }
+
+    for (uint16_t by = 0; by < Rows; by += 8) {
+        for (uint16_t bx = 0; bx < WidthByte; bx++) {
+            // Panel block before mirroring
+            uint16_t X0 = (Xbyte + bx) * 8, Y0 = Ystart + by;
+            if (rot->Mirror & 0x01) X0 = WM - 8 - X0;
+            if (rot->Mirror & 0x02) Y0 = HM - 8 - Y0;
 
-    W = EPD_WidthByte;
-    H = EPD_HeightByte;
+            // Same block on the canvas
+            uint16_t cx, cy;
+            switch (rot->Rotate) {
+            case 90:  cx = Y0;          cy = WM - 8 - X0; break;
+            case 180: cx = WM - 8 - X0; cy = HM - 8 - Y0; break;
+            case 270: cx = HM - 8 - Y0; cy = X0;          break;
+            default:  cx = X0;          cy = Y0;          break;
+            }
+
+            const uint8_t *src = &rot->Image[(uint32_t)cy * rot->Stride + cx / 8];
+            uint64_t blk = 0;
+            for (uint8_t r = 0; r < 8; r++) {
+                blk = (blk << 8) | src[(uint32_t)r * rot->Stride];
+            }
 
-    EPD_Set_Display_Area_2in9(fd, 0, 0, EPD_2in9_WIDTH, EPD_2in9_HEIGHT);
+            if (transpose) blk = EPD_Transpose_8x8(blk);
+            if (colflip) blk = EPD_Flip_Columns_8x8(blk);
+            if (rowflip) blk = __builtin_bswap64(blk);
 
-    for (uint16_t j = 0; j < H; j++) {
-        EPD_Set_Cursor_2in9(fd, 0, j);
-        ret += spiWriteCmd(fd, 0x24);
-        for (uint16_t i = 0; i < W; i++) {
-            Addr = i + j * W;
-            ret += spiWriteData(fd, Image[Addr]);
+            uint8_t *out = &Chunk[(uint32_t)by * WidthByte + bx];
+            for (int8_t r = 7; r >= 0; r--) {
+                out[(uint32_t)r * WidthByte] = (uint8_t)blk;
+                blk >>= 8;
+            }
         }
     }
+}
+
+/******************************************************************************
+function    : Displays a canvas drawn in its own orientation (Paint layout 
+              PAINT_LAYOUT_NATIVE). Rotation and mirroring are applied once per 
+              byte while uploading instead of once per pixel while drawing.
+parameter   :
+       fd     :   SPI File Discripter used for read/Write() functions
+       Image  :   Canvas, 8 pixels = 1 byte, row-major in the drawing orientation.
+                  128x296 for Rotate 0/180, 296x128 for Rotate 90/270
+       Rotate :   Same values as Paint_NewImage, 0 / 90 / 180 / 270
+       Mirror :   Same values as Paint_SetMirroring, bit 0 horizontal, bit 1 vertical
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Display_Rotated_2in9(int fd, const uint8_t *Image, uint16_t Rotate, uint8_t Mirror) {
+    EPD_ROTATION rot = { Image, Rotate, Mirror, 0 };
+    EPD_STREAM stream;
+    int ret;
+
+    if (Rotate == 90 || Rotate == 270) {
+        rot.Stride = EPD_2in9_HEIGHT / 8;
+    } else if (Rotate == 0 || Rotate == 180) {
+        rot.Stride = EPD_WidthByte;
+    } else {
+        Log_Debug("ERROR : EPD_Display_Rotated_2in9 : Rotate should be 0, 90, 180 or 270\n");
+        return ExitCode_Window;
+    }
+
+    ret = EPD_Stream_Begin_2in9(&stream, fd, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_Rotate_Rows, &rot);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+
+    ret = EPD_Stream_Run_2in9(&stream);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
 
-    delay_ms(100);
     EPD_Turn_On_Display_2in9(fd);
     return ExitCode_Success;
 }
@@ -287,20 +1047,26 @@ parameter   :
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Sleep_2in9(int fd) {
-    int ret = -1;
-    //DEEP_SLEEP_MODE Register
-    ret = spiWriteCmd(fd, 0x10);
-    if (ret < 0) {
-        Log_Debug("ERROR : EPD_Sleep_2in9 : DEEP_SLEEP_MODE CMD Bytes Tfr ERROR\n");
-        return ExitCode_SPI_WriteData;
+    EPD_PANEL *P = EPD_Panel(fd);
+    uint32_t start;
+    int ret;
+
+    if (P == NULL) {
+        return ExitCode_Device;
     }
-    // Enabling EPD Sleep Mode
-    ret = spiWriteData(fd, 0x01);
-    if (ret < 0) {
-        Log_Debug("ERROR : EPD_Sleep_2in9 : DEEP_SLEEP_MODE Data Bytes Tfr ERROR\n");
-        return ExitCode_SPI_WriteData;
+    // DEEP_SLEEP_MODE
+    EPD_Update_Wait_2in9(fd);
+    start = EPD_Telemetry_Now_Us();
+    ret = EPD_Run_Sequence_2in9(fd, SleepSequence);
+    if (ret != ExitCode_Success) {
+        Log_Debug("ERROR : EPD_Sleep_2in9 : DEEP_SLEEP_MODE Bytes Tfr ERROR\n");
+        return ret;
     }
-    //EPD_Busy();
+    EPD_Telemetry_Phase(fd, EPD_TEL_SLEEP, start);
+    // Only a hardware reset brings it back, with the registers at their defaults
+    EPD_Forget_Reg(P, -1);
+    P->PowerState = EPD_POWER_SLEEP;
+    EPD_Energy_Power(fd, EPD_POWER_SLEEP);
     Log_Debug("INFO : EPD_Sleep_2in9 : EPD Entering DEEP_SLEEP_MODE\n");
     return ExitCode_Success;
 }
@@ -314,21 +1080,164 @@ return      : Success Signal / Error Code
 int EPD_Turn_On_Display_2in9(int fd) {
     int ret;
 
-    // DISPLAY_UPDATE_CONTROL_2
-    ret = spiWriteCmd(fd, 0x22);
-    ret = spiWriteData(fd, 0xC4);
-    // MASTER_ACTIVATION
-    ret = spiWriteCmd(fd, 0x20);
-    // TERMINATE_FRAME_READ_WRITE
-    ret = spiWriteCmd(fd, 0xFF);
-    
-    delay_ms(100);
-    ret = EPD_Busy();
-    //delay_ms(1800);
+    ret = EPD_Update_Start_2in9(fd);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+    return EPD_Update_Wait_2in9(fd);
+}
+
+/******************************************************************************
+function    : Kind of update EPD_Update_Start_2in9 would do now : full with a full 
+              waveform loaded or when the ghosting scheduler wants one, else fast 
+              or partial as the loaded waveform. Pass it to EPD_Energy_Due.
+parameter   :
+       fd    :   SPI File Discripter used for read/Write() functions
+return      : EPD_ENERGY_FULL / EPD_ENERGY_PART / EPD_ENERGY_FAST
+******************************************************************************/
+uint8_t EPD_Update_Kind_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    const EPD_WAVEFORM *active;
+
+    if (P == NULL) {
+        return EPD_ENERGY_FULL;
+    }
+    active = (P->ActiveWaveform >= 0) ? &Waveforms[P->ActiveWaveform] : NULL;
+    if ((active != NULL && (active->Flags & EPD_WAVEFORM_FULL)) || EPD_Ghost_Due_2in9(fd)) {
+        return EPD_ENERGY_FULL;
+    }
+    return (active != NULL && (active->Flags & EPD_WAVEFORM_FAST)) ? EPD_ENERGY_FAST : EPD_ENERGY_PART;
+}
+
+/******************************************************************************
+function    : Starts showing the RAM content on the panel and returns without 
+              waiting, so other displays can be served while this one updates.
+              The next command to this display waits for the update first.
+parameter   :
+       fd    :   SPI File Discripter used for read/Write() functions
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Update_Start_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    uint32_t start;
+    int ret;
+
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    if (P->UpdatePending) {
+        EPD_Update_Wait_2in9(fd);
+    }
+    P->UpdateKind = EPD_Update_Kind_2in9(fd);
+    P->UpdateFull = (P->UpdateKind == EPD_ENERGY_FULL);
+    P->UpdateRestore = -1;
 
+    // A partial update the ghosting scheduler wants cleaned is done with the full LUT instead
+    if (P->UpdateFull && !(P->ActiveWaveform >= 0 && (Waveforms[P->ActiveWaveform].Flags & EPD_WAVEFORM_FULL))) {
+        int8_t partial = P->ActiveWaveform;
+        ret = EPD_Set_Waveform_2in9(fd, EPD_Full_Waveform_2in9(fd));
+        if (ret != ExitCode_Success) {
+            return ret;
+        }
+        P->UpdateRestore = partial;
+        Log_Debug("INFO : EPD_Update_Start_2in9 : Full refresh against ghosting\n");
+    }
+
+    // DISPLAY_UPDATE_CONTROL_2, MASTER_ACTIVATION, TERMINATE_FRAME_READ_WRITE
+    start = EPD_Telemetry_Now_Us();
+    ret = EPD_Run_Sequence_2in9(fd, TurnOnSequence);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &P->UpdateStart);
+    EPD_Telemetry_Phase(fd, EPD_TEL_TURN_ON, start);
+    P->UpdateStartUs = EPD_Telemetry_Now_Us();
+    P->UpdatePending = 1;
     return ExitCode_Success;
 }
 
+/******************************************************************************
+function    : Waits for the update started by EPD_Update_Start_2in9 
+parameter   :
+       fd    :   SPI File Discripter used for read/Write() functions
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Update_Wait_2in9(int fd) {
+    EPD_PANEL *P = EPD_Panel(fd);
+    EPD_TEL_REPORT report;
+    struct timespec now;
+    int ret;
+
+    if (P == NULL) {
+        return ExitCode_Device;
+    }
+    if (!P->UpdatePending) {
+        return ExitCode_Success;
+    }
+
+    // BUSY rises a while after MASTER_ACTIVATION, give it 100 ms before reading it
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    int32_t elapsed = (int32_t)((now.tv_sec - P->UpdateStart.tv_sec) * 1000 + (now.tv_nsec - P->UpdateStart.tv_nsec) / 1000000);
+    if (elapsed < 100) {
+        delay_ms(100 - elapsed);
+    }
+    ret = EPD_Device_Busy(fd);
+    EPD_Telemetry_Phase(fd, EPD_TEL_BUSY, P->UpdateStartUs);
+    P->UpdatePending = 0;
+
+    if (P->UpdateFull) {
+        memset(P->TileFlips, 0, sizeof(P->TileFlips));
+        P->GhostWorstTile = 0;
+        P->GhostLastFull = now;
+    }
+    if (P->UpdateRestore >= 0) {
+        EPD_Set_Waveform_2in9(fd, P->UpdateRestore);
+        P->UpdateRestore = -1;
+    }
+    EPD_Telemetry_Frame_End(fd, P->UpdateFull);
+    if (EPD_Telemetry_Report(0, &report) == ExitCode_Success) {
+        EPD_Energy_Refresh(fd, P->UpdateKind, report.Bytes, report.PhaseUs[EPD_TEL_BUSY]);
+    }
+    return ret;
+}
+
+/******************************************************************************
+function    : Shows an image on each of several displays. Every display is uploaded 
+              while the ones before it update, so all the waveforms run together 
+              and the whole takes about as long as one display.
+parameter   :
+       Fds    :   SPI File Discripters of the displays
+       Images :   One image per display, in the panel layout (8 pixels = 1 byte)
+       Count  :   No of displays
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Display_Multi_2in9(const int *Fds, const uint8_t *const *Images, uint8_t Count) {
+    int ret = ExitCode_Success;
+
+    for (uint8_t i = 0; i < Count; i++) {
+        EPD_LAYER frame = { Images[i], NULL, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_LAYER_COPY };
+        EPD_COMPOSITION comp = { &frame, 1 };
+        EPD_STREAM stream;
+
+        ret = EPD_Stream_Begin_2in9(&stream, Fds[i], 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_Compose_Rows, &comp);
+        if (ret == ExitCode_Success) {
+            ret = EPD_Stream_Run_2in9(&stream);
+        }
+        if (ret == ExitCode_Success) {
+            ret = EPD_Update_Start_2in9(Fds[i]);
+        }
+        if (ret != ExitCode_Success) {
+            Log_Debug("ERROR : EPD_Display_Multi_2in9 : Display %d failed\n", i);
+            break;
+        }
+    }
+
+    for (uint8_t i = 0; i < Count; i++) {
+        EPD_Update_Wait_2in9(Fds[i]);
+    }
+    return ret;
+}
+
 /******************************************************************************
 NOTE    :    NOT YET IMPLEMENTED 
 function    : Change sthe Orientation of the display 
@@ -361,18 +1270,16 @@ parameter   :
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Set_Cursor_2in9(int fd, uint16_t Xs, uint16_t Ys) {
+    uint8_t X = (Xs >> 3) & 0xFF;
+    uint8_t Y[2] = { Ys & 0xFF, (Ys >> 8) & 0xFF };
     int ret;
-    // SET_RAM_X_ADDRESS_COUNTER
-    ret = spiWriteCmd(fd, 0x4E);
-    ret = spiWriteData(fd, ((Xs >> 3) & 0xFF));
-    //ret = spiWriteData(fd, (Xs & 0xFF));
 
-    // SET_RAM_Y_ADDRESS_COUNTER
-    ret = spiWriteCmd(fd, 0x4F);
-    ret = spiWriteData(fd, (Ys & 0xFF));
-    ret = spiWriteData(fd, ((Ys >> 8) & 0xFF));
-
-    return ExitCode_Success;
+    // SET_RAM_X_ADDRESS_COUNTER, SET_RAM_Y_ADDRESS_COUNTER
+    ret = EPD_Write_Reg(fd, SET_RAM_X_ADDRESS_COUNTER, &X, 1);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Write_Reg(fd, SET_RAM_Y_ADDRESS_COUNTER, Y, 2);
+    }
+    return ret;
 }
  
 /******************************************************************************
@@ -386,21 +1293,16 @@ parameter   :
 return      : Success Signal / Error Code
 ******************************************************************************/
 int EPD_Set_Display_Area_2in9(int fd, uint16_t Xs, uint16_t Ys, uint16_t Xe, uint16_t Ye) {
+    uint8_t X[2] = { (Xs >> 3) & 0xFF, (Xe >> 3) & 0xFF };
+    uint8_t Y[4] = { Ys & 0xFF, (Ys >> 8) & 0xFF, Ye & 0xFF, (Ye >> 8) & 0xFF };
     int ret;
-    // SET_RAM_X_ADDRESS_START_END_POSITION
-    ret = spiWriteCmd(fd, 0x44);
-    ret = spiWriteData(fd, ((Xs >> 3) & 0xFF));
-    ret = spiWriteData(fd, ((Xe >> 3) & 0xFF));
-
-    // SET_RAM_Y_ADDRESS_START_END_POSITION
-    ret = spiWriteCmd(fd, 0x45);
-    ret = spiWriteData(fd, (Ys & 0xFF));
-    ret = spiWriteData(fd, ((Ys >> 8) & 0xFF));
-    ret = spiWriteData(fd, (Ye & 0xFF));
-    ret = spiWriteData(fd, ((Ye >> 8) & 0xFF));
-    //ret = EPD_Busy();
-    delay_ms(100);
-    return ExitCode_Success;
+
+    // SET_RAM_X_ADDRESS_START_END_POSITION, SET_RAM_Y_ADDRESS_START_END_POSITION
+    ret = EPD_Write_Reg(fd, SET_RAM_X_ADDRESS_START_END_POSITION, X, 2);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Write_Reg(fd, SET_RAM_Y_ADDRESS_START_END_POSITION, Y, 4);
+    }
+    return ret;
 }
 
 // Does everything 
@@ -413,19 +1315,280 @@ return      : Success Signal / Error Code
 ******************************************************************************/
 int Display_Init_2in9(int fd, int mode) {
     int ret;
-    // Init GPIO
-    ret = EPD_gpio_init();  
 
-    //Resetting the Display 
-    ret = EPD_reset();
-    delay_ms(50);
+    // Opens the pins of the CLICK_SLOT display, unless EPD_Device_Open did it for this one
+    if (EPD_Device(fd) == NULL && EPD_Device_Open(fd, CLICK_SLOT) < 0) {
+        Log_Debug("ERROR : Display_Init_2in9 : Could not open the display pins\n");
+        return ExitCode_GPIO_WriteValue;
+    }
 
-    // Wakes the Display if it ws sleeping prior to using this command
+    // Resets and initialiazes the Display unless it is already awake
     ret = EPD_Wake_2in9(fd, mode);
-
-    // Initialiaze the Display 
-    ret = EPD_Init_2in9(fd, mode);
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
 
     Log_Debug("Initialiazed the Display\n");
     return ExitCode_Success;
-}
\ No newline at end of file
+}
+
+/******************************************************************************
+function    : Opens a RAM window and starts streaming it to the display. 
+              The window is filled row chunk by row chunk by the Fill function.
+parameter   :
+       Stream    :   Stream state, owned by the caller till the stream is done
+       fd        :   SPI File Discripter used for read/Write() functions
+       Xbyte     :   Window start X in bytes (8 pixel steps)
+       Ystart    :   Window start Y in rows 
+       WidthByte :   Window width in bytes
+       Height    :   Window height in rows 
+       Fill      :   Function that generates the RAM content of each chunk
+       Ctx       :   Passed as it is to Fill
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Stream_Begin_2in9(EPD_STREAM *Stream, int fd, uint16_t Xbyte, uint16_t Ystart, uint16_t WidthByte, uint16_t Height, EPD_FILL_ROWS Fill, void *Ctx) {
+    uint32_t start;
+    int ret;
+
+    if (EPD_Panel(fd) == NULL) {
+        return ExitCode_Device;
+    }
+    if (WidthByte == 0 || Height == 0 || Xbyte + WidthByte > EPD_WidthByte || Ystart + Height > EPD_HeightByte) {
+        Log_Debug("ERROR : EPD_Stream_Begin_2in9 : Window exceeds the display RAM\n");
+        return ExitCode_Window;
+    }
+
+    Stream->Fd = fd;
+    Stream->Xbyte = Xbyte;
+    Stream->WidthByte = WidthByte;
+    Stream->Y = Ystart;
+    Stream->Yend = Ystart + Height;
+    Stream->Fill = Fill;
+    Stream->Ctx = Ctx;
+
+    // End positions are inclusive; the address counter wraps to the next row at the window edge
+    EPD_Update_Wait_2in9(fd);
+    start = EPD_Telemetry_Now_Us();
+    EPD_Telemetry_Rect(fd, Xbyte, Ystart, WidthByte, Height);
+    ret = EPD_Set_Display_Area_2in9(fd, Xbyte * 8, Ystart, (Xbyte + WidthByte - 1) * 8, Ystart + Height - 1);
+    if (ret == ExitCode_Success) {
+        ret = EPD_Set_Cursor_2in9(fd, Xbyte * 8, Ystart);
+    }
+    if (ret != ExitCode_Success) {
+        return ret;
+    }
+
+    // WRITE_RAM, everything after this is pixel data till the next command. The data moves the 
+    // address counters, so their shadow is stale from here on.
+    EPD_Forget_Reg(EPD_Panel(fd), SET_RAM_X_ADDRESS_COUNTER);
+    EPD_Forget_Reg(EPD_Panel(fd), SET_RAM_Y_ADDRESS_COUNTER);
+    ret = spiWriteCmd(fd, 0x24);
+    if (ret < 0) {
+        Log_Debug("ERROR : EPD_Stream_Begin_2in9 : WRITE_RAM CMD Bytes Tfr ERROR\n");
+        return ExitCode_SPI_WriteData;
+    }
+    EPD_Telemetry_Phase(fd, EPD_TEL_WINDOW, start);
+    return ExitCode_Success;
+}
+
+/******************************************************************************
+function    : Fills and sends the next chunk of the window in one SPI transfer
+parameter   :
+       Stream :   Stream started by EPD_Stream_Begin_2in9
+return      : No of rows still to be sent, or -1 on SPI Error
+******************************************************************************/
+int EPD_Stream_Next_2in9(EPD_STREAM *Stream) {
+    uint32_t start = EPD_Telemetry_Now_Us();
+    uint16_t rows = Stream->Yend - Stream->Y;
+    if (rows == 0) {
+        return 0;
+    }
+    if (rows > EPD_CHUNK_ROWS) {
+        rows = EPD_CHUNK_ROWS;
+    }
+
+    Stream->Fill(Stream->Ctx, Stream->Chunk, Stream->Xbyte, Stream->WidthByte, Stream->Y, rows);
+    EPD_Ghost_Account(EPD_Panel(Stream->Fd), Stream->Chunk, Stream->Xbyte, Stream->WidthByte, Stream->Y, rows);
+
+    uint32_t len = (uint32_t)rows * Stream->WidthByte;
+    if (Spi_Write(Stream->Fd, EPD_DATA, Stream->Chunk, len) != (int)len) {
+        Log_Debug("ERROR : EPD_Stream_Next_2in9 : Error sending chunk at row %d\n", Stream->Y);
+        // LastFrame already holds the chunk, the panel RAM may not
+        EPD_Panel(Stream->Fd)->GhostFrameKnown = 0;
+        return -1;
+    }
+
+    EPD_Telemetry_Phase(Stream->Fd, EPD_TEL_UPLOAD, start);
+
+    Stream->Y += rows;
+    return Stream->Yend - Stream->Y;
+}
+
+#if EPD_STREAM_PIPELINE
+// SPI sender of the pipelined stream, one chunk in flight at a time. SPIMaster transfers block, 
+// so the overlap comes from a thread; it lives for the life of the app once started.
+typedef struct {
+    pthread_mutex_t Lock;
+    pthread_cond_t Cond;
+    pthread_t Thread;
+    uint8_t State;			// 0 not started, 1 running, 2 could not be started
+    uint8_t Pending;		// Chunk posted and not sent yet
+    int Fd;
+    uint8_t *Buf;
+    uint32_t Len;
+    int Result;				// Spi_Write of the last chunk
+} EPD_SPI_WORKER;
+
+static EPD_SPI_WORKER SpiWorker = { .Lock = PTHREAD_MUTEX_INITIALIZER, .Cond = PTHREAD_COND_INITIALIZER };
+
+static void *EPD_Spi_Worker(void *Arg) {
+    (void)Arg;
+    pthread_mutex_lock(&SpiWorker.Lock);
+    for (;;) {
+        while (!SpiWorker.Pending) {
+            pthread_cond_wait(&SpiWorker.Cond, &SpiWorker.Lock);
+        }
+        int fd = SpiWorker.Fd;
+        uint8_t *buf = SpiWorker.Buf;
+        uint32_t len = SpiWorker.Len;
+
+        pthread_mutex_unlock(&SpiWorker.Lock);
+        int result = Spi_Write(fd, EPD_DATA, buf, len);
+        pthread_mutex_lock(&SpiWorker.Lock);
+
+        SpiWorker.Result = result;
+        SpiWorker.Pending = 0;
+        pthread_cond_broadcast(&SpiWorker.Cond);
+    }
+    return NULL;
+}
+
+/******************************************************************************
+function    : Starts the SPI worker the first time
+return      : 0 if it runs, -1 if streams have to send their chunks themselves
+******************************************************************************/
+static int EPD_Spi_Worker_Start(void) {
+    if (SpiWorker.State == 0) {
+        SpiWorker.State = 2;
+        if (pthread_create(&SpiWorker.Thread, NULL, EPD_Spi_Worker, NULL) == 0) {
+            SpiWorker.State = 1;
+        } else {
+            Log_Debug("ERROR : EPD_Spi_Worker_Start : No worker thread (errno %d), chunks are sent without overlap\n", errno);
+        }
+    }
+    return (SpiWorker.State == 1) ? 0 : -1;
+}
+
+/******************************************************************************
+function    : Hands a chunk to the worker, the buffer must stay untouched till 
+              EPD_Spi_Worker_Wait
+******************************************************************************/
+static void EPD_Spi_Worker_Post(int fd, uint8_t *Buf, uint32_t Len) {
+    pthread_mutex_lock(&SpiWorker.Lock);
+    SpiWorker.Fd = fd;
+    SpiWorker.Buf = Buf;
+    SpiWorker.Len = Len;
+    SpiWorker.Pending = 1;
+    pthread_cond_broadcast(&SpiWorker.Cond);
+    pthread_mutex_unlock(&SpiWorker.Lock);
+}
+
+/******************************************************************************
+function    : Waits till the posted chunk is sent
+return      : Spi_Write result of it
+******************************************************************************/
+static int EPD_Spi_Worker_Wait(void) {
+    int result;
+
+    pthread_mutex_lock(&SpiWorker.Lock);
+    while (SpiWorker.Pending) {
+        pthread_cond_wait(&SpiWorker.Cond, &SpiWorker.Lock);
+    }
+    result = SpiWorker.Result;
+    pthread_mutex_unlock(&SpiWorker.Lock);
+    return result;
+}
+
+/******************************************************************************
+function    : Sends the remaining chunks with the fill of a chunk overlapping the 
+              transfer of the one before, in the two chunk buffers of the stream
+parameter   :
+       Stream :   Stream started by EPD_Stream_Begin_2in9
+return      : Success Signal / Error Code
+******************************************************************************/
+static int EPD_Stream_Run_Pipelined(EPD_STREAM *Stream) {
+    uint32_t start = EPD_Telemetry_Now_Us();
+    uint8_t *bufs[2] = { Stream->Chunk, Stream->Spare };
+    uint8_t cur = 0;
+    uint32_t sentLen = 0;	// Length of the chunk in flight, 0 for none
+    uint16_t sentY = 0;
+    int ret = ExitCode_Success;
+
+    while (Stream->Y < Stream->Yend) {
+        uint16_t rows = Stream->Yend - Stream->Y;
+        if (rows > EPD_CHUNK_ROWS) {
+            rows = EPD_CHUNK_ROWS;
+        }
+
+        // Runs while the worker is sending the other buffer
+        Stream->Fill(Stream->Ctx, bufs[cur], Stream->Xbyte, Stream->WidthByte, Stream->Y, rows);
+        EPD_Ghost_Account(EPD_Panel(Stream->Fd), bufs[cur], Stream->Xbyte, Stream->WidthByte, Stream->Y, rows);
+
+        if (sentLen > 0 && EPD_Spi_Worker_Wait() != (int)sentLen) {
+            Log_Debug("ERROR : EPD_Stream_Run_2in9 : Error sending chunk at row %d\n", sentY);
+            sentLen = 0;
+            ret = ExitCode_SPI_WriteData;
+            break;
+        }
+
+        sentLen = (uint32_t)rows * Stream->WidthByte;
+        sentY = Stream->Y;
+        EPD_Spi_Worker_Post(Stream->Fd, bufs[cur], sentLen);
+        Stream->Y += rows;
+        cur ^= 1;
+    }
+
+    if (sentLen > 0 && EPD_Spi_Worker_Wait() != (int)sentLen) {
+        Log_Debug("ERROR : EPD_Stream_Run_2in9 : Error sending chunk at row %d\n", sentY);
+        ret = ExitCode_SPI_WriteData;
+    }
+
+    EPD_Telemetry_Phase(Stream->Fd, EPD_TEL_UPLOAD, start);
+    return ret;
+}
+#endif
+
+/******************************************************************************
+function    : Sends all the remaining chunks of the window, pipelined when 
+              EPD_STREAM_PIPELINE is set and the worker thread runs. A whole 
+              panel window sent without error makes the ghosting scheduler's 
+              copy of the panel complete, a failed one leaves it unknown.
+parameter   :
+       Stream :   Stream started by EPD_Stream_Begin_2in9
+return      : Success Signal / Error Code
+******************************************************************************/
+int EPD_Stream_Run_2in9(EPD_STREAM *Stream) {
+    EPD_PANEL *P = EPD_Panel(Stream->Fd);
+    uint8_t whole = (Stream->Xbyte == 0 && Stream->WidthByte == EPD_WidthByte && Stream->Y == 0 && Stream->Yend == EPD_HeightByte);
+    int ret;
+
+#if EPD_STREAM_PIPELINE
+    if (EPD_Spi_Worker_Start() == 0) {
+        ret = EPD_Stream_Run_Pipelined(Stream);
+    } else
+#endif
+    {
+        int left;
+        do {
+            left = EPD_Stream_Next_2in9(Stream);
+        } while (left > 0);
+        ret = (left < 0) ? ExitCode_SPI_WriteData : ExitCode_Success;
+    }
+
+    if (ret != ExitCode_Success) {
+        P->GhostFrameKnown = 0;
+    } else if (whole) {
+        P->GhostFrameKnown = 1;
+    }
+    return ret;
+}
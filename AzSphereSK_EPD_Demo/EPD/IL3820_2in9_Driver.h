@@ -10,6 +10,28 @@
 * | Date        :   2020-05-08
 * | Info        :
 * -----------------------------------------------------------------------------
+* Change Log V1.3 (2026-10-19):
+* 1. Added : Chunked frame streaming, EPD_Display_Image/Clear now send a block of rows per SPI transfer
+* 2. Added : Layer compositor, const flash images and RAM overlays are merged while uploading
+* 3. Added : Rotated upload, a canvas kept in landscape row order is transposed in 8x8 blocks while uploading
+* 4. Added : Waveform (LUT) registry, user and fast partial LUTs, LUT switch without re-init
+* 5. Fixed : u8g2 LUTs were sent with the 0x32 command byte as their first value
+* 6. Added : Temperature compensation, TEMPERATURE_SENSOR_CONTROL and per band LUT / frame timing
+* 7. Added : Power state tracking and register shadowing, unchanged registers / LUT are not resent
+*            and Display_Init_2in9 resets and initialiazes the display only once
+* 8. Added : Init, sleep and turn on as command sequence tables, one transfer per command
+* 9. Added : Ghosting scheduler, per tile flip counts turn a partial update into a full refresh
+*            when needed. Replaces NoBurnLoop
+* 10. Added : Several displays at once (EPD_Device_Open), the driver state is kept per display and 
+*             updates of different displays overlap
+* 11. Added : EPD_Sequence_2in9, the init / sleep / turn on tables for the Real Time core EPD engine
+*             (EPD_Remote.c, RealTimeCore/epd_engine.c)
+* 12. Added : Per refresh telemetry (EPD_Telemetry.c), phase times, SPI / GPIO counts and a report 
+*             per full or partial refresh
+* 13. Added : Energy estimate and budget scheduler (EPD_Energy.c), fed with every refresh and power change
+* 14. Added : Pipelined streaming, the next chunk is filled while a worker thread sends the previous one
+* 15. Added : EPD_Display_Rects_2in9, partial update uploading only the changed rectangles (Tools/Widgets)
+* -----------------------------------------------------------------------------
 * Change Log V1.2 (2020-05-08):
 * 1. Added : GFx lib ( provided as Paint lib by Waveshare ) 
 *		   : Font 8,12, 16, 20, 24 Support added (Will add bigger fonts later 
@@ -41,6 +63,8 @@
 # THE SOFTWARE.
 ******************************************************************************/
 #ifdef  EPD_2in9_H	
+#ifndef IL3820_2IN9_DRIVER_H
+#define IL3820_2IN9_DRIVER_H
 
 //Global Includes
 #include <errno.h>
@@ -61,16 +85,84 @@ extern uint16_t max_h, max_w;
 #define EPD_2in9_WIDTH 128
 #define EPD_2in9_HEIGHT 296
 
-#define EPD_WidthByte (EPD_2in9_WIDTH % 8 == 0) ? (EPD_2in9_WIDTH / 8) : (EPD_2in9_WIDTH / 8 + 1);	// used to combine Pixels in 8 pixel =  1 byte format
+#define EPD_WidthByte ((EPD_2in9_WIDTH % 8 == 0) ? (EPD_2in9_WIDTH / 8) : (EPD_2in9_WIDTH / 8 + 1))	// used to combine Pixels in 8 pixel =  1 byte format
 #define EPD_HeightByte EPD_2in9_HEIGHT
 
-#define EPD_ByteBuffer EPD_WidthByte * EPD_HeightByte	
-#define EPD_Buffer EPD_2in9_WIDTH * EPD_2in9_HEIGHT
+#define EPD_ByteBuffer (EPD_WidthByte * EPD_HeightByte)
+#define EPD_Buffer (EPD_2in9_WIDTH * EPD_2in9_HEIGHT)
+
+// No of RAM rows sent in one SPI transfer while streaming a frame.
+// Keep it a multiple of 8 so 8x8 pixel blocks never straddle two chunks.
+#ifndef EPD_CHUNK_ROWS
+#define EPD_CHUNK_ROWS 32
+#endif
+#define EPD_CHUNK_BYTES (EPD_CHUNK_ROWS * EPD_WidthByte)
+
+// 1 : EPD_Stream_Run_2in9 fills the next chunk while an SPI worker thread sends the previous one,
+// a frame then takes about max(fill, transfer) instead of their sum. Costs a second chunk buffer.
+#ifndef EPD_STREAM_PIPELINE
+#define EPD_STREAM_PIPELINE 1
+#endif
+
+// Ghosting scheduler. Pixel flips are counted per tile, a partial update becomes a full refresh 
+// once a tile has flipped EPD_GHOST_FLIPS pixels or EPD_GHOST_AGE_S seconds passed with flips pending.
+#define EPD_GHOST_TILE_BYTES	2		// Tile width in bytes, 16 pixels
+#define EPD_GHOST_TILE_ROWS		16		// Tile height in rows
+#define EPD_GHOST_TILES_X		((EPD_WidthByte + EPD_GHOST_TILE_BYTES - 1) / EPD_GHOST_TILE_BYTES)
+#define EPD_GHOST_TILES_Y		((EPD_HeightByte + EPD_GHOST_TILE_ROWS - 1) / EPD_GHOST_TILE_ROWS)
+#ifndef EPD_GHOST_FLIPS
+#define EPD_GHOST_FLIPS			1024	// Default limit, 4 flips of every pixel of a 16x16 tile
+#endif
+#ifndef EPD_GHOST_AGE_S
+#define EPD_GHOST_AGE_S			3600	// Default limit, an hour
+#endif
 
 #define WaveShare_2in9_EPD_FULL			0
 #define WaveShare_2in9_EPD_PART			1
 #define U8G2_2in9_EPD_FULL				2
 #define U8G2_2in9_EPD_PART				3
+#define EPD_2in9_FAST_PART				4	// Short frame partial LUT, see EPD_2IN9_lut_fast_partial_update
+
+// Waveform registry
+#define EPD_LUT_SIZE			30	// Bytes of WRITE_LUT_REGISTER
+#define EPD_WAVEFORM_BUILTIN	5	// Ids 0..4 above
+#ifndef EPD_WAVEFORM_MAX
+#define EPD_WAVEFORM_MAX		8	// Built in + user waveforms
+#endif
+
+// Command sequences are const byte tables of entries : Command, Length | Flags, Length parameters, 
+// then one delay byte (ms) if EPD_SEQ_DELAY is set. Ends with EPD_SEQ_END.
+// The end marker is a NOP (0xFF) with every flag and 63 parameters, so that entry is reserved; 
+// a NOP takes no parameters and is never sent with them.
+#define EPD_SEQ_DELAY		0x80	// Wait the delay byte in ms after the command
+#define EPD_SEQ_BUSY		0x40	// Wait for BUSY after the command (and delay)
+#define EPD_SEQ_LEN			0x3F	// Parameter count, up to 63
+#define EPD_SEQ_END_CMD		0xFF
+#define EPD_SEQ_END_FLAGS	0xFF
+#define EPD_SEQ_END			EPD_SEQ_END_CMD, EPD_SEQ_END_FLAGS
+
+// Built in tables of EPD_Sequence_2in9
+#define EPD_SEQUENCE_INIT		0
+#define EPD_SEQUENCE_SLEEP		1
+#define EPD_SEQUENCE_TURN_ON	2
+
+// Power state of the display, tracked by the driver
+#define EPD_POWER_OFF		0	// Not initialiazed yet, register contents unknown
+#define EPD_POWER_SLEEP		1	// Deep sleep, needs a hardware reset to wake
+#define EPD_POWER_AWAKE		2	// Initialiazed, the shadowed registers match the display
+
+// Waveform flags
+#define EPD_WAVEFORM_FULL		0x01	// Full update, drives every pixel, clears ghosting
+#define EPD_WAVEFORM_PART		0x02	// Partial update, only changed pixels are driven
+#define EPD_WAVEFORM_FAST		0x04	// Short frames, quick but leaves more ghosting
+
+// A LUT with what it is good for
+typedef struct {
+    const uint8_t *Lut;		// EPD_LUT_SIZE bytes, without the 0x32 command byte
+    uint16_t RefreshMs;		// Expected time of one update with this LUT
+    uint8_t Flags;			// EPD_WAVEFORM_xxx
+    const char *Name;
+} EPD_WAVEFORM;
 
 
 #define EPD_2in9_ORIENT_POTRAIT 0 // Sets Potrait Orient 
@@ -102,17 +194,103 @@ extern uint16_t max_h, max_w;
 #define  SET_RAM_Y_ADDRESS_COUNTER 0x4F
 #define  TERMINATE_FRAME_READ_WRITE 0xFF
 
+// Layer blend modes used by the upload compositor
+#define EPD_LAYER_COPY	0	// Layer pixels replace everything below
+#define EPD_LAYER_INK	1	// Only black pixels of the layer are drawn, white is transparent
+#define EPD_LAYER_MASK	2	// Pixels are taken from the layer where Mask bit is 1
+
+// One layer of a composed frame. All images are in the panel memory layout (8 pixels = 1 byte, 
+// WidthByte bytes per row) and are read in place, so a const image stays in flash.
+typedef struct {
+    const uint8_t *Image;	// Layer pixels
+    const uint8_t *Mask;	// Only for EPD_LAYER_MASK, same layout as Image; NULL acts as EPD_LAYER_COPY
+    uint16_t Xbyte;			// Position on the panel, X in bytes (8 pixel steps)
+    uint16_t Ystart;		// Position on the panel, Y in rows
+    uint16_t WidthByte;		// Layer width in bytes, also the row stride of Image and Mask
+    uint16_t Height;		// Layer height in rows
+    uint8_t Mode;			// EPD_LAYER_COPY / EPD_LAYER_INK / EPD_LAYER_MASK
+} EPD_LAYER;
+
+// Part of the panel RAM, X in bytes (8 pixel steps)
+typedef struct {
+    uint16_t Xbyte;
+    uint16_t Ystart;
+    uint16_t WidthByte;
+    uint16_t Height;
+} EPD_RECT;
+// Waveform and frame timing used from MinTemp up to the MinTemp of the next band
+typedef struct {
+    int8_t MinTemp;			// C
+    uint8_t FullWaveform;	// Waveform ids
+    uint8_t PartWaveform;
+    uint8_t DummyLine;		// SET_DUMMY_LINE_PERIOD (0x3A)
+    uint8_t GateTime;		// SET_GATE_TIME (0x3B)
+} EPD_TEMP_BAND;
+
+// Gives the temperature in C, returns 0 on Success
+typedef int (*EPD_TEMP_SOURCE)(void *Ctx, int8_t *TempC);
+
+// Fills Rows x WidthByte bytes of Chunk with the RAM content starting at (Xbyte, Ystart)
+typedef void (*EPD_FILL_ROWS)(void *Ctx, uint8_t *Chunk, uint16_t Xbyte, uint16_t WidthByte, uint16_t Ystart, uint16_t Rows);
+
+// State of a RAM window being streamed to the display, one chunk of rows per SPI transfer
+typedef struct {
+    int Fd;
+    uint16_t Xbyte;
+    uint16_t WidthByte;
+    uint16_t Y;				// Next row to be sent
+    uint16_t Yend;			// One past the last row of the window
+    EPD_FILL_ROWS Fill;
+    void *Ctx;
+    uint8_t Chunk[EPD_CHUNK_BYTES];
+#if EPD_STREAM_PIPELINE
+    uint8_t Spare[EPD_CHUNK_BYTES];	// Filled while Chunk is on the wire, and the other way round
+#endif
+} EPD_STREAM;
+
 // User Functions
 int EPD_Init_2in9(int fd, uint8_t Mode);	// Main function that initialiazes the display and sets the LUT.
 int EPD_Clear_2in9(int fd);		//Clears the Display 				
-int EPD_Display_Image_2in9(int fd, uint8_t* Image);		// Used to display an image on EPD, max resolution is 128x296
+int EPD_Display_Image_2in9(int fd, const uint8_t* Image);		// Used to display an image on EPD, max resolution is 128x296
+int EPD_Display_Layers_2in9(int fd, const EPD_LAYER* Layers, uint8_t Count);	// Composes the layers while uploading and displays the result
+int EPD_Display_Rotated_2in9(int fd, const uint8_t* Image, uint16_t Rotate, uint8_t Mirror);	// Displays a native (landscape) canvas, rotated while uploading
+int EPD_Display_Rects_2in9(int fd, const uint8_t* Image, const EPD_RECT* Rects, uint8_t Count);	// Uploads only the changed rectangles of a frame and displays it
 int EPD_Sleep_2in9(int fd);		// Display enters Sleep Mode 
 int EPD_Wake_2in9(int fd, uint8_t mode);		// Wakes the Display from Sleep
 int EPD_Turn_On_Display_2in9(int fd);	// Displays the on chip image buffer on the EPD Pannel. Pl fill buffer before using this function. 
+int EPD_Update_Start_2in9(int fd);	// EPD_Turn_On_Display_2in9 without waiting, the next command to the display waits
+int EPD_Update_Wait_2in9(int fd);	// Waits for the update started by EPD_Update_Start_2in9
+int EPD_Display_Multi_2in9(const int* Fds, const uint8_t* const* Images, uint8_t Count);	// One image per display, the updates run together
 //int EPD_Set_Orientation_2in9(int orient);	// Sets the Orientation of the Display 
 int EPD_Set_Cursor_2in9(int fd, uint16_t Xs, uint16_t Ys);	// Sets the drawing cursor 
 int EPD_Set_Display_Area_2in9(int fd, uint16_t Xs, uint16_t Ys, uint16_t Xe, uint16_t Ye);	// Sets the drawing display Area
 int Display_Init_2in9(int fd, int Mode);	// Overall display Initialiazation function 
-int NoBurnLoop(int fd);
+int EPD_Set_Ghost_Limits_2in9(uint16_t FlipLimit, uint32_t MaxAgeS);	// 0 turns a limit off, both 0 turn the scheduler off
+int EPD_Ghost_Due_2in9(int fd);	// 1 if the next update will be a full refresh
+uint8_t EPD_Update_Kind_2in9(int fd);	// EPD_ENERGY_xxx of the next update, for EPD_Energy_Due
+int EPD_Run_Sequence_2in9(int fd, const uint8_t *Seq);	// Sends a command sequence table, each command with its parameters in one transfer
+const uint8_t *EPD_Sequence_2in9(uint8_t Id);	// Built in sequence table, EPD_SEQUENCE_xxx, e.g. for the Real Time core engine
+int EPD_Power_State_2in9(int fd);		// EPD_POWER_xxx
+void EPD_Invalidate_2in9(int fd);		// Forgets the shadowed registers, if the display was reset outside the driver
+
+// Waveforms, EPD_Set_Waveform_2in9 only rewrites the LUT register so it is cheap to switch
+int EPD_Register_Waveform_2in9(const EPD_WAVEFORM *Waveform);	// Returns the id of the new waveform
+const EPD_WAVEFORM *EPD_Get_Waveform_2in9(uint8_t Id);
+int EPD_Set_Waveform_2in9(int fd, uint8_t Id);	// Loads a waveform LUT
+int EPD_Active_Waveform_2in9(int fd);
+
+// Temperature compensation, picks the waveforms and frame timing of the temperature band
+int EPD_Set_Temperature_2in9(int fd, int8_t TempC);	// Temperature supplied by the application
+void EPD_Set_Temp_Source_2in9(EPD_TEMP_SOURCE Source, void *Ctx);	// Or read from a sensor
+int EPD_Update_Temperature_2in9(int fd);	// Reads the source and applies it
+void EPD_Set_Temp_Bands_2in9(const EPD_TEMP_BAND *Bands, uint8_t Count);
+uint8_t EPD_Full_Waveform_2in9(int fd);	// Waveforms of the current band
+uint8_t EPD_Part_Waveform_2in9(int fd);
+
+// Frame streaming, used by the Display functions above
+int EPD_Stream_Begin_2in9(EPD_STREAM *Stream, int fd, uint16_t Xbyte, uint16_t Ystart, uint16_t WidthByte, uint16_t Height, EPD_FILL_ROWS Fill, void *Ctx);
+int EPD_Stream_Next_2in9(EPD_STREAM *Stream);	// Sends the next chunk, returns rows left to send
+int EPD_Stream_Run_2in9(EPD_STREAM *Stream);	// Sends all remaining chunks, pipelined with EPD_STREAM_PIPELINE
 
+#endif
 #endif
\ No newline at end of file
@@ -54,6 +54,15 @@
 #include "../EPD/ImageData.h"
 #include "../Tools/GFX/Gfx.h"
 #include "../Tools/QRcode/qrcode.h"
+#include "../Tools/QRcode/qrcode_gfx.h"
+#include "../Tools/QRcode/qrcode_cache.h"
+#include "../EPD/EPD_Remote.h"
+#include "../EPD/EPD_Telemetry.h"
+#include "../EPD/EPD_Energy.h"
+#include "../EPD/EPD_Band.h"
+#include "../Tools/Log/Log.h"
+#include "../Tools/Arena/Arena.h"
+#include "../Tools/Widgets/Widget.h"
 
 // Defines which all demos would be exicuted
 #define QR_DEMO
@@ -61,6 +70,10 @@
 #define GFX_DEMO
 #define PART_ANIME_DEMO
 #define PART_TIME_DEMO
+//#define DUAL_PANEL_DEMO    // Needs a second display on click slot 2
+//#define RT_OFFLOAD_DEMO    // The Real Time core drives the display, see Readme
+//#define BAND_DEMO          // The GFX demo is drawn band by band, without a frame buffer
+//#define WIDGET_DEMO        // Sensor screen of widgets, only the changed ones are uploaded
 
 // Spi File Discripter that will be used universally accross the Lib 
 // (Ideally set it to -1 during inititialiazation in main())
@@ -69,6 +82,38 @@ int qr_symble_size;
 static char* myGithub = "http://gsgill112.github.io/";
 QRCode qrcode;
 
+#ifdef GFX_DEMO
+// Drawing calls of the GFX demo, into BlackImage or band by band (EPD_BAND_DRAW)
+static void Gfx_Demo_Draw(void* Ctx)
+{
+    (void)Ctx;
+    Paint_DrawPoint(230, 10, BLACK, DOT_PIXEL_1X1, DOT_STYLE_DFT);
+    Paint_DrawPoint(230, 30, BLACK, DOT_PIXEL_2X2, DOT_STYLE_DFT);
+    Paint_DrawPoint(260, 20, BLACK, DOT_PIXEL_3X3, DOT_STYLE_DFT);
+
+    Paint_DrawLine(170, 70, 220, 120, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+    Paint_DrawLine(220, 70, 170, 120, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
+
+    Paint_DrawRectangle(170, 70, 220, 120, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    Paint_DrawRectangle(230, 70, 280, 120, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+
+    Paint_DrawCircle(195, 95, 20, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+    Paint_DrawCircle(255, 95, 20, WHITE, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+
+    Paint_DrawLine(230, 95, 280, 95, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+    Paint_DrawLine(255, 75, 255, 115, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
+
+    Paint_DrawString_EN(10, 0, "Hello From", &Font24, WHITE, BLACK);
+    Paint_DrawString_EN(10, 30, "Tech", &Font24, WHITE, BLACK);
+    Paint_DrawString_EN(80, 30, "NERVERS", &Font24, BLACK, WHITE);
+
+    Paint_DrawNum(10, 60, 123456789, &Font8, BLACK, WHITE);
+    Paint_DrawNum(10, 70, 987654321, &Font12, WHITE, BLACK);
+    Paint_DrawNum(10, 85, 123456789, &Font16, BLACK, WHITE);
+    Paint_DrawNum(10, 100, 987654321, &Font20, WHITE, BLACK);
+}
+#endif
+
 // Main Function 
 int main(void)
 {
@@ -82,7 +127,11 @@ int main(void)
     uint16_t HeightByte = EPD_HeightByte;
 
     uint16_t Imagesize = WidthByte * HeightByte;
-    BlackImage = (uint8_t*)malloc(Imagesize);
+    // From the static arena, kept for the life of the app
+    BlackImage = (uint8_t*)Arena_Alloc_Lifetime(ARENA_FRAME, Imagesize);
+    if (BlackImage == NULL) {
+        return -1;
+    }
     //Creating a new Paint Object 
     Paint_NewImage(BlackImage, EPD_2in9_WIDTH, EPD_2in9_HEIGHT, 90, WHITE);
     // Selecting the Above Defined image 
@@ -91,82 +140,75 @@ int main(void)
     // Using Avnet SK Blue LED as a simple Blinky 
     int Ledfd = GPIO_OpenAsOutput(AVNET_MT3620_SK_USER_LED_BLUE, GPIO_OutputMode_PushPull, GPIO_Value_High);
 
+#ifdef RT_OFFLOAD_DEMO
+    // The Real Time core owns SPI, reset and BUSY, this app only renders and sends frames. 
+    // The display GPIOs and ISU1 have to move from this manifest to the Real Time app manifest.
+    EPD_REMOTE Remote;
+    if (EPD_Remote_Open(&Remote, EPD_RT_COMPONENT_ID) == 0) {
+        EPD_Remote_Init(&Remote, EPD_Sequence_2in9(EPD_SEQUENCE_INIT), EPD_Get_Waveform_2in9(WaveShare_2in9_EPD_FULL)->Lut);
+        EPD_Remote_Wait(&Remote, Remote.Seq);
+        EPD_Remote_Frame(&Remote, TechNerversLogo_2in9, EPD_Sequence_2in9(EPD_SEQUENCE_TURN_ON));
+
+        // The next frame is drawn while the Real Time core waits for the update
+        Paint_SelectImage(BlackImage);
+        Paint_Clear(WHITE);
+        Paint_DrawString_EN(10, 50, "Drawn while the", &Font16, WHITE, BLACK);
+        Paint_DrawString_EN(10, 70, "RT core updates", &Font16, WHITE, BLACK);
+        EPD_Remote_Wait(&Remote, Remote.Seq);
+        Log_Debug("RT core : update BUSY for %d ms\n", Remote.LastInfo.BusyUs / 1000);
+
+        EPD_Remote_Frame(&Remote, BlackImage, EPD_Sequence_2in9(EPD_SEQUENCE_TURN_ON));
+        EPD_Remote_Wait(&Remote, Remote.Seq);
+        EPD_Remote_Sequence(&Remote, EPD_Sequence_2in9(EPD_SEQUENCE_SLEEP), 0);
+    }
+#else
     // Initialiazing Spi and returns the given File Discripter.
     spiFd = AzSphere_Spi_Init(spiFd);
 
     // Initialiazing the Display 
     Display_Init_2in9(spiFd, WaveShare_2in9_EPD_FULL);
 
+    // Ambient temperature picks the LUTs and frame timing. The demo assumes room temperature, 
+    // feed it from a sensor with EPD_Set_Temp_Source_2in9() and EPD_Update_Temperature_2in9().
+    EPD_Set_Temperature_2in9(spiFd, 25);
+
     //Clearing the display 
     EPD_Clear_2in9(spiFd);
     delay_ms(1800);
 
 #ifdef GFX_DEMO
     // GFX Example
+    Log_Debug("GFX Demo\n");
+#ifdef BAND_DEMO
+    // Drawn once per band of EPD_CHUNK_ROWS panel rows, straight into the SPI chunk
+    EPD_Band_Display(spiFd, ROTATE_90, WHITE, Gfx_Demo_Draw, NULL);
+#else
     Paint_SelectImage(BlackImage);
     Paint_Clear(WHITE);
-
-    Paint_DrawPoint(230, 10, BLACK, DOT_PIXEL_1X1, DOT_STYLE_DFT);
-    Paint_DrawPoint(230, 30, BLACK, DOT_PIXEL_2X2, DOT_STYLE_DFT);
-    Paint_DrawPoint(260, 20, BLACK, DOT_PIXEL_3X3, DOT_STYLE_DFT);
-
-    Paint_DrawLine(170, 70, 220, 120, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
-    Paint_DrawLine(220, 70, 170, 120, BLACK, DOT_PIXEL_1X1, LINE_STYLE_SOLID);
-
-    Paint_DrawRectangle(170, 70, 220, 120, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
-    Paint_DrawRectangle(230, 70, 280, 120, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
-
-    Paint_DrawCircle(195, 95, 20, BLACK, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
-    Paint_DrawCircle(255, 95, 20, WHITE, DOT_PIXEL_1X1, DRAW_FILL_FULL);
-
-    Paint_DrawLine(230, 95, 280, 95, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
-    Paint_DrawLine(255, 75, 255, 115, BLACK, DOT_PIXEL_1X1, LINE_STYLE_DOTTED);
-
-    Paint_DrawString_EN(10, 0, "Hello From", &Font24, WHITE, BLACK);
-    Paint_DrawString_EN(10, 30, "Tech", &Font24, WHITE, BLACK);
-    Paint_DrawString_EN(80, 30, "NERVERS", &Font24, BLACK, WHITE);
-
-    Paint_DrawNum(10, 60, 123456789, &Font8, BLACK, WHITE);
-    Paint_DrawNum(10, 70, 987654321, &Font12, WHITE, BLACK);
-    Paint_DrawNum(10, 85, 123456789, &Font16, BLACK, WHITE);
-    Paint_DrawNum(10, 100, 987654321, &Font20, WHITE, BLACK);
-    Log_Debug("GFX Demo\n");
-
+    Gfx_Demo_Draw(NULL);
     EPD_Display_Image_2in9(spiFd, BlackImage);
+#endif
     delay_ms(1800);
 #endif 
 
 #ifdef QR_DEMO
     
     //generating QR Code
-    // Will store the generated qr_code in : uint8_t generated_qr_Code[];
-    uint8_t generated_qr_Code[qrcode_getBufferSize(3)];
-    qrcode_initText(&qrcode, generated_qr_Code, 3, 0, myGithub);
-
-    uint8_t vspacing = 0;
-    uint8_t hspacing = 0;
-    const uint8_t PixelSize = 4;
-    const uint8_t xStart = 10;
-    const uint8_t yStart = 5;
+    // Smallest version that fits the link with at least Low ECC, the ECC is raised if the version has room.
+    // The code is kept in the QR cache, drawing the same link again is a copy of the cached bitmap.
+    const uint8_t QuietZone = 1;
+    QRCode* qrLink = qrcode_cacheGet((const uint8_t*)myGithub, strlen(myGithub), 0, ECC_LOW);
 
     Paint_SelectImage(BlackImage);
     Paint_Clear(WHITE);
-    for (uint8_t y = 0; y < qrcode.size; y++) {
-        // Each horizontal module
-        for (uint8_t x = 0; x < qrcode.size; x++) {
-
-            // Print each module (UTF-8 \u2588 is a solid block)
-            // Serial.print(qrcode_getModule(&qrcode, x, y) ? "\u2588\u2588" : "  ");
-            if (qrcode_getModule(&qrcode, x, y)) {
-                Paint_DrawPoint(xStart + hspacing, yStart + vspacing, BLACK, DOT_PIXEL_4X4, DOT_STYLE_DFT);
-            }
-            else {
-                Paint_DrawPoint(xStart + hspacing, yStart + vspacing, WHITE, DOT_PIXEL_4X4, DOT_STYLE_DFT);
-            }
-            hspacing += PixelSize;
-}
-        hspacing = 0;
-        vspacing += PixelSize;
+    if (qrLink != NULL) {
+        // Biggest modules that fit the 128 px high screen with a 1 module quiet zone 
+        const uint8_t PixelSize = EPD_2in9_WIDTH / (qrLink->size + 2 * QuietZone);
+        const uint8_t xStart = 10;
+        const uint8_t yStart = (EPD_2in9_WIDTH - QRCODE_GFX_SIDE(qrLink, PixelSize, QuietZone)) / 2;
+        Paint_DrawQRCodeCached((const uint8_t*)myGithub, strlen(myGithub), 0, ECC_LOW, xStart, yStart, PixelSize, QuietZone);
+    } else {
+        Log_Debug("ERROR : QR Demo : Link does not fit in a QR Code\n");
     }
     Paint_DrawString_EN(EPD_2in9_HEIGHT / 2 - 10, 50, "QR DEMO", &Font24, WHITE, BLACK);
     EPD_Display_Image_2in9(spiFd, BlackImage);
@@ -174,33 +216,42 @@ int main(void)
 #endif
 
 #ifdef IMAGE_DEMO
-    uint16_t  x, y;
-    uint32_t Addr = 0;
-    
     // Image 1 : WaveShare Logo 
     
-    // This step is necessary for conversion of 8 pixels into the corrent format as defined by the EPD Init function.
-    // Not Necessory if you are using Image2Lcd for converting your own images on the display as they are already 8 bits wide.  
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            BlackImage[Addr] = WaveShareLogo_2in9[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-        }
+    // The logo is displayed straight from flash, a small RAM overlay is composed on top of it while uploading.
+    // The overlay is the top 24px strip of the landscape screen, i.e. the last 3 byte columns of the panel RAM.
+    ARENA_MARK OverlayScope = Arena_Mark();
+    uint8_t* OverlayImage = (uint8_t*)Arena_Alloc(ARENA_BAND, 3 * EPD_HeightByte);
+    if (OverlayImage == NULL) {
+        return -1;
     }
-    
+    Paint_NewImage(OverlayImage, 3 * 8, EPD_2in9_HEIGHT, 90, WHITE);
+    Paint_SelectImage(OverlayImage);
+    Paint_Clear(WHITE);
+    Paint_DrawString_EN(170, 4, "Layer Demo", &Font16, WHITE, BLACK);
+
+    EPD_LAYER LogoLayers[] = {
+        { WaveShareLogo_2in9, NULL, 0, 0, EPD_WidthByte, EPD_HeightByte, EPD_LAYER_COPY },
+        { OverlayImage, NULL, EPD_WidthByte - 3, 0, 3, EPD_HeightByte, EPD_LAYER_INK },
+    };
+
     // Displays the Image 
     Log_Debug("WaveShare Logo Demo\n");
-    EPD_Display_Image_2in9(spiFd, BlackImage);
+    EPD_Display_Layers_2in9(spiFd, LogoLayers, 2);
+    Arena_Release(OverlayScope);
     delay_ms(1800);
 
+    // Back to the full screen image 
+    Paint_NewImage(BlackImage, EPD_2in9_WIDTH, EPD_2in9_HEIGHT, 90, WHITE);
+    Paint_SelectImage(BlackImage);
 
     // Image 2 : Technervers Logo 
     EPD_Display_Image_2in9(spiFd, TechNerversLogo_2in9);
     delay_ms(1800);
 #endif 
 
-    //Initialiazing the Display in Partial Mode TEST 1
-    EPD_Init_2in9(spiFd, WaveShare_2in9_EPD_PART);
+    // Switching to the Partial update LUT, only the LUT register is rewritten
+    EPD_Set_Waveform_2in9(spiFd, WaveShare_2in9_EPD_PART);
 
 #ifdef PART_TIME_DEMO
     // Clearing the Display 
@@ -210,6 +261,9 @@ int main(void)
     EPD_Clear_2in9(spiFd);
     delay_ms(1800);
     Log_Debug("Compleated Image Clear process\n");
+    // The clock is drawn on a landscape row-major canvas, so the windows below are cleared a byte at a time.
+    // The canvas is rotated to the panel layout while uploading.
+    Paint_SetLayout(PAINT_LAYOUT_NATIVE);
     Paint_ClearWindows(0, 0, EPD_2in9_HEIGHT, EPD_2in9_WIDTH, WHITE); // This is to fill the buffer with All white pixels as the EPD will use its RAM Buffer 
     //On Screen Clock using Partial Display 
     PAINT_TIME sPaint_time;
@@ -217,6 +271,13 @@ int main(void)
     sPaint_time.Min = 34;
     sPaint_time.Sec = 56;
     uint8_t num = 20;
+    // The clock only changes a few digits, so it uses the partial LUT of the temperature band.
+    // EPD_2in9_FAST_PART can be set here instead for shorter, more ghosting prone updates. The driver 
+    // turns one of the updates into a full refresh once the digits have flipped enough to leave ghosts.
+    EPD_Set_Waveform_2in9(spiFd, EPD_Part_Waveform_2in9(spiFd));
+    // On battery, limit the refreshes : ticks held back by the budget are shown with a later one
+    //EPD_ENERGY_BUDGET budget = { 200000, 120, 0 };   // 0.2 J and 120 refreshes per hour
+    //EPD_Energy_Set_Budget(&budget);
     for (;;) {
         sPaint_time.Sec = sPaint_time.Sec + 1;
         if (sPaint_time.Sec == 60) {
@@ -234,210 +295,99 @@ int main(void)
         }
         Paint_ClearWindows(100, 50, 100 + Font24.Width * 7, 50 + Font24.Height, WHITE);
         Paint_DrawTime(100, 50, &sPaint_time, &Font24, WHITE, BLACK);
+        EPD_Energy_Submit(spiFd, 0);
 
         num = num - 1;
         if (num == 0) {
             break;
         }
-        EPD_Display_Image_2in9(spiFd, BlackImage);
+        if (EPD_Energy_Due(spiFd, EPD_Update_Kind_2in9(spiFd))) {
+            EPD_Display_Rotated_2in9(spiFd, BlackImage, Paint.Rotate, Paint.Mirror);
+            Log_Debug("Partial Refresh\n");
+        }
+        Log_Drain(0);  // Driver and Gfx records of this update, outside the timed part
         delay_ms(500);//Analog clock 500ms
-        Log_Debug("Partial Refresh\n");
     }
+    EPD_Set_Waveform_2in9(spiFd, WaveShare_2in9_EPD_PART);
 #endif
 #ifdef PART_ANIME_DEMO
-    //clearing the display 
-    Paint_ClearWindows(0, 0, EPD_2in9_HEIGHT, EPD_2in9_WIDTH, WHITE);
-    
     // Horse Animation Trial 
-    // Image is 200x125 Px 
-    // Because of the image size & the fact that the image background is white 
-    // I am looping to fill the remaining bytes with 0xFF; to avoid the ghost of the image from the 
-    // EPD Buffer.
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if(Addr < 3200)
-                BlackImage[Addr] = gImage_1[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_2[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_3[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_4[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_5[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_6[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_7[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_8[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_9[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
+    // Image is 200x125 Px, i.e. the first 3200 bytes of the panel RAM. 
+    // The frames are uploaded straight from flash as a single layer, the compositor fills the rest 
+    // of the RAM with white to avoid the ghost of the image from the EPD Buffer.
+    const unsigned char* HorseFrames[] = {
+        gImage_1, gImage_2, gImage_3, gImage_4, gImage_5, gImage_6, gImage_7,
+        gImage_8, gImage_9, gImage_10, gImage_11, gImage_12, gImage_13
+    };
+    for (uint8_t frame = 0; frame < sizeof(HorseFrames) / sizeof(HorseFrames[0]); frame++) {
+        EPD_LAYER Horse = { HorseFrames[frame], NULL, 0, 0, EPD_WidthByte, 3200 / EPD_WidthByte, EPD_LAYER_COPY };
+        EPD_Display_Layers_2in9(spiFd, &Horse, 1);
+        //delay_ms(50);
     }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_10[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_11[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_12[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
-        }
-    }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    Paint_ClearWindows(0, 0, 205, EPD_2in9_WIDTH, WHITE);
-    for (y = 0; y < HeightByte; y++) {
-        for (x = 0; x < WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * WidthByte;
-            if (Addr < 3200)
-                BlackImage[Addr] = gImage_13[Addr]; //(Addr%5 == 0) ? 0xFF : 0x00;
-            if (Addr >= 3200)
-                BlackImage[Addr] = 0xFF;
+#endif 
+
+#ifdef WIDGET_DEMO
+    // Sensor screen. The app only updates the bound values, Widget_Refresh draws the widgets 
+    // whose value changed and uploads just their boxes for the partial update.
+    Paint_NewImage(BlackImage, EPD_2in9_WIDTH, EPD_2in9_HEIGHT, 90, WHITE);
+    Paint_SelectImage(BlackImage);
+    Paint_Clear(WHITE);
+    int32_t TempC = 21, Humidity = 40;
+    PAINT_TIME Now = { 2026, 10, 19, 12, 0, 0 };
+    WIDGET Screen[] = {
+        { .Type = WIDGET_LABEL, .X = 4,   .Y = 4,  .W = 140, .H = 16, .Color = BLACK, .Back = WHITE, .Font = &Font16, .Bind = "Temperature" },
+        { .Type = WIDGET_VALUE, .X = 4,   .Y = 24, .W = 140, .H = 24, .Color = BLACK, .Back = WHITE, .Font = &Font24, .Format = "%ld C", .Bind = &TempC },
+        { .Type = WIDGET_LABEL, .X = 4,   .Y = 56, .W = 140, .H = 16, .Color = BLACK, .Back = WHITE, .Font = &Font16, .Bind = "Humidity" },
+        { .Type = WIDGET_BAR,   .X = 4,   .Y = 76, .W = 140, .H = 14, .Color = BLACK, .Back = WHITE, .Min = 0, .Max = 100, .Bind = &Humidity },
+        { .Type = WIDGET_CLOCK, .X = 4,   .Y = 98, .W = 140, .H = 24, .Color = BLACK, .Back = WHITE, .Font = &Font24, .Bind = &Now },
+        { .Type = WIDGET_QR,    .X = 200, .Y = 20, .W = 93,  .H = 93, .Color = BLACK, .Back = WHITE, .Version = 3, .Ecc = ECC_LOW, .Scale = 3, .Bind = myGithub },
+    };
+    for (uint8_t tick = 0; tick < 10; tick++) {
+        Now.Sec += 5;
+        if (tick % 3 == 2) {
+            TempC++;
         }
+        Humidity = 40 + 4 * tick;
+        Widget_Refresh(spiFd, Screen, sizeof(Screen) / sizeof(Screen[0]));
+        Log_Drain(0);
+        delay_ms(500);
     }
-    EPD_Display_Image_2in9(spiFd, BlackImage);
-    //delay_ms(50);
-#endif 
+#endif
 
-    EPD_Init_2in9(spiFd, WaveShare_2in9_EPD_FULL);
+    EPD_Set_Waveform_2in9(spiFd, WaveShare_2in9_EPD_FULL);
     EPD_Clear_2in9(spiFd);
 
     // Image 3 Project QR
     EPD_Display_Image_2in9(spiFd, TechNerversLogo_2in9_2);
     delay_ms(1800);
 
-    Log_Debug("Image update process Compleated, Freeing the Memory \n");
-    free(BlackImage);
+#ifdef DUAL_PANEL_DEMO
+    // Signage on both click slots, the second display is uploaded while the first one updates 
+    // so both show their image in about the time of one update
+    int spiFd2 = AzSphere_Spi_Open_Slot(2);
+    EPD_Device_Open(spiFd2, 2);
+    Display_Init_2in9(spiFd2, WaveShare_2in9_EPD_FULL);
+
+    const int Signs[] = { spiFd, spiFd2 };
+    const uint8_t* SignImages[] = { WaveShareLogo_2in9, TechNerversLogo_2in9 };
+    EPD_Display_Multi_2in9(Signs, SignImages, 2);
+    EPD_Sleep_2in9(spiFd2);
+#endif
+
+    // Where the time of the updates above went, per phase and per full / partial refresh
+    EPD_Telemetry_Dump();
+    EPD_Energy_Dump();
+    Arena_Dump();
+
+    Log_Debug("Image update process Compleated \n");
 
     // Gets the EPD in Sleep Mode 
     //Fixed Waking up od EPD 
     EPD_Sleep_2in9(spiFd);
+#endif
 
     while (true) {
+        Log_Drain(0);
         // We Love Blinky or as the Experts like to call them : HelloWorld :) 
         GPIO_SetValue(Ledfd, GPIO_Value_Low);
         delay_ms(500);
@@ -0,0 +1,324 @@
+/*****************************************************************************
+* | File      	:  	epd_engine.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   EPD engine of the Real Time core, runs the messages of epd_remote.h
+* | Info        :   Never blocks : reset pulse, sequence delays and BUSY are waited for in EPD_Engine_Poll
+*                   against the microsecond clock, so the caller can keep serving the mailbox.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Reset, command sequence and RAM rectangle messages, completion after BUSY
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+
+#include "epd_hal.h"
+#include "epd_engine.h"
+
+// IL3820 commands the engine sends on its own for a RAM rectangle
+#define EPD_CMD_WRITE_RAM		0x24
+#define EPD_CMD_RAM_X_WINDOW	0x44
+#define EPD_CMD_RAM_Y_WINDOW	0x45
+#define EPD_CMD_RAM_X_COUNTER	0x4E
+#define EPD_CMD_RAM_Y_COUNTER	0x4F
+
+/******************************************************************************
+function    : Sends one command with its parameters, D/C low for the command byte
+return      : EPD_RMT_OK / EPD_RMT_ERR_SPI
+******************************************************************************/
+static uint8_t EPD_Engine_Command(uint8_t Cmd, const uint8_t *Data, uint32_t Len) {
+    EPD_Hal_Dc(0);
+    if (EPD_Hal_Spi_Write(&Cmd, 1) != 0) {
+        return EPD_RMT_ERR_SPI;
+    }
+    EPD_Hal_Dc(1);
+    if (Len > 0 && EPD_Hal_Spi_Write(Data, Len) != 0) {
+        return EPD_RMT_ERR_SPI;
+    }
+    return EPD_RMT_OK;
+}
+
+/******************************************************************************
+function    : Sets the RAM window and address counters of a rectangle and starts 
+              writing RAM, data mode 0x03 (X then Y increment) as set by the 
+              init sequence
+******************************************************************************/
+static uint8_t EPD_Engine_Open_Rect(const EPD_RMT_MSG *Hdr) {
+    uint16_t xe = Hdr->Xbyte + Hdr->WidthByte - 1;
+    uint16_t ye = Hdr->Ystart + Hdr->Height - 1;
+    uint8_t xwin[2] = { (uint8_t)Hdr->Xbyte, (uint8_t)xe };
+    uint8_t ywin[4] = { Hdr->Ystart & 0xFF, Hdr->Ystart >> 8, ye & 0xFF, ye >> 8 };
+    uint8_t ycnt[2] = { Hdr->Ystart & 0xFF, Hdr->Ystart >> 8 };
+    uint8_t ret;
+
+    ret = EPD_Engine_Command(EPD_CMD_RAM_X_WINDOW, xwin, sizeof(xwin));
+    if (ret == EPD_RMT_OK) {
+        ret = EPD_Engine_Command(EPD_CMD_RAM_Y_WINDOW, ywin, sizeof(ywin));
+    }
+    if (ret == EPD_RMT_OK) {
+        ret = EPD_Engine_Command(EPD_CMD_RAM_X_COUNTER, xwin, 1);
+    }
+    if (ret == EPD_RMT_OK) {
+        ret = EPD_Engine_Command(EPD_CMD_RAM_Y_COUNTER, ycnt, sizeof(ycnt));
+    }
+    if (ret == EPD_RMT_OK) {
+        ret = EPD_Engine_Command(EPD_CMD_WRITE_RAM, NULL, 0);
+    }
+    return ret;
+}
+
+/******************************************************************************
+function    : Writes a piece of the open RAM rectangle
+******************************************************************************/
+static void EPD_Engine_Rect(EPD_ENGINE *Engine, const EPD_RMT_MSG *Hdr) {
+    uint32_t total = (uint32_t)Hdr->WidthByte * Hdr->Height;
+
+    if (Hdr->Offset == 0) {
+        if (total == 0 || Hdr->Xbyte + Hdr->WidthByte > 0xFF) {
+            Engine->Status = EPD_RMT_ERR_MSG;
+            return;
+        }
+        Engine->RectTotal = total;
+        Engine->RectDone = 0;
+        Engine->Status = EPD_Engine_Open_Rect(Hdr);
+        if (Engine->Status != EPD_RMT_OK) {
+            Engine->RectTotal = 0;
+            return;
+        }
+    } else if (Engine->RectTotal != total || Engine->RectDone != Hdr->Offset) {
+        // Piece of a rectangle that was never opened or a lost piece
+        Engine->RectTotal = 0;
+        Engine->Status = EPD_RMT_ERR_MSG;
+        return;
+    }
+
+    if (Engine->RectDone + Hdr->Len > Engine->RectTotal) {
+        Engine->RectTotal = 0;
+        Engine->Status = EPD_RMT_ERR_MSG;
+        return;
+    }
+    // Still in WRITE_RAM with D/C high, the address counter carries on from the last piece
+    if (Hdr->Len > 0 && EPD_Hal_Spi_Write(&Engine->Msg[sizeof(EPD_RMT_MSG)], Hdr->Len) != 0) {
+        Engine->RectTotal = 0;
+        Engine->Status = EPD_RMT_ERR_SPI;
+        return;
+    }
+    Engine->RectDone += Hdr->Len;
+    if (Engine->RectDone == Engine->RectTotal) {
+        Engine->RectTotal = 0;
+    }
+}
+
+/******************************************************************************
+function    : Sends sequence entries till the end or the next wait
+******************************************************************************/
+static void EPD_Engine_Run(EPD_ENGINE *Engine) {
+    const EPD_RMT_MSG *hdr = (const EPD_RMT_MSG *)Engine->Msg;
+    uint32_t end = sizeof(EPD_RMT_MSG) + hdr->Len;
+
+    while ((uint32_t)Engine->Pos + 2 <= end) {
+        const uint8_t *entry = &Engine->Msg[Engine->Pos];
+        uint8_t flags = entry[1];
+        uint8_t len = flags & EPD_SEQ_LEN;
+
+        if (entry[0] == EPD_SEQ_END_CMD && flags == EPD_SEQ_END_FLAGS) {
+            break;     // Never a command, see EPD_SEQ_END
+        }
+        if ((uint32_t)Engine->Pos + 2 + len + ((flags & EPD_SEQ_DELAY) ? 1 : 0) > end) {
+            Engine->Status = EPD_RMT_ERR_MSG;
+            break;
+        }
+        Engine->Status = EPD_Engine_Command(entry[0], &entry[2], len);
+        if (Engine->Status != EPD_RMT_OK) {
+            break;
+        }
+        Engine->Pos += 2 + len;
+
+        if (flags & EPD_SEQ_DELAY) {
+            Engine->WaitUs = (uint32_t)Engine->Msg[Engine->Pos++] * 1000u;
+            Engine->WaitStartUs = EPD_Hal_Now_Us();
+            // The BUSY wait, if any, follows the delay
+            Engine->BusyAfterDelay = (flags & EPD_SEQ_BUSY) ? 1 : 0;
+            Engine->Step = EPD_STEP_DELAY;
+            return;
+        }
+        if (flags & EPD_SEQ_BUSY) {
+            Engine->WaitStartUs = EPD_Hal_Now_Us();
+            Engine->Step = EPD_STEP_BUSY;
+            return;
+        }
+    }
+    Engine->Step = EPD_STEP_DONE;
+    Engine->WaitStartUs = EPD_Hal_Now_Us();
+}
+
+/******************************************************************************
+function    : Resets the engine state, the display is left as it is
+******************************************************************************/
+void EPD_Engine_Init(EPD_ENGINE *Engine) {
+    memset(Engine, 0, sizeof(*Engine));
+    Engine->Step = EPD_STEP_IDLE;
+}
+
+/******************************************************************************
+function    : 1 if the engine can take the next message
+******************************************************************************/
+int EPD_Engine_Ready(const EPD_ENGINE *Engine) {
+    return Engine->Step == EPD_STEP_IDLE;
+}
+
+/******************************************************************************
+function    : Starts working on a message, EPD_Engine_Poll finishes it
+parameter   :
+       Engine :   Engine, EPD_Engine_Ready must be 1
+       Msg    :   Message, copied
+       Len    :   Message length
+******************************************************************************/
+void EPD_Engine_Handle(EPD_ENGINE *Engine, const uint8_t *Msg, uint32_t Len) {
+    const EPD_RMT_MSG *hdr = (const EPD_RMT_MSG *)Engine->Msg;
+
+    Engine->MsgStartUs = EPD_Hal_Now_Us();
+    Engine->BusyUs = 0;
+    Engine->Status = EPD_RMT_OK;
+    Engine->Pos = sizeof(EPD_RMT_MSG);
+
+    if (Len < sizeof(EPD_RMT_MSG) || Len > sizeof(Engine->Msg)) {
+        // Rejected with the Seq of the header, so the sender does not wait for it; 
+        // Seq 0 if the message is too short to hold it
+        memset(Engine->Msg, 0, sizeof(EPD_RMT_MSG));
+        if (Len >= offsetof(EPD_RMT_MSG, Seq) + sizeof(hdr->Seq)) {
+            memcpy(Engine->Msg, Msg, (Len < sizeof(EPD_RMT_MSG)) ? Len : sizeof(EPD_RMT_MSG));
+        }
+        Engine->Status = EPD_RMT_ERR_MSG;
+        Engine->Step = EPD_STEP_DONE;
+        Engine->WaitStartUs = Engine->MsgStartUs;
+        return;
+    }
+    memcpy(Engine->Msg, Msg, Len);
+    if (sizeof(EPD_RMT_MSG) + hdr->Len != Len) {
+        Engine->Status = EPD_RMT_ERR_MSG;
+        Engine->Step = EPD_STEP_DONE;
+        Engine->WaitStartUs = Engine->MsgStartUs;
+        return;
+    }
+
+    // Anything but the next piece closes an open rectangle
+    if (hdr->Type != EPD_RMT_RECT && Engine->RectTotal != 0) {
+        Engine->RectTotal = 0;
+    }
+
+    switch (hdr->Type) {
+    case EPD_RMT_RESET:
+        EPD_Hal_Rst(1);
+        EPD_Hal_Rst(0);
+        Engine->WaitStartUs = EPD_Hal_Now_Us();
+        Engine->WaitUs = EPD_RMT_RESET_US;
+        Engine->Step = EPD_STEP_RESET;
+        break;
+    case EPD_RMT_SEQ:
+        Engine->Step = EPD_STEP_RUN;
+        EPD_Engine_Run(Engine);
+        break;
+    case EPD_RMT_RECT:
+        EPD_Engine_Rect(Engine, hdr);
+        Engine->Step = EPD_STEP_DONE;
+        Engine->WaitStartUs = EPD_Hal_Now_Us();
+        break;
+    default:
+        Engine->Status = EPD_RMT_ERR_MSG;
+        Engine->Step = EPD_STEP_DONE;
+        break;
+    }
+}
+
+/******************************************************************************
+function    : Moves the current message on, call it in the main loop
+parameter   :
+       Engine :   Engine
+       Reply  :   Gets an EPD_RMT_DONE message, EPD_RMT_MAX_MSG bytes
+return      : Length of the reply, 0 if there is none
+******************************************************************************/
+int EPD_Engine_Poll(EPD_ENGINE *Engine, uint8_t *Reply) {
+    const EPD_RMT_MSG *hdr = (const EPD_RMT_MSG *)Engine->Msg;
+    uint32_t now = EPD_Hal_Now_Us();
+    EPD_RMT_MSG *out;
+    EPD_RMT_DONE_INFO info;
+
+    switch (Engine->Step) {
+    case EPD_STEP_RESET:
+        if (now - Engine->WaitStartUs < Engine->WaitUs) {
+            return 0;
+        }
+        EPD_Hal_Rst(1);
+        Engine->WaitStartUs = now;
+        Engine->Step = EPD_STEP_DONE;
+        return 0;
+    case EPD_STEP_DELAY:
+        if (now - Engine->WaitStartUs < Engine->WaitUs) {
+            return 0;
+        }
+        Engine->WaitStartUs = now;
+        if (Engine->BusyAfterDelay) {
+            Engine->Step = EPD_STEP_BUSY;
+        } else {
+            Engine->Step = EPD_STEP_RUN;
+            EPD_Engine_Run(Engine);
+        }
+        return 0;
+    case EPD_STEP_BUSY:
+    case EPD_STEP_DONE:
+        if (EPD_Hal_Busy()) {
+            if (now - Engine->WaitStartUs < EPD_RMT_BUSY_TIMEOUT_US) {
+                return 0;
+            }
+            Engine->Status = EPD_RMT_ERR_TIMEOUT;
+        }
+        Engine->BusyUs += now - Engine->WaitStartUs;
+        if (Engine->Step == EPD_STEP_BUSY && Engine->Status == EPD_RMT_OK) {
+            Engine->Step = EPD_STEP_RUN;
+            EPD_Engine_Run(Engine);
+            return 0;
+        }
+        break;
+    default:
+        return 0;
+    }
+
+    // Message finished, errors are reported even without EPD_RMT_FLAG_ACK
+    Engine->Step = EPD_STEP_IDLE;
+    if (!(hdr->Flags & EPD_RMT_FLAG_ACK) && Engine->Status == EPD_RMT_OK) {
+        return 0;
+    }
+    out = (EPD_RMT_MSG *)Reply;
+    memset(out, 0, sizeof(*out));
+    out->Type = EPD_RMT_DONE;
+    out->Flags = Engine->Status;
+    out->Seq = hdr->Seq;
+    out->Len = sizeof(info);
+    info.BusyUs = Engine->BusyUs;
+    info.ElapsedUs = now - Engine->MsgStartUs;
+    memcpy(&Reply[sizeof(*out)], &info, sizeof(info));
+    return (int)(sizeof(*out) + sizeof(info));
+}
@@ -0,0 +1,69 @@
+/*****************************************************************************
+* | File      	:  	epd_engine.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   EPD engine of the Real Time core, runs the messages of epd_remote.h
+* | Info        :   Never blocks : reset pulse, sequence delays and BUSY are waited for in EPD_Engine_Poll
+*                   against the microsecond clock, so the caller can keep serving the mailbox.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Reset, command sequence and RAM rectangle messages, completion after BUSY
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_ENGINE_H
+#define EPD_ENGINE_H
+
+#include <stdint.h>
+
+#include "../Common/epd_remote.h"
+
+// What the engine is doing with the current message
+#define EPD_STEP_IDLE		0	// Ready for the next message
+#define EPD_STEP_RUN		1	// Sending the sequence at Pos
+#define EPD_STEP_DELAY		2	// Timed wait, then EPD_STEP_RUN
+#define EPD_STEP_BUSY		3	// Waiting for BUSY, then EPD_STEP_RUN
+#define EPD_STEP_RESET		4	// Reset pulse, then EPD_STEP_BUSY
+#define EPD_STEP_DONE		5	// Message sent, waiting for BUSY before the reply
+
+typedef struct {
+    uint8_t Msg[EPD_RMT_MAX_MSG];	// Message being worked on
+    uint16_t Pos;					// Next sequence entry in Msg
+    uint8_t Step;					// EPD_STEP_xxx
+    uint8_t Status;					// EPD_RMT_OK or the first error of the message
+    uint32_t MsgStartUs;
+    uint32_t WaitStartUs;			// Start of the current timed / BUSY wait
+    uint32_t WaitUs;				// Length of the timed wait
+    uint8_t BusyAfterDelay;			// The sequence entry of the timed wait also waits for BUSY
+    uint32_t BusyUs;				// BUSY time of the message so far
+    // RAM rectangle being written, its pieces come in several messages
+    uint32_t RectTotal;
+    uint32_t RectDone;
+} EPD_ENGINE;
+
+void EPD_Engine_Init(EPD_ENGINE *Engine);
+int EPD_Engine_Ready(const EPD_ENGINE *Engine);		// 1 if EPD_Engine_Handle can take a message
+void EPD_Engine_Handle(EPD_ENGINE *Engine, const uint8_t *Msg, uint32_t Len);	// Starts a message
+int EPD_Engine_Poll(EPD_ENGINE *Engine, uint8_t *Reply);	// Moves on, returns the length of a reply put in Reply or 0
+
+#endif
@@ -0,0 +1,45 @@
+/*****************************************************************************
+* | File      	:  	epd_hal.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Pins, SPI and clock used by the EPD engine
+* | Info        :   Implemented by epd_hal_mt3620.c on the Real Time core and by Tools/EpdSim on a host
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : D/C, RST, BUSY, SPI write and microsecond clock
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef EPD_HAL_H
+#define EPD_HAL_H
+
+#include <stdint.h>
+
+int EPD_Hal_Init(void);		// Pins and SPI, 0 on Success
+void EPD_Hal_Dc(uint8_t Level);		// 0 : command, 1 : data
+void EPD_Hal_Rst(uint8_t Level);
+uint8_t EPD_Hal_Busy(void);		// 1 while the display is busy
+int EPD_Hal_Spi_Write(const uint8_t *Data, uint32_t Len);	// 0 on Success
+uint32_t EPD_Hal_Now_Us(void);	// Free running microsecond clock, wraps around
+
+#endif
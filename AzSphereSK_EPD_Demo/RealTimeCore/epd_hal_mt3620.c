@@ -0,0 +1,167 @@
+/*****************************************************************************
+* | File      	:  	epd_hal_mt3620.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   EPD engine pins, SPI and clock on the MT3620 Real Time core (M4)
+* | Info        :   Register level, the pins and ISU1 must be claimed by the Real Time app manifest and
+*                   not by the High Level app. Same click slot pins as AzSphere_Interface.h.
+*----------------
+* |	This version:   V1.1
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.1 (2026-10-19):
+* 1. Changed : The microsecond clock is the GPT3 timebase of the timer service (rt_timer.c)
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : GPIO D/C, RST, BUSY, ISU1 SPI master writes, GPT3 microsecond clock
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stddef.h>
+
+#include "epd_hal.h"
+#include "rt_timer.h"
+
+// Click slot the display is plugged in, same pins as CLICK_SLOT of the High Level app
+#ifndef EPD_RT_SLOT
+#define EPD_RT_SLOT 1
+#endif
+
+#define EPD_RT_DC_GPIO		2
+#if EPD_RT_SLOT == 2
+#define EPD_RT_BUSY_GPIO	1
+#define EPD_RT_RST_GPIO		17
+#define EPD_RT_SPI_CS		1		// CS_B
+#else
+#define EPD_RT_BUSY_GPIO	0
+#define EPD_RT_RST_GPIO		16
+#define EPD_RT_SPI_CS		0		// CS_A
+#endif
+
+// GPIO blocks, 4 pins each from GPIO0
+#define GPIO_BLOCK_BASE(g)	(0x38010000u + 0x10000u * ((g) / 4))
+#define GPIO_BIT(g)			(1u << ((g) % 4))
+#define GPIO_DIN			0x00
+#define GPIO_DOUT_SET		0x14
+#define GPIO_DOUT_RESET		0x18
+#define GPIO_OE_SET			0x24
+#define GPIO_OE_RESET		0x28
+
+// ISU1 SPI master
+#define SPI_BASE			0x38080300u
+#define SPI_STCSR			0x00	// [0] start, [16] busy
+#define SPI_SOAR			0x04	// First 4 bytes out (opcode / address)
+#define SPI_SDOR0			0x08	// Next 32 bytes out, SDOR0..7
+#define SPI_SMMR			0x28	// Mode and clock
+#define SPI_SMBCR			0x2C	// Bit counts : [29:24] opcode, [8:0] MOSI
+#define SPI_CSPOL			0x38
+#define SPI_STCSR_START		(1u << 0)
+#define SPI_STCSR_BUSY		(1u << 16)
+#define SPI_MAX_XFER		36		// SOAR + SDOR0..7
+// Mode 0, MSB first, chip select per EPD_RT_SPI_CS, clock 80 MHz / (SPI_CLK_SEL + 2) ~ 4 MHz
+#define SPI_CLK_SEL			18
+#define SPI_SMMR_VALUE		((SPI_CLK_SEL << 16) | (EPD_RT_SPI_CS << 12) | (1u << 2))
+
+static void WriteReg32(uintptr_t baseAddr, size_t offset, uint32_t value) {
+    *(volatile uint32_t *)(baseAddr + offset) = value;
+}
+
+static uint32_t ReadReg32(uintptr_t baseAddr, size_t offset) {
+    return *(volatile uint32_t *)(baseAddr + offset);
+}
+
+/******************************************************************************
+function    : Drives an output pin
+******************************************************************************/
+static void EPD_Hal_Gpio_Write(uint8_t Gpio, uint8_t Level) {
+    WriteReg32(GPIO_BLOCK_BASE(Gpio), Level ? GPIO_DOUT_SET : GPIO_DOUT_RESET, GPIO_BIT(Gpio));
+}
+
+/******************************************************************************
+function    : Sets up the pins and the SPI master
+return      : 0 on Success
+******************************************************************************/
+int EPD_Hal_Init(void) {
+    EPD_Hal_Gpio_Write(EPD_RT_DC_GPIO, 1);
+    EPD_Hal_Gpio_Write(EPD_RT_RST_GPIO, 1);
+    WriteReg32(GPIO_BLOCK_BASE(EPD_RT_DC_GPIO), GPIO_OE_SET, GPIO_BIT(EPD_RT_DC_GPIO));
+    WriteReg32(GPIO_BLOCK_BASE(EPD_RT_RST_GPIO), GPIO_OE_SET, GPIO_BIT(EPD_RT_RST_GPIO));
+    WriteReg32(GPIO_BLOCK_BASE(EPD_RT_BUSY_GPIO), GPIO_OE_RESET, GPIO_BIT(EPD_RT_BUSY_GPIO));
+
+    WriteReg32(SPI_BASE, SPI_SMMR, SPI_SMMR_VALUE);
+    WriteReg32(SPI_BASE, SPI_CSPOL, 0);		// Active low chip selects
+    return 0;
+}
+
+void EPD_Hal_Dc(uint8_t Level) {
+    EPD_Hal_Gpio_Write(EPD_RT_DC_GPIO, Level);
+}
+
+void EPD_Hal_Rst(uint8_t Level) {
+    EPD_Hal_Gpio_Write(EPD_RT_RST_GPIO, Level);
+}
+
+uint8_t EPD_Hal_Busy(void) {
+    return (ReadReg32(GPIO_BLOCK_BASE(EPD_RT_BUSY_GPIO), GPIO_DIN) & GPIO_BIT(EPD_RT_BUSY_GPIO)) ? 1 : 0;
+}
+
+// GPT3 timebase of the timer service, Rt_Timer_Init must run before
+uint32_t EPD_Hal_Now_Us(void) {
+    return Rt_Timer_Now_Us();
+}
+
+/******************************************************************************
+function    : Half duplex write, SPI_MAX_XFER bytes per transaction. The first 
+              bytes go out of the opcode register, the rest out of SDOR.
+parameter   :
+       Data :   Bytes to send, MSB first
+       Len  :   Byte count
+return      : 0 on Success
+******************************************************************************/
+int EPD_Hal_Spi_Write(const uint8_t *Data, uint32_t Len) {
+    while (Len > 0) {
+        uint32_t n = (Len > SPI_MAX_XFER) ? SPI_MAX_XFER : Len;
+        uint32_t op = (n > 4) ? 4 : n;
+        uint32_t word = 0;
+        uint32_t i;
+
+        for (i = 0; i < op; i++) {
+            word = (word << 8) | Data[i];
+        }
+        WriteReg32(SPI_BASE, SPI_SOAR, word);
+        for (i = op; i < n; i += 4) {
+            uint32_t j;
+            word = 0;
+            for (j = 0; j < 4 && i + j < n; j++) {
+                word |= (uint32_t)Data[i + j] << (8 * j);
+            }
+            WriteReg32(SPI_BASE, SPI_SDOR0 + (i - op), word);
+        }
+        WriteReg32(SPI_BASE, SPI_SMBCR, ((op * 8) << 24) | ((n - op) * 8));
+        WriteReg32(SPI_BASE, SPI_STCSR, SPI_STCSR_START);
+        while (ReadReg32(SPI_BASE, SPI_STCSR) & SPI_STCSR_BUSY) {
+            // empty.
+        }
+
+        Data += n;
+        Len -= n;
+    }
+    return 0;
+}
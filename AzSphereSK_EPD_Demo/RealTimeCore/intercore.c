@@ -0,0 +1,133 @@
+/*****************************************************************************
+* | File      	:  	intercore.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Inter-core transport of the Real Time core, mailbox and shared buffers
+* | Info        :   The OS hands over the shared buffers through the mailbox at start up, see the
+*                   IntercoreComms sample. Messages are read and written with epd_ring.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Buffer setup, non blocking receive, send to the High Level app
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+
+#include "../Common/epd_ring.h"
+#include "intercore.h"
+
+// Mailbox of the M4 core, A7 <-> M4 FIFO
+#define MBOX_BASE			0x21050000u
+#define MBOX_SW_INT_PORT	0x14	// Bit 1 tells the A7 side there is data in the outbound buffer
+#define MBOX_CMD_POP0		0x50
+#define MBOX_DATA_POP0		0x54
+#define MBOX_FIFO_POP_CNT	0x58
+
+// Buffer set up commands from the OS, the data is a buffer descriptor
+#define MBOX_OUTBOUND_BUFFER	0xBA5E0001u
+#define MBOX_INBOUND_BUFFER		0xBA5E0002u
+#define MBOX_BUFFERS_DONE		0xBA5E0003u
+
+static EPD_RING Outbound;		// Real Time -> High Level
+static EPD_RING Inbound;		// High Level -> Real Time
+static uint8_t Peer[EPD_RING_PREFIX];	// Component id of the last sender
+static uint8_t PeerKnown = 0;
+
+static void WriteReg32(uintptr_t baseAddr, size_t offset, uint32_t value) {
+    *(volatile uint32_t *)(baseAddr + offset) = value;
+}
+
+static uint32_t ReadReg32(uintptr_t baseAddr, size_t offset) {
+    return *(volatile uint32_t *)(baseAddr + offset);
+}
+
+/******************************************************************************
+function    : Attaches a ring to a buffer descriptor, the low 5 bits hold the 
+              buffer size as a power of two
+******************************************************************************/
+static void Intercore_Attach(EPD_RING *Ring, uint32_t Descriptor) {
+    EPD_Ring_Attach(Ring, (void *)(uintptr_t)(Descriptor & ~0x1Fu), 1u << (Descriptor & 0x1F));
+}
+
+/******************************************************************************
+function    : Waits for the OS to hand over the shared buffers
+return      : 0 on Success
+******************************************************************************/
+int Intercore_Init(void) {
+    uint32_t cmd = 0, data = 0;
+    uint32_t outbound = 0, inbound = 0;
+
+    do {
+        while (ReadReg32(MBOX_BASE, MBOX_FIFO_POP_CNT) == 0) {
+            // empty.
+        }
+        data = ReadReg32(MBOX_BASE, MBOX_DATA_POP0);
+        cmd = ReadReg32(MBOX_BASE, MBOX_CMD_POP0);
+        if (cmd == MBOX_OUTBOUND_BUFFER) {
+            outbound = data;
+        } else if (cmd == MBOX_INBOUND_BUFFER) {
+            inbound = data;
+        }
+    } while (cmd != MBOX_BUFFERS_DONE);
+
+    if (outbound == 0 || inbound == 0) {
+        return -1;
+    }
+    Intercore_Attach(&Outbound, outbound);
+    Intercore_Attach(&Inbound, inbound);
+    return 0;
+}
+
+/******************************************************************************
+function    : Reads the next message without waiting
+parameter   :
+       Msg  :   Buffer for the message
+       Max  :   Size of Msg
+return      : Message length, 0 if there is none (or it was too large and dropped)
+******************************************************************************/
+int Intercore_Recv(uint8_t *Msg, uint32_t Max) {
+    int len = EPD_Ring_Read(&Inbound, Peer, Msg, Max);
+
+    // Mailbox FIFO entries only wake the core up, the ring is the source of truth
+    while (ReadReg32(MBOX_BASE, MBOX_FIFO_POP_CNT) != 0) {
+        (void)ReadReg32(MBOX_BASE, MBOX_DATA_POP0);
+        (void)ReadReg32(MBOX_BASE, MBOX_CMD_POP0);
+    }
+    if (len > 0) {
+        PeerKnown = 1;
+    }
+    return (len > 0) ? len : 0;
+}
+
+/******************************************************************************
+function    : Sends a message to the app the last message came from
+return      : 0 / -1 if nobody wrote yet or there is no room
+******************************************************************************/
+int Intercore_Send(const uint8_t *Msg, uint32_t Len) {
+    if (!PeerKnown || EPD_Ring_Write(&Outbound, Peer, Msg, Len) != 0) {
+        return -1;
+    }
+    WriteReg32(MBOX_BASE, MBOX_SW_INT_PORT, 1u << 1);
+    return 0;
+}
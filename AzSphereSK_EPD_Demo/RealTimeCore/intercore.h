@@ -0,0 +1,43 @@
+/*****************************************************************************
+* | File      	:  	intercore.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Inter-core transport of the Real Time core, mailbox and shared buffers
+* | Info        :   The OS hands over the shared buffers through the mailbox at start up, see the
+*                   IntercoreComms sample. Messages are read and written with epd_ring.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Buffer setup, non blocking receive, send to the High Level app
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef INTERCORE_H
+#define INTERCORE_H
+
+#include <stdint.h>
+
+int Intercore_Init(void);		// Waits for the shared buffers, 0 on Success
+int Intercore_Recv(uint8_t *Msg, uint32_t Max);		// Message length, 0 if there is none
+int Intercore_Send(const uint8_t *Msg, uint32_t Len);	// To the app that sent the last message, 0 / -1 if there is no room
+
+#endif
@@ -5,10 +5,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "../Common/epd_remote.h"
+#include "epd_hal.h"
+#include "epd_engine.h"
+#include "intercore.h"
+#include "rt_irq.h"
+#include "rt_timer.h"
+#include "rt_uart.h"
+
 extern uint32_t StackTop; // &StackTop == end of TCM
 
-static const uintptr_t GPT_BASE = 0x21030000;
-static const uintptr_t UART_BASE = 0x21040000;
 static const uintptr_t SCB_BASE = 0xE000ED00;
 
 static _Noreturn void DefaultExceptionHandler(void);
@@ -16,11 +22,6 @@ static _Noreturn void DefaultExceptionHandler(void);
 static void WriteReg32(uintptr_t baseAddr, size_t offset, uint32_t value);
 static uint32_t ReadReg32(uintptr_t baseAddr, size_t offset);
 
-static void Uart_Init(void);
-static void Uart_WritePoll(const char *msg);
-
-static void Gpt3_WaitUs(int microseconds);
-
 static _Noreturn void RTCoreMain(void);
 
 // ARM DDI0403E.d SB1.5.2-3
@@ -47,7 +48,9 @@ __attribute__((used)) = {
     [14] = (uintptr_t)DefaultExceptionHandler, // PendSV
     [15] = (uintptr_t)DefaultExceptionHandler, // SysTick
 
-    [INT_TO_EXC(0)... INT_TO_EXC(INTERRUPT_COUNT - 1)] = (uintptr_t)DefaultExceptionHandler};
+    [INT_TO_EXC(0)... INT_TO_EXC(INTERRUPT_COUNT - 1)] = (uintptr_t)DefaultExceptionHandler,
+    [INT_TO_EXC(RT_IRQ_GPT)] = (uintptr_t)Rt_Timer_Irq,
+    [INT_TO_EXC(RT_IRQ_UART)] = (uintptr_t)Rt_Uart_Irq};
 
 static _Noreturn void DefaultExceptionHandler(void)
 {
@@ -66,50 +69,12 @@ static uint32_t ReadReg32(uintptr_t baseAddr, size_t offset)
     return *(volatile uint32_t *)(baseAddr + offset);
 }
 
-static void Uart_Init(void)
-{
-    // Configure UART to use 115200-8-N-1.
-    WriteReg32(UART_BASE, 0x0C, 0x80); // LCR (enable DLL, DLM)
-    WriteReg32(UART_BASE, 0x24, 0x3);  // HIGHSPEED
-    WriteReg32(UART_BASE, 0x04, 0);    // Divisor Latch (MS)
-    WriteReg32(UART_BASE, 0x00, 1);    // Divisor Latch (LS)
-    WriteReg32(UART_BASE, 0x28, 224);  // SAMPLE_COUNT
-    WriteReg32(UART_BASE, 0x2C, 110);  // SAMPLE_POINT
-    WriteReg32(UART_BASE, 0x58, 0);    // FRACDIV_M
-    WriteReg32(UART_BASE, 0x54, 223);  // FRACDIV_L
-    WriteReg32(UART_BASE, 0x0C, 0x03); // LCR (8-bit word length)
-}
-
-static void Uart_WritePoll(const char *msg)
-{
-    while (*msg) {
-        // When LSR[5] is set, can write another character.
-        while (!(ReadReg32(UART_BASE, 0x14) & (UINT32_C(1) << 5))) {
-            // empty.
-        }
-
-        WriteReg32(UART_BASE, 0x0, *msg++);
-    }
-}
+// The tick interrupt wakes the main loop to poll the EPD engine and the mailbox
+#define EPD_RT_TICK_US 1000
 
-static void Gpt3_WaitUs(int microseconds)
+static void Tick(void *ctx)
 {
-    // GPT3_INIT = initial counter value
-    WriteReg32(GPT_BASE, 0x54, 0x0);
-
-    // GPT3_CTRL
-    uint32_t ctrlOn = 0x0;
-    ctrlOn |= (0x19) << 16; // OSC_CNT_1US (default value)
-    ctrlOn |= 0x1;          // GPT3_EN = 1 -> GPT3 enabled
-    WriteReg32(GPT_BASE, 0x50, ctrlOn);
-
-    // GPT3_CNT
-    while (ReadReg32(GPT_BASE, 0x58) < microseconds) {
-        // empty.
-    }
-
-    // GPT_CTRL -> disable timer
-    WriteReg32(GPT_BASE, 0x50, 0x0);
+    (void)ctx;
 }
 
 static _Noreturn void RTCoreMain(void)
@@ -117,18 +82,58 @@ static _Noreturn void RTCoreMain(void)
     // SCB->VTOR = ExceptionVectorTable
     WriteReg32(SCB_BASE, 0x08, (uint32_t)ExceptionVectorTable);
 
-    Uart_Init();
+    Rt_Uart_Init();
+    Rt_Timer_Init();
+
+    // EPD engine : the High Level app sends reset, command sequences and RAM rectangles
+    // (Common/epd_remote.h) and gets a completion once the display is not BUSY anymore.
+    // The engine never blocks, delays and BUSY are polled against GPT3 in this loop, which sleeps
+    // between the ticks of a periodic timer. Time critical work goes in RT_TIMER_IN_IRQ timers.
+    static RT_TIMER tick;
+    static EPD_ENGINE engine;
+    static uint8_t msg[EPD_RMT_MAX_MSG];
+    static uint8_t reply[EPD_RMT_MAX_MSG];
+    static uint32_t replyLen = 0;
+
+    EPD_Hal_Init();
+    EPD_Engine_Init(&engine);
+    if (Intercore_Init() != 0) {
+        Rt_Uart_Write("EPD engine : no inter-core buffers\r\n");
+        Rt_Uart_Flush();
+        DefaultExceptionHandler();
+    }
+    Rt_Uart_Write("EPD engine ready\r\n");
 
-    // This minimal Azure Sphere app repeatedly prints "Tick" then "Tock" to the
-    // debug UART, at one second intervals. Use this app to test the device and SDK
-    // installation succeeded, and that you can deploy and debug applications on the
-    // real-time core.
+    Rt_Timer_Setup(&tick, Tick, NULL, RT_TIMER_IN_IRQ);
+    Rt_Timer_Start(&tick, EPD_RT_TICK_US, EPD_RT_TICK_US);
 
-    static const int tickPeriodUs = 1 * 1000 * 1000;
     while (true) {
-        Uart_WritePoll("Real Time Core tick\r\n");
-        Gpt3_WaitUs(tickPeriodUs);
-        Uart_WritePoll("Real Time Core tock\r\n");
-        Gpt3_WaitUs(tickPeriodUs);
+        bool worked = false;
+
+        Rt_Timer_Dispatch();
+
+        // A reply that did not fit goes out before the next message is taken
+        if (replyLen != 0 && Intercore_Send(reply, replyLen) == 0) {
+            replyLen = 0;
+        }
+        if (replyLen == 0 && EPD_Engine_Ready(&engine)) {
+            int len = Intercore_Recv(msg, sizeof(msg));
+            if (len > 0) {
+                EPD_Engine_Handle(&engine, msg, (uint32_t)len);
+                worked = true;
+            }
+        }
+        if (replyLen == 0) {
+            int len = EPD_Engine_Poll(&engine, reply);
+            if (len > 0) {
+                replyLen = (uint32_t)len;
+                worked = true;
+            }
+        }
+
+        // Nothing moved, wait for the next tick (or the UART / timer interrupts)
+        if (!worked) {
+            Rt_Timer_Sleep();
+        }
     }
 }
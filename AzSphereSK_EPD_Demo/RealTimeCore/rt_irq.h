@@ -0,0 +1,76 @@
+/*****************************************************************************
+* | File      	:  	rt_irq.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   NVIC and interrupt masking helpers of the Real Time core (Cortex-M4F)
+* | Info        :   Header only, used by the timer service and the UART driver
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : IRQ enable / priority, PRIMASK save and restore
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef RT_IRQ_H
+#define RT_IRQ_H
+
+#include <stdint.h>
+
+#define RT_NVIC_ISER		0xE000E100u		// Set enable, one bit per IRQ
+#define RT_NVIC_ICER		0xE000E180u		// Clear enable
+#define RT_NVIC_IPR			0xE000E400u		// Priority, one byte per IRQ
+#define RT_NVIC_PRIO_BITS	3				// Priority bits implemented by the MT3620 M4
+
+// MT3620 M4 interrupt numbers used here
+#define RT_IRQ_GPT			1		// GPT0 / GPT1
+#define RT_IRQ_UART			4		// Debug UART of the core
+
+// Lower is more urgent. Timers preempt the UART so log output never adds timer jitter.
+#define RT_PRIO_TIMER		2
+#define RT_PRIO_UART		5
+
+static inline void Rt_Irq_Enable(uint32_t Irq, uint32_t Priority) {
+    *(volatile uint8_t *)(uintptr_t)(RT_NVIC_IPR + Irq) = (uint8_t)(Priority << (8 - RT_NVIC_PRIO_BITS));
+    *(volatile uint32_t *)(uintptr_t)(RT_NVIC_ISER + 4 * (Irq / 32)) = 1u << (Irq % 32);
+}
+
+static inline void Rt_Irq_Disable(uint32_t Irq) {
+    *(volatile uint32_t *)(uintptr_t)(RT_NVIC_ICER + 4 * (Irq / 32)) = 1u << (Irq % 32);
+}
+
+// Masks interrupts, returns the previous mask for Rt_Irq_Restore
+static inline uint32_t Rt_Irq_Save(void) {
+    uint32_t primask;
+    __asm__ volatile ("mrs %0, primask\n\tcpsid i" : "=r"(primask) :: "memory");
+    return primask;
+}
+
+static inline void Rt_Irq_Restore(uint32_t Primask) {
+    __asm__ volatile ("msr primask, %0" :: "r"(Primask) : "memory");
+}
+
+// Sleeps till the next interrupt
+static inline void Rt_Wait_Irq(void) {
+    __asm__ volatile ("wfi" ::: "memory");
+}
+
+#endif
@@ -0,0 +1,300 @@
+/*****************************************************************************
+* | File      	:  	rt_timer.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Timer service of the Real Time core, software timers multiplexed on GPT0
+* | Info        :   GPT3 is the free running microsecond timebase, GPT0 (32 kHz, interrupt) is set to
+*                   the earliest deadline. Callbacks run in the GPT interrupt or from Rt_Timer_Dispatch.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : One shot / periodic timers, sorted deadline list, interrupt or main loop callbacks
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stddef.h>
+
+#include "rt_irq.h"
+#include "rt_timer.h"
+
+#define GPT_BASE			0x21030000u
+#define GPT_ISR				0x00	// Write 1 to clear, bit n for GPTn
+#define GPT_IER				0x04
+#define GPT0_CTRL			0x10	// [0] enable, [2] 1 kHz instead of 32 kHz clock
+#define GPT0_ICNT			0x14	// Ticks till the interrupt
+#define GPT3_CTRL			0x50
+#define GPT3_INIT			0x54
+#define GPT3_CNT			0x58
+
+#define GPT_CTRL_EN			0x1u
+#define GPT0_HZ				32768u
+// Deadlines closer than this are not worth an interrupt, they are waited for in place
+#define RT_TIMER_SPIN_US	40u
+
+static RT_TIMER *Armed = NULL;		// Sorted by deadline
+static RT_TIMER *DueHead = NULL;	// Expired main loop timers, in expiry order
+static RT_TIMER *DueTail = NULL;
+
+static void WriteReg32(uintptr_t baseAddr, size_t offset, uint32_t value) {
+    *(volatile uint32_t *)(baseAddr + offset) = value;
+}
+
+static uint32_t ReadReg32(uintptr_t baseAddr, size_t offset) {
+    return *(volatile uint32_t *)(baseAddr + offset);
+}
+
+// Wrap around safe "A is before B"
+#define RT_BEFORE(a, b)	((int32_t)((a) - (b)) < 0)
+
+/******************************************************************************
+function    : Starts the timebase and the GPT interrupt
+******************************************************************************/
+void Rt_Timer_Init(void) {
+    WriteReg32(GPT_BASE, GPT3_INIT, 0);
+    WriteReg32(GPT_BASE, GPT3_CTRL, (0x19u << 16) | GPT_CTRL_EN);	// OSC_CNT_1US, GPT3_EN
+
+    WriteReg32(GPT_BASE, GPT0_CTRL, 0);
+    WriteReg32(GPT_BASE, GPT_ISR, 0x1);
+    WriteReg32(GPT_BASE, GPT_IER, ReadReg32(GPT_BASE, GPT_IER) | 0x1);
+    Rt_Irq_Enable(RT_IRQ_GPT, RT_PRIO_TIMER);
+}
+
+uint32_t Rt_Timer_Now_Us(void) {
+    return ReadReg32(GPT_BASE, GPT3_CNT);
+}
+
+/******************************************************************************
+function    : Busy waits, only for short pulses
+******************************************************************************/
+void Rt_Timer_Wait_Us(uint32_t Us) {
+    uint32_t start = Rt_Timer_Now_Us();
+    while (Rt_Timer_Now_Us() - start < Us) {
+        // empty.
+    }
+}
+
+/******************************************************************************
+function    : Programs GPT0 for the head of the list, interrupts masked
+******************************************************************************/
+static void Rt_Timer_Program(void) {
+    uint32_t left;
+    uint32_t ticks;
+
+    WriteReg32(GPT_BASE, GPT0_CTRL, 0);
+    if (Armed == NULL) {
+        return;
+    }
+    left = Armed->Deadline - Rt_Timer_Now_Us();
+    if ((int32_t)left <= (int32_t)RT_TIMER_SPIN_US) {
+        left = RT_TIMER_SPIN_US;
+    }
+    // Rounded up, a timer never fires early
+    ticks = (uint32_t)(((uint64_t)left * GPT0_HZ + 999999u) / 1000000u);
+    WriteReg32(GPT_BASE, GPT0_ICNT, ticks);
+    WriteReg32(GPT_BASE, GPT0_CTRL, GPT_CTRL_EN);
+}
+
+/******************************************************************************
+function    : Links a timer in deadline order, interrupts masked
+******************************************************************************/
+static void Rt_Timer_Link(RT_TIMER *Timer) {
+    RT_TIMER **link = &Armed;
+
+    while (*link != NULL && !RT_BEFORE(Timer->Deadline, (*link)->Deadline)) {
+        link = &(*link)->Next;
+    }
+    Timer->Next = *link;
+    *link = Timer;
+    Timer->Armed = 1;
+}
+
+static void Rt_Timer_Unlink(RT_TIMER *Timer) {
+    RT_TIMER **link = &Armed;
+
+    while (*link != NULL && *link != Timer) {
+        link = &(*link)->Next;
+    }
+    if (*link != NULL) {
+        *link = Timer->Next;
+    }
+    Timer->Next = NULL;
+    Timer->Armed = 0;
+}
+
+/******************************************************************************
+function    : Sets up a timer, it is not armed yet
+parameter   :
+       Timer :   Timer, must stay valid while armed
+       Cb    :   Called on expiry
+       Ctx   :   Passed to Cb
+       Flags :   RT_TIMER_IN_IRQ to call Cb in the interrupt
+******************************************************************************/
+void Rt_Timer_Setup(RT_TIMER *Timer, RT_TIMER_CB Cb, void *Ctx, uint8_t Flags) {
+    Timer->Next = NULL;
+    Timer->DueNext = NULL;
+    Timer->Cb = Cb;
+    Timer->Ctx = Ctx;
+    Timer->Flags = Flags & RT_TIMER_IN_IRQ;
+    Timer->Armed = 0;
+    Timer->PeriodUs = 0;
+}
+
+/******************************************************************************
+function    : Arms a timer, an armed one is moved
+parameter   :
+       Timer    :   Timer set up with Rt_Timer_Setup
+       DelayUs  :   First expiry from now
+       PeriodUs :   Then every PeriodUs, 0 for one shot. Periodic deadlines 
+                    are kept on the grid so they do not drift.
+******************************************************************************/
+void Rt_Timer_Start(RT_TIMER *Timer, uint32_t DelayUs, uint32_t PeriodUs) {
+    uint32_t mask = Rt_Irq_Save();
+
+    if (Timer->Armed) {
+        Rt_Timer_Unlink(Timer);
+    }
+    Timer->Flags &= ~RT_TIMER_DUE;
+    Timer->Deadline = Rt_Timer_Now_Us() + DelayUs;
+    Timer->PeriodUs = PeriodUs;
+    Rt_Timer_Link(Timer);
+    if (Armed == Timer) {
+        Rt_Timer_Program();
+    }
+    Rt_Irq_Restore(mask);
+}
+
+/******************************************************************************
+function    : Disarms a timer, a pending main loop callback is dropped too
+******************************************************************************/
+void Rt_Timer_Stop(RT_TIMER *Timer) {
+    uint32_t mask = Rt_Irq_Save();
+    uint8_t head = (Armed == Timer);
+
+    if (Timer->Armed) {
+        Rt_Timer_Unlink(Timer);
+    }
+    if (Timer->Flags & RT_TIMER_DUE) {
+        RT_TIMER **link = &DueHead;
+        RT_TIMER *prev = NULL;
+
+        while (*link != Timer) {
+            prev = *link;
+            link = &(*link)->DueNext;
+        }
+        *link = Timer->DueNext;
+        if (DueTail == Timer) {
+            DueTail = prev;
+        }
+        Timer->DueNext = NULL;
+        Timer->Flags &= ~RT_TIMER_DUE;
+    }
+    if (head) {
+        Rt_Timer_Program();
+    }
+    Rt_Irq_Restore(mask);
+}
+
+/******************************************************************************
+function    : GPT interrupt, fires every expired timer then programs the next
+              deadline. Deadlines closer than RT_TIMER_SPIN_US are taken in 
+              the same interrupt.
+******************************************************************************/
+void Rt_Timer_Irq(void) {
+    WriteReg32(GPT_BASE, GPT_ISR, 0x1);
+    WriteReg32(GPT_BASE, GPT0_CTRL, 0);
+
+    while (Armed != NULL && RT_BEFORE(Armed->Deadline, Rt_Timer_Now_Us() + RT_TIMER_SPIN_US)) {
+        RT_TIMER *t = Armed;
+
+        while (RT_BEFORE(Rt_Timer_Now_Us(), t->Deadline)) {
+            // empty, less than RT_TIMER_SPIN_US.
+        }
+        Armed = t->Next;
+        t->Next = NULL;
+        t->Armed = 0;
+        if (t->PeriodUs != 0) {
+            t->Deadline += t->PeriodUs;
+            // After an overrun the grid restarts from now instead of catching up
+            if (RT_BEFORE(t->Deadline, Rt_Timer_Now_Us())) {
+                t->Deadline = Rt_Timer_Now_Us() + t->PeriodUs;
+            }
+            Rt_Timer_Link(t);
+        }
+
+        if (t->Flags & RT_TIMER_IN_IRQ) {
+            t->Cb(t->Ctx);
+        } else if (!(t->Flags & RT_TIMER_DUE)) {
+            // A periodic timer the main loop is late for runs once, not once per missed period
+            t->Flags |= RT_TIMER_DUE;
+            t->DueNext = NULL;
+            if (DueTail != NULL) {
+                DueTail->DueNext = t;
+            } else {
+                DueHead = t;
+            }
+            DueTail = t;
+        }
+    }
+    Rt_Timer_Program();
+}
+
+/******************************************************************************
+function    : Runs the callbacks of expired main loop timers
+return      : Number of callbacks run
+******************************************************************************/
+int Rt_Timer_Dispatch(void) {
+    int ran = 0;
+
+    for (;;) {
+        uint32_t mask = Rt_Irq_Save();
+        RT_TIMER *due = DueHead;
+
+        if (due != NULL) {
+            DueHead = due->DueNext;
+            if (DueHead == NULL) {
+                DueTail = NULL;
+            }
+            due->DueNext = NULL;
+            due->Flags &= ~RT_TIMER_DUE;
+        }
+        Rt_Irq_Restore(mask);
+
+        if (due == NULL) {
+            return ran;
+        }
+        due->Cb(due->Ctx);
+        ran++;
+    }
+}
+
+/******************************************************************************
+function    : Sleeps till the next interrupt. The due queue is checked with 
+              interrupts masked, a timer expiring meanwhile still wakes the core.
+******************************************************************************/
+void Rt_Timer_Sleep(void) {
+    uint32_t mask = Rt_Irq_Save();
+
+    if (DueHead == NULL) {
+        Rt_Wait_Irq();
+    }
+    Rt_Irq_Restore(mask);
+}
@@ -0,0 +1,67 @@
+/*****************************************************************************
+* | File      	:  	rt_timer.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Timer service of the Real Time core, software timers multiplexed on GPT0
+* | Info        :   GPT3 is the free running microsecond timebase, GPT0 (32 kHz, interrupt) is set to
+*                   the earliest deadline. Callbacks run in the GPT interrupt or from Rt_Timer_Dispatch.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : One shot / periodic timers, sorted deadline list, interrupt or main loop callbacks
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef RT_TIMER_H
+#define RT_TIMER_H
+
+#include <stdint.h>
+
+// Timer flags
+#define RT_TIMER_IN_IRQ		0x01	// Callback runs in the GPT interrupt, keep it short
+#define RT_TIMER_DUE		0x80	// Expired, waits for Rt_Timer_Dispatch (internal)
+
+typedef void (*RT_TIMER_CB)(void *Ctx);
+
+// One software timer, owned by the caller and linked into the service while armed
+typedef struct RT_TIMER {
+    struct RT_TIMER *Next;
+    struct RT_TIMER *DueNext;	// Queue of expired main loop timers
+    uint32_t Deadline;		// Rt_Timer_Now_Us time of expiry
+    uint32_t PeriodUs;		// 0 for a one shot timer
+    RT_TIMER_CB Cb;
+    void *Ctx;
+    uint8_t Flags;			// RT_TIMER_xxx
+    uint8_t Armed;
+} RT_TIMER;
+
+void Rt_Timer_Init(void);		// Starts GPT3 and the GPT interrupt
+uint32_t Rt_Timer_Now_Us(void);	// Free running, wraps after ~71 minutes
+void Rt_Timer_Setup(RT_TIMER *Timer, RT_TIMER_CB Cb, void *Ctx, uint8_t Flags);
+void Rt_Timer_Start(RT_TIMER *Timer, uint32_t DelayUs, uint32_t PeriodUs);	// (Re)arms a timer
+void Rt_Timer_Stop(RT_TIMER *Timer);
+int Rt_Timer_Dispatch(void);	// Runs expired main loop timers, returns how many ran
+void Rt_Timer_Sleep(void);		// Sleeps till the next interrupt unless a main loop timer is due
+void Rt_Timer_Wait_Us(uint32_t Us);	// Short busy wait, for pulses below the timer resolution
+void Rt_Timer_Irq(void);		// GPT interrupt handler, in the vector table
+
+#endif
@@ -0,0 +1,172 @@
+/*****************************************************************************
+* | File      	:  	rt_uart.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Debug UART of the Real Time core with an interrupt drained TX ring
+* | Info        :   Rt_Uart_Write only copies into the ring, the UART interrupt feeds the TX FIFO.
+*                   Output that does not fit is dropped and counted, the caller never waits.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : TX ring, THR empty interrupt, polled flush for fault paths
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stddef.h>
+
+#include "rt_irq.h"
+#include "rt_uart.h"
+
+#define UART_BASE			0x21040000u
+#define UART_THR			0x00
+#define UART_IER			0x04	// [1] THR empty interrupt
+#define UART_IIR			0x08	// Read
+#define UART_FCR			0x08	// Write
+#define UART_LCR			0x0C
+#define UART_LSR			0x14	// [5] THR / TX FIFO empty
+#define UART_IER_ETBEI		(1u << 1)
+#define UART_LSR_THRE		(1u << 5)
+#define UART_TX_FIFO		16		// Bytes the TX FIFO takes when empty
+
+#if (RT_UART_TX_SIZE & (RT_UART_TX_SIZE - 1)) != 0
+#error "RT_UART_TX_SIZE must be a power of two"
+#endif
+
+static char TxRing[RT_UART_TX_SIZE];
+static volatile uint32_t TxHead = 0;	// Written by Rt_Uart_Write
+static volatile uint32_t TxTail = 0;	// Written by the interrupt
+static uint32_t TxDropped = 0;
+
+static void WriteReg32(uintptr_t baseAddr, size_t offset, uint32_t value) {
+    *(volatile uint32_t *)(baseAddr + offset) = value;
+}
+
+static uint32_t ReadReg32(uintptr_t baseAddr, size_t offset) {
+    return *(volatile uint32_t *)(baseAddr + offset);
+}
+
+/******************************************************************************
+function    : Configures the UART to 115200-8-N-1 with FIFOs, TX interrupt off
+              till there is something to send
+******************************************************************************/
+void Rt_Uart_Init(void) {
+    WriteReg32(UART_BASE, UART_LCR, 0x80); // LCR (enable DLL, DLM)
+    WriteReg32(UART_BASE, 0x24, 0x3);  // HIGHSPEED
+    WriteReg32(UART_BASE, 0x04, 0);    // Divisor Latch (MS)
+    WriteReg32(UART_BASE, 0x00, 1);    // Divisor Latch (LS)
+    WriteReg32(UART_BASE, 0x28, 224);  // SAMPLE_COUNT
+    WriteReg32(UART_BASE, 0x2C, 110);  // SAMPLE_POINT
+    WriteReg32(UART_BASE, 0x58, 0);    // FRACDIV_M
+    WriteReg32(UART_BASE, 0x54, 223);  // FRACDIV_L
+    WriteReg32(UART_BASE, UART_LCR, 0x03); // LCR (8-bit word length)
+
+    WriteReg32(UART_BASE, UART_FCR, 0x07);	// FIFOs on and cleared
+    WriteReg32(UART_BASE, UART_IER, 0);
+    Rt_Irq_Enable(RT_IRQ_UART, RT_PRIO_UART);
+}
+
+/******************************************************************************
+function    : Moves up to one FIFO of bytes from the ring to the UART
+******************************************************************************/
+static void Rt_Uart_Feed(void) {
+    uint32_t n = 0;
+
+    while (TxTail != TxHead && n < UART_TX_FIFO) {
+        WriteReg32(UART_BASE, UART_THR, (uint8_t)TxRing[TxTail & (RT_UART_TX_SIZE - 1)]);
+        TxTail++;
+        n++;
+    }
+    WriteReg32(UART_BASE, UART_IER, (TxTail != TxHead) ? UART_IER_ETBEI : 0);
+}
+
+/******************************************************************************
+function    : Queues a string
+parameter   :
+       Msg  :   Zero terminated string
+return      : Bytes queued, the rest was dropped on a full ring
+******************************************************************************/
+int Rt_Uart_Write(const char *Msg) {
+    uint32_t mask = Rt_Irq_Save();
+    int n = 0;
+
+    while (*Msg) {
+        if (TxHead - TxTail >= RT_UART_TX_SIZE) {
+            while (*Msg++) {
+                TxDropped++;
+            }
+            break;
+        }
+        TxRing[TxHead & (RT_UART_TX_SIZE - 1)] = *Msg++;
+        TxHead++;
+        n++;
+    }
+    // The THR empty interrupt comes right away if the FIFO is idle
+    if (TxHead != TxTail) {
+        WriteReg32(UART_BASE, UART_IER, UART_IER_ETBEI);
+    }
+    Rt_Irq_Restore(mask);
+    return n;
+}
+
+/******************************************************************************
+function    : Queues a number in decimal
+******************************************************************************/
+int Rt_Uart_Write_Dec(uint32_t Value) {
+    char text[11];
+    int i = sizeof(text) - 1;
+
+    text[i] = 0;
+    do {
+        text[--i] = (char)('0' + Value % 10);
+        Value /= 10;
+    } while (Value != 0);
+    return Rt_Uart_Write(&text[i]);
+}
+
+/******************************************************************************
+function    : Sends everything queued without the interrupt, for fault paths
+******************************************************************************/
+void Rt_Uart_Flush(void) {
+    uint32_t mask = Rt_Irq_Save();
+
+    while (TxTail != TxHead) {
+        while (!(ReadReg32(UART_BASE, UART_LSR) & UART_LSR_THRE)) {
+            // empty.
+        }
+        Rt_Uart_Feed();
+    }
+    Rt_Irq_Restore(mask);
+}
+
+uint32_t Rt_Uart_Dropped(void) {
+    return TxDropped;
+}
+
+/******************************************************************************
+function    : UART interrupt, refills the TX FIFO once it ran empty
+******************************************************************************/
+void Rt_Uart_Irq(void) {
+    (void)ReadReg32(UART_BASE, UART_IIR);	// Acknowledges the THR empty interrupt
+    if (ReadReg32(UART_BASE, UART_LSR) & UART_LSR_THRE) {
+        Rt_Uart_Feed();
+    }
+}
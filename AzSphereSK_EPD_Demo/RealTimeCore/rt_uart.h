@@ -0,0 +1,50 @@
+/*****************************************************************************
+* | File      	:  	rt_uart.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Debug UART of the Real Time core with an interrupt drained TX ring
+* | Info        :   Rt_Uart_Write only copies into the ring, the UART interrupt feeds the TX FIFO.
+*                   Output that does not fit is dropped and counted, the caller never waits.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : TX ring, THR empty interrupt, polled flush for fault paths
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef RT_UART_H
+#define RT_UART_H
+
+#include <stdint.h>
+
+#ifndef RT_UART_TX_SIZE
+#define RT_UART_TX_SIZE		1024	// TX ring, power of two
+#endif
+
+void Rt_Uart_Init(void);		// 115200-8-N-1 and the UART interrupt
+int Rt_Uart_Write(const char *Msg);	// Queues a string, returns the bytes queued
+int Rt_Uart_Write_Dec(uint32_t Value);	// Queues a decimal number
+void Rt_Uart_Flush(void);		// Polls the ring out, interrupts masked, for fault paths
+uint32_t Rt_Uart_Dropped(void);	// Bytes dropped on a full ring
+void Rt_Uart_Irq(void);			// UART interrupt handler, in the vector table
+
+#endif
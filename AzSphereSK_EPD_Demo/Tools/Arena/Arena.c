@@ -0,0 +1,194 @@
+/*****************************************************************************
+* | File      	:  	Arena.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Static arena for frame buffers, band buffers, QR Code scratch and caches
+* | Info        :   See Arena.h
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Static buffer, lifetime allocations from the top, scoped scratch from the bottom
+* 2. Added : Per subsystem use and peak, high-water mark and failed allocations, Arena_Dump
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stddef.h>
+
+#include "../../HighLevelCore/applibs_versions.h"
+#include <applibs/log.h>
+
+#include "Arena.h"
+
+#if (ARENA_ALIGN & (ARENA_ALIGN - 1)) != 0
+#error "ARENA_ALIGN must be a power of two"
+#endif
+
+#define ARENA_NONE			UINT32_MAX
+#define ARENA_ROUND(Size)	(((Size) + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1))
+
+// In front of every scratch block, Arena_Release walks them back to give the bytes to their subsystem
+typedef struct {
+    uint32_t Prev;			// Offset of the header before, ARENA_NONE for the first
+    uint32_t Bytes;			// Block and header
+    uint8_t Subsystem;
+} ARENA_HEADER;
+
+#define ARENA_HEADER_SIZE	ARENA_ROUND((uint32_t)sizeof(ARENA_HEADER))
+
+static _Alignas(ARENA_ALIGN) uint8_t Pool[ARENA_SIZE];
+static uint32_t Bottom;					// End of the scratch, grows up
+static uint32_t Top = ARENA_SIZE;		// Start of the lifetime blocks, grows down
+static uint32_t Last = ARENA_NONE;		// Header of the newest scratch block
+static ARENA_STATS Stats;
+
+static const char *const SubsystemName[ARENA_SUBSYSTEMS] = { "frame", "band", "qr", "cache", "other" };
+
+/******************************************************************************
+function    : Counts Bytes more for Subsystem, updating the peaks
+******************************************************************************/
+static void Arena_Account(uint8_t Subsystem, uint32_t Bytes) {
+    Stats.Used[Subsystem] += Bytes;
+    if (Stats.Used[Subsystem] > Stats.Peak[Subsystem]) {
+        Stats.Peak[Subsystem] = Stats.Used[Subsystem];
+    }
+    Stats.Scratch = Bottom;
+    Stats.Lifetime = ARENA_SIZE - Top;
+    if (Stats.Scratch + Stats.Lifetime > Stats.HighWater) {
+        Stats.HighWater = Stats.Scratch + Stats.Lifetime;
+    }
+}
+
+/******************************************************************************
+function    : Checks an allocation request
+return      : Rounded size in bytes, 0 if it does not fit
+******************************************************************************/
+static uint32_t Arena_Check(const char *Func, uint8_t Subsystem, uint32_t Size, uint32_t Extra) {
+    if (Subsystem >= ARENA_SUBSYSTEMS || Size == 0 || Size > ARENA_SIZE) {
+        Log_Debug("ERROR : %s : Bad request, subsystem %d size %u\n", Func, Subsystem, Size);
+        Stats.Failed++;
+        return 0;
+    }
+    uint32_t Bytes = ARENA_ROUND(Size) + Extra;
+    if (Bytes > Top - Bottom) {
+        Log_Debug("ERROR : %s : Out of memory, %s wants %u bytes, %u free of %u\n", Func, SubsystemName[Subsystem], Bytes, Top - Bottom, ARENA_SIZE);
+        Stats.Failed++;
+        return 0;
+    }
+    return Bytes;
+}
+
+/******************************************************************************
+function    : Takes a scratch block, valid till Arena_Release of a mark taken 
+              before it. Not cleared.
+parameter   :
+       Subsystem :   ARENA_xxx the block is counted for
+       Size      :   Bytes
+return      : Block aligned to ARENA_ALIGN, NULL if it does not fit
+******************************************************************************/
+void *Arena_Alloc(uint8_t Subsystem, uint32_t Size) {
+    uint32_t Bytes = Arena_Check("Arena_Alloc", Subsystem, Size, ARENA_HEADER_SIZE);
+    if (Bytes == 0) {
+        return NULL;
+    }
+
+    ARENA_HEADER *Header = (ARENA_HEADER *)&Pool[Bottom];
+    Header->Prev = Last;
+    Header->Bytes = Bytes;
+    Header->Subsystem = Subsystem;
+    Last = Bottom;
+    Bottom += Bytes;
+    Arena_Account(Subsystem, Bytes);
+    return (uint8_t *)Header + ARENA_HEADER_SIZE;
+}
+
+/******************************************************************************
+function    : Takes a block for the life of the app, from the other end of the 
+              arena so it can be taken inside a scope. Not cleared.
+parameter   :
+       Subsystem :   ARENA_xxx the block is counted for
+       Size      :   Bytes
+return      : Block aligned to ARENA_ALIGN, NULL if it does not fit
+******************************************************************************/
+void *Arena_Alloc_Lifetime(uint8_t Subsystem, uint32_t Size) {
+    uint32_t Bytes = Arena_Check("Arena_Alloc_Lifetime", Subsystem, Size, 0);
+    if (Bytes == 0) {
+        return NULL;
+    }
+
+    Top -= Bytes;
+    Arena_Account(Subsystem, Bytes);
+    return &Pool[Top];
+}
+
+/******************************************************************************
+function    : Opens a scratch scope
+return      : Mark to give to Arena_Release
+******************************************************************************/
+ARENA_MARK Arena_Mark(void) {
+    return Bottom;
+}
+
+/******************************************************************************
+function    : Frees every scratch block taken since Mark, scopes nest
+parameter   :
+       Mark :   From Arena_Mark
+******************************************************************************/
+void Arena_Release(ARENA_MARK Mark) {
+    if (Mark > Bottom) {
+        Log_Debug("ERROR : Arena_Release : Mark %u is above the scratch end %u, released twice ?\n", Mark, Bottom);
+        return;
+    }
+    while (Last != ARENA_NONE && Last >= Mark) {
+        ARENA_HEADER *Header = (ARENA_HEADER *)&Pool[Last];
+        Stats.Used[Header->Subsystem] -= Header->Bytes;
+        Last = Header->Prev;
+    }
+    Bottom = Mark;
+    Stats.Scratch = Bottom;
+}
+
+/******************************************************************************
+function    : Bytes left between the scratch and the lifetime blocks
+******************************************************************************/
+uint32_t Arena_Free(void) {
+    return Top - Bottom;
+}
+
+/******************************************************************************
+function    : Copies the use and peak counters
+******************************************************************************/
+void Arena_Get_Stats(ARENA_STATS *Out) {
+    *Out = Stats;
+}
+
+/******************************************************************************
+function    : Prints the use and peak of every subsystem and the high-water mark
+******************************************************************************/
+void Arena_Dump(void) {
+    Log_Debug("Arena : %u of %u bytes peak, %u lifetime, %u scratch, %u failed\n", Stats.HighWater, ARENA_SIZE, Stats.Lifetime, Stats.Scratch, Stats.Failed);
+    for (uint8_t i = 0; i < ARENA_SUBSYSTEMS; i++) {
+        if (Stats.Peak[i] == 0) {
+            continue;
+        }
+        Log_Debug("  %-6s %6u bytes now %6u peak\n", SubsystemName[i], Stats.Used[i], Stats.Peak[i]);
+    }
+}
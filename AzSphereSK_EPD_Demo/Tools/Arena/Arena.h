@@ -0,0 +1,76 @@
+/*****************************************************************************
+* | File      	:  	Arena.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Static arena for frame buffers, band buffers, QR Code scratch and caches
+* | Info        :   One buffer of ARENA_SIZE bytes fixed at compile time, no malloc. Buffers that live as long as
+*                   the app are taken from its top, scratch is taken from its bottom in scopes
+*                   (Arena_Mark / Arena_Release). Use and peak are kept per subsystem.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Static buffer, lifetime allocations from the top, scoped scratch from the bottom
+* 2. Added : Per subsystem use and peak, high-water mark and failed allocations, Arena_Dump
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __ARENA_H_
+#define __ARENA_H_
+
+#include <stdint.h>
+
+// Size of the arena, set it per build (-DARENA_SIZE=65536) once Arena_Dump shows the peak
+#ifndef ARENA_SIZE
+#define ARENA_SIZE			(32 * 1024)
+#endif
+#define ARENA_ALIGN			8		// Every block starts at a multiple of this
+
+// Who the memory is for, the use and peak are reported per subsystem
+#define ARENA_FRAME			0		// Frame buffers
+#define ARENA_BAND			1		// Band and overlay buffers
+#define ARENA_QR			2		// QR Code encoder scratch
+#define ARENA_CACHE			3		// Caches (QR Code, glyphs)
+#define ARENA_OTHER			4
+#define ARENA_SUBSYSTEMS	5
+
+// Scratch level to go back to, from Arena_Mark
+typedef uint32_t ARENA_MARK;
+
+typedef struct {
+    uint32_t Used[ARENA_SUBSYSTEMS];	// Bytes held now, headers and padding included
+    uint32_t Peak[ARENA_SUBSYSTEMS];	// Most bytes ever held at once
+    uint32_t Scratch;					// Bytes held by the scratch end
+    uint32_t Lifetime;					// Bytes held by the lifetime end
+    uint32_t HighWater;					// Most bytes of the arena ever in use
+    uint32_t Failed;					// Allocations that did not fit
+} ARENA_STATS;
+
+// Not thread safe, allocate from one thread (the one rendering)
+void *Arena_Alloc(uint8_t Subsystem, uint32_t Size);			// Scratch, freed by Arena_Release
+void *Arena_Alloc_Lifetime(uint8_t Subsystem, uint32_t Size);	// Never freed
+ARENA_MARK Arena_Mark(void);				// Opens a scope
+void Arena_Release(ARENA_MARK Mark);		// Frees the scratch taken since Mark
+uint32_t Arena_Free(void);					// Bytes left between the two ends
+void Arena_Get_Stats(ARENA_STATS *Stats);
+void Arena_Dump(void);						// Use and peak through Log_Debug
+
+#endif
@@ -0,0 +1,461 @@
+/*****************************************************************************
+* | File      	:  	epd_replay.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Host replay and analysis of an EPD command stream trace (Common/epd_trace.h)
+* | Info        :   Runs the trace of EPD_Capture_Start against a virtual IL3820 per display, writes
+*                   the frame of every MASTER_ACTIVATION as PBM and reports per command cost,
+*                   redundant register writes and delay time that could be saved.
+*                   Build on a Linux / macOS host, from AzSphereSK_EPD_Demo :
+*                   cc -O2 -o epd_replay Tools/EpdReplay/epd_replay.c
+*                   ./epd_replay trace.bin [frame file prefix]
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Virtual IL3820 replay, frame PBM output, command cost, redundant write and delay report
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../Common/epd_trace.h"
+
+#define RP_WIDTH_BYTE		16
+#define RP_HEIGHT			296
+#define RP_DEVICES			16		// One per tag nibble
+#define RP_MAX_ARGS			64
+#define RP_RESET_MIN_US		10000	// Reset pulse the IL3820 needs, longer pulses count as waste
+
+// Commands whose parameters are compared with the previous write
+#define RP_SHADOWED(Cmd)	((Cmd) != 0x24 && (Cmd) != 0x20 && (Cmd) != 0xFF && (Cmd) != 0x12 && (Cmd) != 0x10)
+
+typedef struct {
+    uint32_t Count;
+    uint32_t Bytes;			// Parameter bytes
+    uint64_t Us;			// Host time from the command till the next record that is not its data
+    uint32_t Redundant;		// Writes of the value the register already had
+    uint32_t RedundantBytes;
+} RP_CMD_STAT;
+
+// Virtual IL3820, only what changes the RAM and its addressing
+typedef struct {
+    uint8_t Seen;
+    int Cmd;					// Command taking the data bytes, -1 before the first
+    uint8_t Args[RP_MAX_ARGS];
+    uint8_t ArgCount;
+    uint8_t Entry;				// DATA_ENTRY_MODE_SETTING, reset value X and Y increment, X first
+    uint8_t Xs, Xe, Xc;
+    uint16_t Ys, Ye, Yc;
+    uint8_t Ram[RP_HEIGHT][RP_WIDTH_BYTE];
+    uint32_t RamBytes;			// Written since the last MASTER_ACTIVATION
+    uint8_t Reg[256][RP_MAX_ARGS];	// Last parameters of every command
+    uint8_t RegLen[256];
+    uint8_t RegValid[256];
+    uint8_t BusyHigh;
+    uint64_t RstLowUs;
+    uint8_t RstLow;
+    uint32_t Frames;
+    uint64_t FrameUs;			// Time of the last MASTER_ACTIVATION
+} RP_PANEL;
+
+static RP_PANEL Panels[RP_DEVICES];
+static RP_CMD_STAT Cmds[256];
+
+// Where the time of the trace went
+static struct {
+    uint64_t NowUs;
+    uint64_t CmdUs;				// SPI and host time charged to commands
+    uint64_t BusyUs;			// Waiting for BUSY
+    uint64_t DelayUs;			// All fixed delays
+    uint64_t DelayOverlapUs;	// Delays that ended with the display still BUSY, not lost
+    uint64_t DelayIdleUs;		// Delays that ended with the display already idle, at most this much lost
+    uint64_t ResetExtraUs;		// Reset pulses beyond RP_RESET_MIN_US
+    uint32_t Records;
+    uint32_t Frames;
+} Total;
+
+static const char *Rp_Name(int Cmd) {
+    switch (Cmd) {
+    case 0x01: return "DRIVER_OUTPUT_CONTROL";
+    case 0x0C: return "BOOSTER_SOFT_START";
+    case 0x0F: return "GATE_SCAN_START";
+    case 0x10: return "DEEP_SLEEP_MODE";
+    case 0x11: return "DATA_ENTRY_MODE";
+    case 0x12: return "SW_RESET";
+    case 0x1A: return "TEMPERATURE_SENSOR";
+    case 0x20: return "MASTER_ACTIVATION";
+    case 0x21: return "DISPLAY_UPDATE_CTRL_1";
+    case 0x22: return "DISPLAY_UPDATE_CTRL_2";
+    case 0x24: return "WRITE_RAM";
+    case 0x2C: return "WRITE_VCOM";
+    case 0x32: return "WRITE_LUT";
+    case 0x3A: return "DUMMY_LINE_PERIOD";
+    case 0x3B: return "GATE_TIME";
+    case 0x3C: return "BORDER_WAVEFORM";
+    case 0x44: return "RAM_X_START_END";
+    case 0x45: return "RAM_Y_START_END";
+    case 0x4E: return "RAM_X_COUNTER";
+    case 0x4F: return "RAM_Y_COUNTER";
+    case 0xFF: return "TERMINATE_FRAME";
+    default: return "?";
+    }
+}
+
+static void Rp_Forget(RP_PANEL *P) {
+    memset(P->RegValid, 0, sizeof(P->RegValid));
+    P->Entry = 0x03;
+}
+
+/******************************************************************************
+function    : Ends the parameters of the current command, compares them with the 
+              previous write of the same register
+******************************************************************************/
+static void Rp_End_Command(RP_PANEL *P) {
+    int cmd = P->Cmd;
+
+    if (cmd < 0 || !RP_SHADOWED(cmd)) {
+        return;
+    }
+    if (P->RegValid[cmd] && P->RegLen[cmd] == P->ArgCount && memcmp(P->Reg[cmd], P->Args, P->ArgCount) == 0) {
+        Cmds[cmd].Redundant++;
+        Cmds[cmd].RedundantBytes += 1u + P->ArgCount;
+    }
+    memcpy(P->Reg[cmd], P->Args, P->ArgCount);
+    P->RegLen[cmd] = P->ArgCount;
+    P->RegValid[cmd] = 1;
+}
+
+static void Rp_Write_Pbm(const char *Prefix, int Dev, uint32_t Frame, uint8_t Ram[RP_HEIGHT][RP_WIDTH_BYTE]) {
+    char name[512];
+    FILE *f;
+
+    snprintf(name, sizeof(name), "%s_d%d_f%03u.pbm", Prefix, Dev, (unsigned)Frame);
+    f = fopen(name, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not write %s\n", name);
+        return;
+    }
+    // Panel RAM has 1 for white, PBM 1 for black
+    fprintf(f, "P4\n%d %d\n", RP_WIDTH_BYTE * 8, RP_HEIGHT);
+    for (int y = 0; y < RP_HEIGHT; y++) {
+        for (int x = 0; x < RP_WIDTH_BYTE; x++) {
+            fputc(~Ram[y][x] & 0xFF, f);
+        }
+    }
+    fclose(f);
+}
+
+/******************************************************************************
+function    : Moves the RAM address counter after a data byte, as set by 
+              DATA_ENTRY_MODE_SETTING (bit 0 X increment, bit 1 Y increment, 
+              bit 2 Y first)
+******************************************************************************/
+static void Rp_Advance(RP_PANEL *P) {
+    int xinc = P->Entry & 0x01, yinc = P->Entry & 0x02;
+    int xwrap, ywrap;
+
+    if (!(P->Entry & 0x04)) {
+        xwrap = (P->Xc == (xinc ? P->Xe : P->Xs));
+        P->Xc = xwrap ? (xinc ? P->Xs : P->Xe) : (uint8_t)(P->Xc + (xinc ? 1 : -1));
+        if (xwrap) {
+            ywrap = (P->Yc == (yinc ? P->Ye : P->Ys));
+            P->Yc = ywrap ? (yinc ? P->Ys : P->Ye) : (uint16_t)(P->Yc + (yinc ? 1 : -1));
+        }
+    } else {
+        ywrap = (P->Yc == (yinc ? P->Ye : P->Ys));
+        P->Yc = ywrap ? (yinc ? P->Ys : P->Ye) : (uint16_t)(P->Yc + (yinc ? 1 : -1));
+        if (ywrap) {
+            xwrap = (P->Xc == (xinc ? P->Xe : P->Xs));
+            P->Xc = xwrap ? (xinc ? P->Xs : P->Xe) : (uint8_t)(P->Xc + (xinc ? 1 : -1));
+        }
+    }
+}
+
+static void Rp_Data(RP_PANEL *P, uint8_t b) {
+    if (P->Cmd == 0x24) {
+        if (P->Yc < RP_HEIGHT && P->Xc < RP_WIDTH_BYTE) {
+            P->Ram[P->Yc][P->Xc] = b;
+        }
+        P->RamBytes++;
+        Rp_Advance(P);
+        // The data moves the address counters
+        P->RegValid[0x4E] = 0;
+        P->RegValid[0x4F] = 0;
+        return;
+    }
+    if (P->Cmd < 0) {
+        return;
+    }
+    if (P->ArgCount < RP_MAX_ARGS) {
+        P->Args[P->ArgCount++] = b;
+    }
+    Cmds[P->Cmd].Bytes++;
+    if (P->Cmd == 0x11 && P->ArgCount == 1) {
+        P->Entry = b & 0x07;
+    } else if (P->Cmd == 0x44 && P->ArgCount == 2) {
+        P->Xs = P->Args[0] & 0x1F;
+        P->Xe = P->Args[1] & 0x1F;
+    } else if (P->Cmd == 0x45 && P->ArgCount == 4) {
+        P->Ys = (P->Args[0] | P->Args[1] << 8) & 0x1FF;
+        P->Ye = (P->Args[2] | P->Args[3] << 8) & 0x1FF;
+    } else if (P->Cmd == 0x4E && P->ArgCount == 1) {
+        P->Xc = P->Args[0] & 0x1F;
+    } else if (P->Cmd == 0x4F && P->ArgCount == 2) {
+        P->Yc = (P->Args[0] | P->Args[1] << 8) & 0x1FF;
+    }
+}
+
+static void Rp_Command(RP_PANEL *P, int Dev, uint8_t b, const char *Prefix) {
+    Rp_End_Command(P);
+    P->Cmd = b;
+    P->ArgCount = 0;
+    Cmds[b].Count++;
+
+    if (b == 0x12 || b == 0x10) {
+        // SW reset and deep sleep lose the registers
+        Rp_Forget(P);
+    } else if (b == 0x20) {
+        // MASTER_ACTIVATION, the panel shows the RAM
+        printf("frame %3u  display %d  at %9.1f ms  %5u RAM bytes since the last frame\n",
+               (unsigned)Total.Frames, Dev, Total.NowUs / 1000.0, (unsigned)P->RamBytes);
+        if (Prefix != NULL) {
+            Rp_Write_Pbm(Prefix, Dev, P->Frames, P->Ram);
+        }
+        P->Frames++;
+        P->FrameUs = Total.NowUs;
+        P->RamBytes = 0;
+        Total.Frames++;
+    }
+}
+
+static int Rp_Varint(const uint8_t **Pos, const uint8_t *End, uint32_t *Value) {
+    uint32_t v = 0;
+    int shift = 0;
+
+    while (*Pos < End && shift < 35) {
+        uint8_t b = *(*Pos)++;
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *Value = v;
+            return 0;
+        }
+        shift += 7;
+    }
+    return -1;
+}
+
+/******************************************************************************
+function    : Replays a whole trace
+parameter   :
+       Trace  :   Trace bytes, header included
+       Len    :   No of bytes
+       Prefix :   Frame PBM file prefix, NULL for no files
+return      : 0 on Success, -1 for a broken trace, -2 if it is no trace
+******************************************************************************/
+static int Rp_Run(const uint8_t *Trace, uint32_t Len, const char *Prefix) {
+    const uint8_t *pos = Trace + EPD_TRACE_HEADER_BYTES;
+    const uint8_t *end = Trace + Len;
+    uint8_t prevType = 0;
+    uint8_t prevBusyWaitHigh = 0;
+    int lastCmd = -1;
+    uint64_t delayStart = 0;
+    int delayPending = 0;
+
+    if (Len < EPD_TRACE_HEADER_BYTES || memcmp(Trace, EPD_TRACE_MAGIC, 4) != 0 || Trace[4] != EPD_TRACE_VERSION) {
+        fprintf(stderr, "Not an epd_trace version %d\n", EPD_TRACE_VERSION);
+        return -2;
+    }
+
+    while (pos < end) {
+        uint8_t tag = *pos++;
+        uint8_t type = tag & EPD_TRACE_TYPE_MASK;
+        int dev = tag >> 4;
+        RP_PANEL *P = &Panels[dev];
+        uint32_t dt, value;
+
+        if (Rp_Varint(&pos, end, &dt) != 0 || Rp_Varint(&pos, end, &value) != 0) {
+            fprintf(stderr, "Trace cut inside record %u\n", (unsigned)Total.Records);
+            return -1;
+        }
+        Total.NowUs += dt;
+        Total.Records++;
+
+        // The time since the previous record belongs to what that record started
+        if (prevType == EPD_TRACE_DELAY) {
+            Total.DelayUs += dt;
+        } else if (prevType == EPD_TRACE_BUSY && prevBusyWaitHigh) {
+            Total.BusyUs += dt;
+        } else if (lastCmd >= 0) {
+            Cmds[lastCmd].Us += dt;
+            Total.CmdUs += dt;
+        }
+        prevType = type;
+        prevBusyWaitHigh = 0;
+
+        // A delay is judged by the first thing after it
+        if (delayPending && type != EPD_TRACE_DELAY) {
+            if (type == EPD_TRACE_BUSY && (value & EPD_TRACE_BUSY_WAIT)) {
+                if (value & EPD_TRACE_BUSY_HIGH) {
+                    Total.DelayOverlapUs += Total.NowUs - delayStart;
+                } else {
+                    Total.DelayIdleUs += Total.NowUs - delayStart;
+                }
+            }
+            delayPending = 0;
+        }
+
+        if (dev != EPD_TRACE_NO_DEVICE && !P->Seen) {
+            P->Seen = 1;
+            P->Cmd = -1;
+            Rp_Forget(P);
+        }
+
+        switch (type) {
+        case EPD_TRACE_CMD:
+        case EPD_TRACE_DATA:
+            if ((uint32_t)(end - pos) < value) {
+                fprintf(stderr, "Trace cut inside record %u\n", (unsigned)Total.Records);
+                return -1;
+            }
+            for (uint32_t i = 0; i < value; i++) {
+                if (type == EPD_TRACE_CMD) {
+                    Rp_Command(P, dev, pos[i], Prefix);
+                    lastCmd = pos[i];
+                } else {
+                    Rp_Data(P, pos[i]);
+                }
+            }
+            pos += value;
+            break;
+        case EPD_TRACE_BUSY:
+            P->BusyHigh = value & EPD_TRACE_BUSY_HIGH;
+            prevBusyWaitHigh = (value & EPD_TRACE_BUSY_WAIT) && P->BusyHigh;
+            if (!P->BusyHigh && P->Frames != 0 && P->FrameUs != 0 && !(value & EPD_TRACE_BUSY_WAIT)) {
+                printf("           display %d  BUSY dropped %.1f ms after MASTER_ACTIVATION\n", dev, (Total.NowUs - P->FrameUs) / 1000.0);
+                P->FrameUs = 0;
+            }
+            break;
+        case EPD_TRACE_RST:
+            if (!value) {
+                P->RstLow = 1;
+                P->RstLowUs = Total.NowUs;
+            } else if (P->RstLow) {
+                uint64_t pulse = Total.NowUs - P->RstLowUs;
+                if (pulse > RP_RESET_MIN_US) {
+                    Total.ResetExtraUs += pulse - RP_RESET_MIN_US;
+                }
+                P->RstLow = 0;
+                Rp_End_Command(P);
+                P->Cmd = -1;
+                Rp_Forget(P);
+            }
+            break;
+        case EPD_TRACE_DELAY:
+            delayPending = 1;
+            delayStart = Total.NowUs;
+            break;
+        default:
+            fprintf(stderr, "Unknown record type %d\n", type);
+            return -1;
+        }
+    }
+
+    for (int d = 0; d < RP_DEVICES; d++) {
+        if (Panels[d].Seen) {
+            Rp_End_Command(&Panels[d]);
+        }
+    }
+    return 0;
+}
+
+static void Rp_Report(void) {
+    uint32_t redundant = 0, redundantBytes = 0;
+
+    printf("\n%u records, %.1f ms, %u frames\n", (unsigned)Total.Records, Total.NowUs / 1000.0, (unsigned)Total.Frames);
+    printf("\ncommand                  code  count  param bytes  time ms  avg us  redundant\n");
+    for (int c = 0; c < 256; c++) {
+        RP_CMD_STAT *s = &Cmds[c];
+        if (s->Count == 0) {
+            continue;
+        }
+        printf("%-22s   0x%02X %6u %12u %8.1f %7.0f %10u\n", Rp_Name(c), c, (unsigned)s->Count, (unsigned)s->Bytes,
+               s->Us / 1000.0, (double)s->Us / s->Count, (unsigned)s->Redundant);
+        redundant += s->Redundant;
+        redundantBytes += s->RedundantBytes;
+    }
+
+    printf("\nTime    commands and data %9.1f ms\n", Total.CmdUs / 1000.0);
+    printf("        waiting for BUSY  %9.1f ms\n", Total.BusyUs / 1000.0);
+    printf("        fixed delays      %9.1f ms\n", Total.DelayUs / 1000.0);
+    printf("Waste   redundant writes  %9u commands, %u bytes\n", (unsigned)redundant, (unsigned)redundantBytes);
+    printf("        delays ending with the display already idle  %9.1f ms (upper bound)\n", Total.DelayIdleUs / 1000.0);
+    printf("        delays overlapping BUSY, not lost           %9.1f ms\n", Total.DelayOverlapUs / 1000.0);
+    printf("        reset pulses beyond %d ms                   %9.1f ms\n", RP_RESET_MIN_US / 1000, Total.ResetExtraUs / 1000.0);
+}
+
+int main(int argc, char **argv) {
+    FILE *f;
+    uint8_t *trace;
+    long len;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage : %s trace.bin [frame file prefix]\n", argv[0]);
+        return 2;
+    }
+    f = fopen(argv[1], "rb");
+    if (f == NULL) {
+        perror(argv[1]);
+        return 2;
+    }
+    fseek(f, 0, SEEK_END);
+    len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    trace = malloc(len > 0 ? (size_t)len : 1);
+    if (trace == NULL || fread(trace, 1, (size_t)len, f) != (size_t)len) {
+        fprintf(stderr, "Could not read %s\n", argv[1]);
+        fclose(f);
+        return 2;
+    }
+    fclose(f);
+
+    // A broken trace is still reported up to where it broke
+    int ret = Rp_Run(trace, (uint32_t)len, (argc > 2) ? argv[2] : NULL);
+    if (ret == -2) {
+        free(trace);
+        return 1;
+    }
+    Rp_Report();
+    if (argc > 2) {
+        for (int d = 0; d < RP_DEVICES; d++) {
+            if (Panels[d].Seen) {
+                char name[512];
+                snprintf(name, sizeof(name), "%s_d%d_ram", argv[2], d);
+                Rp_Write_Pbm(name, d, 0, Panels[d].Ram);
+            }
+        }
+    }
+    free(trace);
+    return (ret == 0) ? 0 : 1;
+}
@@ -0,0 +1,340 @@
+/*****************************************************************************
+* | File      	:  	epd_sim.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Host simulation of the Real Time core EPD engine, two processes and shared memory
+* | Info        :   The child process runs RealTimeCore/epd_engine.c on a virtual IL3820, the parent is
+*                   the High Level side (EPD/EPD_Remote.c). Both talk through epd_ring buffers in
+*                   shared memory, laid out as the inter-core buffers on the device.
+*                   Build on a Linux / macOS host, from AzSphereSK_EPD_Demo :
+*                   cc -O2 -DEPD_REMOTE_HOST -o epd_sim Tools/EpdSim/epd_sim.c EPD/EPD_Remote.c \
+*                      Common/epd_ring.c RealTimeCore/epd_engine.c
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Virtual IL3820 (RAM window, counters, BUSY), full frame and delta rectangle run
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "../../Common/epd_remote.h"
+#include "../../Common/epd_ring.h"
+#include "../../RealTimeCore/epd_hal.h"
+#include "../../RealTimeCore/epd_engine.h"
+#include "../../EPD/EPD_Remote.h"
+
+#define SIM_RING_BYTES		4096	// Each direction, header included
+#define SIM_WIDTH_BYTE		16
+#define SIM_HEIGHT			296
+#define SIM_UPDATE_US		(300u * 1000u)	// BUSY time of MASTER_ACTIVATION
+#define SIM_RESET_BUSY_US	(5u * 1000u)	// BUSY time after the reset pulse
+
+// Everything both processes see
+typedef struct {
+    uint8_t ToRt[SIM_RING_BYTES];		// High Level -> Real Time
+    uint8_t ToHl[SIM_RING_BYTES];		// Real Time -> High Level
+    volatile int Stop;
+    // Virtual IL3820, owned by the engine process
+    uint8_t Ram[SIM_HEIGHT][SIM_WIDTH_BYTE];
+    uint8_t Shown[SIM_HEIGHT][SIM_WIDTH_BYTE];	// RAM content of the last MASTER_ACTIVATION
+    uint32_t Updates;
+    uint32_t SpiBytes;
+} SIM_SHARED;
+
+static SIM_SHARED *Shm;
+
+// Same tables as InitSequence / TurnOnSequence of the IL3820 driver, which needs applibs
+static const uint8_t SimInit[] = {
+    0x01, 3, (SIM_HEIGHT - 1) & 0xFF, ((SIM_HEIGHT - 1) >> 8) & 0xFF, 0x00,
+    0x0C, 3, 0xD7, 0xD6, 0x9D,
+    0x2C, 1, 0xA8,
+    0x3C, 1, 0x03,
+    0x11, 1, 0x03,
+    EPD_SEQ_END
+};
+static const uint8_t SimTurnOn[] = {
+    0x22, 1, 0xC4,
+    0x20, 0,
+    0xFF, 0,
+    EPD_SEQ_END
+};
+static const uint8_t SimLut[30] = { 0x50, 0xAA, 0x55, 0xAA, 0x11 };
+
+int Log_Debug(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+    return 0;
+}
+
+/******************************************************************************
+Engine process : HAL on a virtual IL3820
+******************************************************************************/
+static struct {
+    uint8_t Dc;
+    uint8_t Cmd;
+    uint8_t Args[8];
+    uint8_t ArgCount;
+    uint8_t Xs, Xe, Xc;
+    uint16_t Ys, Ye, Yc;
+    uint32_t BusyUntil;
+} Panel;
+
+uint32_t EPD_Hal_Now_Us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u);
+}
+
+int EPD_Hal_Init(void) {
+    memset(&Panel, 0, sizeof(Panel));
+    return 0;
+}
+
+void EPD_Hal_Dc(uint8_t Level) {
+    Panel.Dc = Level;
+}
+
+void EPD_Hal_Rst(uint8_t Level) {
+    if (Level) {
+        Panel.BusyUntil = EPD_Hal_Now_Us() + SIM_RESET_BUSY_US;
+    }
+}
+
+uint8_t EPD_Hal_Busy(void) {
+    return (int32_t)(Panel.BusyUntil - EPD_Hal_Now_Us()) > 0;
+}
+
+static void Sim_Byte(uint8_t b) {
+    if (!Panel.Dc) {
+        Panel.Cmd = b;
+        Panel.ArgCount = 0;
+        if (b == 0x20) {
+            // MASTER_ACTIVATION, the panel shows the RAM and is BUSY for a while
+            memcpy(Shm->Shown, Shm->Ram, sizeof(Shm->Ram));
+            Shm->Updates++;
+            Panel.BusyUntil = EPD_Hal_Now_Us() + SIM_UPDATE_US;
+        }
+        return;
+    }
+    if (Panel.Cmd == 0x24) {
+        Shm->Ram[Panel.Yc][Panel.Xc] = b;
+        if (Panel.Xc == Panel.Xe) {
+            Panel.Xc = Panel.Xs;
+            Panel.Yc = (Panel.Yc == Panel.Ye) ? Panel.Ys : Panel.Yc + 1;
+        } else {
+            Panel.Xc++;
+        }
+        return;
+    }
+    if (Panel.ArgCount < sizeof(Panel.Args)) {
+        Panel.Args[Panel.ArgCount++] = b;
+    }
+    if (Panel.Cmd == 0x44 && Panel.ArgCount == 2) {
+        Panel.Xs = Panel.Args[0];
+        Panel.Xe = Panel.Args[1];
+    } else if (Panel.Cmd == 0x45 && Panel.ArgCount == 4) {
+        Panel.Ys = Panel.Args[0] | Panel.Args[1] << 8;
+        Panel.Ye = Panel.Args[2] | Panel.Args[3] << 8;
+    } else if (Panel.Cmd == 0x4E && Panel.ArgCount == 1) {
+        Panel.Xc = Panel.Args[0];
+    } else if (Panel.Cmd == 0x4F && Panel.ArgCount == 2) {
+        Panel.Yc = Panel.Args[0] | Panel.Args[1] << 8;
+    }
+}
+
+int EPD_Hal_Spi_Write(const uint8_t *Data, uint32_t Len) {
+    uint32_t i;
+
+    if (Panel.Xe >= SIM_WIDTH_BYTE || Panel.Ye >= SIM_HEIGHT) {
+        return -1;
+    }
+    for (i = 0; i < Len; i++) {
+        Sim_Byte(Data[i]);
+    }
+    Shm->SpiBytes += Len;
+    return 0;
+}
+
+/******************************************************************************
+function    : Main loop of the engine process, same as RTCoreMain with the
+              rings in place of the mailbox
+******************************************************************************/
+static void Sim_Engine(void) {
+    static EPD_ENGINE engine;
+    static uint8_t msg[EPD_RMT_MAX_MSG];
+    static uint8_t reply[EPD_RMT_MAX_MSG];
+    uint8_t peer[EPD_RING_PREFIX];
+    uint32_t replyLen = 0;
+    EPD_RING in, out;
+
+    EPD_Ring_Attach(&in, Shm->ToRt, SIM_RING_BYTES);
+    EPD_Ring_Attach(&out, Shm->ToHl, SIM_RING_BYTES);
+    EPD_Hal_Init();
+    EPD_Engine_Init(&engine);
+
+    while (!Shm->Stop) {
+        if (replyLen != 0 && EPD_Ring_Write(&out, peer, reply, replyLen) == 0) {
+            replyLen = 0;
+        }
+        if (replyLen == 0 && EPD_Engine_Ready(&engine)) {
+            int len = EPD_Ring_Read(&in, peer, msg, sizeof(msg));
+            if (len > 0) {
+                EPD_Engine_Handle(&engine, msg, (uint32_t)len);
+            } else {
+                usleep(50);		// Nothing to do, the device would sleep till the mailbox interrupt
+            }
+        }
+        if (replyLen == 0) {
+            int len = EPD_Engine_Poll(&engine, reply);
+            if (len > 0) {
+                replyLen = (uint32_t)len;
+            }
+        }
+    }
+}
+
+/******************************************************************************
+High Level process : EPD_Remote over the shared memory rings
+******************************************************************************/
+static EPD_RING HlOut, HlIn;
+static const uint8_t HlComponent[EPD_RING_PREFIX] = { 0x56, 0x03, 0x35, 0xE3 };
+
+static int Sim_Send(void *Ctx, const void *Msg, uint32_t Len) {
+    (void)Ctx;
+    while (EPD_Ring_Write(&HlOut, HlComponent, Msg, Len) != 0) {
+        usleep(50);
+    }
+    return 0;
+}
+
+static int Sim_Recv(void *Ctx, void *Msg, uint32_t Max) {
+    int len;
+    (void)Ctx;
+    while ((len = EPD_Ring_Read(&HlIn, NULL, Msg, Max)) == 0) {
+        usleep(50);
+    }
+    return len;
+}
+
+static uint32_t Sim_Ms(uint32_t StartUs) {
+    return (EPD_Hal_Now_Us() - StartUs) / 1000u;
+}
+
+static int Sim_Host(void) {
+    static uint8_t frame[SIM_HEIGHT][SIM_WIDTH_BYTE];
+    static uint8_t delta[40][4];
+    EPD_REMOTE_LINK link = { Sim_Send, Sim_Recv, NULL };
+    EPD_REMOTE remote;
+    uint32_t t0, queued;
+    int errors = 0;
+    int x, y;
+
+    EPD_Ring_Attach(&HlOut, Shm->ToRt, SIM_RING_BYTES);
+    EPD_Ring_Attach(&HlIn, Shm->ToHl, SIM_RING_BYTES);
+    EPD_Remote_Attach(&remote, &link);
+
+    t0 = EPD_Hal_Now_Us();
+    if (EPD_Remote_Init(&remote, SimInit, SimLut) != 0 || EPD_Remote_Wait(&remote, remote.Seq) != 0) {
+        printf("init failed\n");
+        return 1;
+    }
+    printf("init        : %4u ms, BUSY %u us\n", Sim_Ms(t0), remote.LastInfo.BusyUs);
+
+    // Full frame, checkerboard of 8x8 blocks
+    for (y = 0; y < SIM_HEIGHT; y++) {
+        for (x = 0; x < SIM_WIDTH_BYTE; x++) {
+            frame[y][x] = ((x + y / 8) & 1) ? 0x00 : 0xFF;
+        }
+    }
+    t0 = EPD_Hal_Now_Us();
+    EPD_Remote_Frame(&remote, &frame[0][0], SimTurnOn);
+    queued = Sim_Ms(t0);
+    EPD_Remote_Wait(&remote, remote.Seq);
+    printf("full frame  : queued in %u ms, done in %u ms, BUSY %u ms\n", queued, Sim_Ms(t0), remote.LastInfo.BusyUs / 1000u);
+    errors += memcmp(Shm->Shown, frame, sizeof(frame)) != 0;
+
+    // Delta rectangle of 32x40 pixels at byte 5, row 100
+    for (y = 0; y < 40; y++) {
+        for (x = 0; x < 4; x++) {
+            delta[y][x] = (uint8_t)(y * 4 + x);
+            frame[100 + y][5 + x] = delta[y][x];
+        }
+    }
+    t0 = EPD_Hal_Now_Us();
+    EPD_Remote_Rect(&remote, 5, 100, 4, 40, &delta[0][0], 4, 0);
+    EPD_Remote_Sequence(&remote, SimTurnOn, 1);
+    queued = Sim_Ms(t0);
+    EPD_Remote_Wait(&remote, remote.Seq);
+    printf("delta rect  : queued in %u ms, done in %u ms, BUSY %u ms\n", queued, Sim_Ms(t0), remote.LastInfo.BusyUs / 1000u);
+    errors += memcmp(Shm->Shown, frame, sizeof(frame)) != 0;
+
+    // A rectangle out of the panel is refused on this side, a bad piece by the engine
+    errors += EPD_Remote_Rect(&remote, 14, 0, 4, 1, &delta[0][0], 4, 1) == 0;
+    ((EPD_RMT_MSG *)remote.Buf)->Type = EPD_RMT_RECT;
+    ((EPD_RMT_MSG *)remote.Buf)->Offset = 8;
+    ((EPD_RMT_MSG *)remote.Buf)->Len = 0;
+    remote.Buf[1] = EPD_RMT_FLAG_ACK;
+    ((EPD_RMT_MSG *)remote.Buf)->Seq = ++remote.Seq;
+    Sim_Send(NULL, remote.Buf, sizeof(EPD_RMT_MSG));
+    errors += EPD_Remote_Wait(&remote, remote.Seq) == 0 || remote.LastStatus != EPD_RMT_ERR_MSG;
+
+    printf("updates %u, SPI bytes %u, %s\n", Shm->Updates, Shm->SpiBytes, errors ? "MISMATCH" : "panel matches");
+    return errors ? 1 : 0;
+}
+
+int main(void) {
+    pid_t rt;
+    int ret, status;
+
+    Shm = mmap(NULL, sizeof(SIM_SHARED), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (Shm == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    memset(Shm, 0, sizeof(*Shm));
+
+    rt = fork();
+    if (rt < 0) {
+        perror("fork");
+        return 1;
+    }
+    if (rt == 0) {
+        Sim_Engine();
+        _exit(0);
+    }
+
+    ret = Sim_Host();
+    Shm->Stop = 1;
+    waitpid(rt, &status, 0);
+    return ret;
+}
@@ -0,0 +1,278 @@
+/*****************************************************************************
+* | File      	:  	fontpack.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Host generator of the packed fonts (fonts.h PFONT) from the plain Font8 .. Font24 tables
+* | Info        :   Crops every glyph to the box of its set pixels, stores the box bits without row padding,
+*                   run length encoded when that is smaller (fonts from FONTPACK_RLE_HEIGHT up),
+*                   in 4 byte glyph entries (the advance in proportional text is the box width).
+*                   Build on a Linux / macOS host, from AzSphereSK_EPD_Demo :
+*                   cc -O2 -o fontpack Tools/FontPack/fontpack.c Tools/Fonts/font8.c Tools/Fonts/font12.c \
+*                      Tools/Fonts/font16.c Tools/Fonts/font20.c Tools/Fonts/font24.c
+*                   ./fontpack Tools/Fonts
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Bounding box, bit packing, RLE, advance widths, packed font source output
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Fonts/fonts.h"
+
+#define FP_RLE_HEIGHT		16		// Fonts this high and up may use RLE glyphs
+#define FP_MAX_DATA			(16 * 1024)
+
+typedef struct {
+    const char *Name;		// Font symbol, the output is <file>p.c
+    const char *File;
+    sFONT *Font;
+} FP_FONT;
+
+static const FP_FONT FpFonts[] = {
+    { "Font8",  "font8",  &Font8  },
+    { "Font12", "font12", &Font12 },
+    { "Font16", "font16", &Font16 },
+    { "Font20", "font20", &Font20 },
+    { "Font24", "font24", &Font24 },
+};
+
+// Bit writer, MSB first, like the plain tables
+typedef struct {
+    uint8_t *Buf;
+    uint32_t Bits;
+} FP_BITS;
+
+static void Fp_Put_Bits(FP_BITS *Out, uint32_t Value, uint8_t Count) {
+    while (Count--) {
+        if (Value & (1u << Count))
+            Out->Buf[Out->Bits >> 3] |= 0x80 >> (Out->Bits & 7);
+        Out->Bits++;
+    }
+}
+
+static int Fp_Pixel(const sFONT *Font, uint8_t Char, uint16_t X, uint16_t Y) {
+    uint16_t WidthByte = (Font->Width + 7) / 8;
+    const uint8_t *Row = &Font->table[((uint32_t)Char * Font->Height + Y) * WidthByte];
+    return (Row[X / 8] >> (7 - X % 8)) & 1;
+}
+
+/******************************************************************************
+function    : Run length encodes the box bits of a glyph
+parameter   :
+       Font, Char : Glyph, Char counts from FONT_FIRST_CHAR
+       X, Y, W, H : Its box
+       Out        : Encoded bytes, zeroed by the caller
+return      : No of bytes
+info        : Runs of background and ink alternate, starting with background. A nibble
+              of 15 adds 15 to the run and another nibble follows, 0 .. 14 ends it.
+******************************************************************************/
+static uint32_t Fp_Rle(const sFONT *Font, uint8_t Char, uint8_t X, uint8_t Y, uint8_t W, uint8_t H, uint8_t *Out) {
+    FP_BITS Bits = { Out, 0 };
+    uint32_t Total = (uint32_t)W * H;
+    uint32_t i = 0;
+    int Color = 0;
+
+    while (i < Total) {
+        uint32_t Run = 0;
+        while (i + Run < Total && Fp_Pixel(Font, Char, X + (i + Run) % W, Y + (i + Run) / W) == Color) {
+            Run++;
+        }
+        i += Run;
+        for (; Run >= 15; Run -= 15) {
+            Fp_Put_Bits(&Bits, 15, 4);
+        }
+        Fp_Put_Bits(&Bits, Run, 4);
+        Color ^= 1;
+    }
+    return (Bits.Bits + 7) / 8;
+}
+
+/******************************************************************************
+function    : Packs one font and writes its source
+parameter   :
+       Fp     : Font to pack
+       Dir    : Output directory
+return      : Packed bytes (glyph table and data), 0 on error
+******************************************************************************/
+static uint32_t Fp_Pack(const FP_FONT *Fp, const char *Dir) {
+    static uint8_t Data[FP_MAX_DATA];
+    static PFONT_GLYPH Glyphs[FONT_GLYPHS];
+    static uint8_t RleBuf[32 * FONT_MAX_ROWS];	// A nibble per pixel at worst
+    static uint32_t Offsets[FONT_GLYPHS];
+    const sFONT *Font = Fp->Font;
+    uint32_t Used = 0, Rle = 0;
+    char Path[512];
+
+    static uint16_t Base[(FONT_GLYPHS + PFONT_BLOCK - 1) / PFONT_BLOCK];
+    if (Font->Width > 31 || Font->Height > FONT_MAX_ROWS) {
+        fprintf(stderr, "%s : %dx%d is larger than a decoded glyph\n", Fp->Name, Font->Width, Font->Height);
+        return 0;
+    }
+    memset(Data, 0, sizeof(Data));
+
+    for (uint8_t c = 0; c < FONT_GLYPHS; c++) {
+        PFONT_GLYPH *G = &Glyphs[c];
+        int X0 = Font->Width, Y0 = Font->Height, X1 = -1, Y1 = -1;
+
+        for (uint16_t y = 0; y < Font->Height; y++) {
+            for (uint16_t x = 0; x < Font->Width; x++) {
+                if (Fp_Pixel(Font, c, x, y)) {
+                    if (x < X0) X0 = x;
+                    if (x > X1) X1 = x;
+                    if (y < Y0) Y0 = y;
+                    if (y > Y1) Y1 = y;
+                }
+            }
+        }
+        if (c % PFONT_BLOCK == 0) {
+            Base[c / PFONT_BLOCK] = (uint16_t)Used;
+        }
+        memset(G, 0, sizeof(*G));
+        Offsets[c] = Used;
+        if (Used - Base[c / PFONT_BLOCK] >= (1u << 11)) {
+            fprintf(stderr, "%s : glyph block too large for the 11 bit offsets\n", Fp->Name);
+            return 0;
+        }
+        G->Offset = Used - Base[c / PFONT_BLOCK];
+        if (X1 < 0) {
+            continue;
+        }
+        G->X = (uint32_t)X0;
+        G->Y = (uint32_t)Y0;
+        G->W = (uint32_t)(X1 - X0 + 1);
+        G->H = (uint32_t)(Y1 - Y0 + 1);
+
+        uint32_t RawBytes = ((uint32_t)G->W * G->H + 7) / 8;
+        if (Used + RawBytes > FP_MAX_DATA) {
+            fprintf(stderr, "%s : FP_MAX_DATA is too small\n", Fp->Name);
+            return 0;
+        }
+        uint32_t RleBytes = UINT32_MAX;
+        if (Font->Height >= FP_RLE_HEIGHT) {
+            memset(RleBuf, 0, sizeof(RleBuf));
+            RleBytes = Fp_Rle(Font, c, G->X, G->Y, G->W, G->H, RleBuf);
+        }
+        if (RleBytes < RawBytes) {
+            G->Rle = 1;
+            memcpy(&Data[Used], RleBuf, RleBytes);
+            Used += RleBytes;
+            Rle++;
+        } else {
+            FP_BITS Bits = { &Data[Used], 0 };
+            for (uint16_t y = 0; y < G->H; y++) {
+                for (uint16_t x = 0; x < G->W; x++) {
+                    Fp_Put_Bits(&Bits, (uint32_t)Fp_Pixel(Font, c, G->X + x, G->Y + y), 1);
+                }
+            }
+            Used += RawBytes;
+        }
+    }
+    if (Used > UINT16_MAX) {
+        fprintf(stderr, "%s : data too large for the 16 bit block offsets\n", Fp->Name);
+        return 0;
+    }
+
+    snprintf(Path, sizeof(Path), "%s/%sp.c", Dir, Fp->File);
+    FILE *f = fopen(Path, "w");
+    if (f == NULL) {
+        perror(Path);
+        return 0;
+    }
+    uint32_t Plain = (uint32_t)FONT_GLYPHS * Font->Height * ((Font->Width + 7) / 8);
+    uint32_t Packed = Used + (uint32_t)sizeof(Glyphs) + (uint32_t)sizeof(Base);
+    fprintf(f, "/**\n"
+               "  ******************************************************************************\n"
+               "  * @file    %sp.c\n"
+               "  * @brief   %s in the packed format of fonts.h, generated by Tools/FontPack\n"
+               "  *          from %s.c, do not edit. %u bytes, %u in %s.c, %u RLE glyphs.\n"
+               "  ******************************************************************************\n"
+               "  */\n\n"
+               "/* Includes ------------------------------------------------------------------*/\n"
+               "#include <stddef.h>\n#include \"fonts.h\"\n\n",
+               Fp->File, Fp->Name, Fp->File, (unsigned)Packed, (unsigned)Plain, Fp->File, (unsigned)Rle);
+
+    fprintf(f, "static const uint8_t %s_Data [] = \n{\n", Fp->Name);
+    for (uint8_t c = 0; c < FONT_GLYPHS; c++) {
+        const PFONT_GLYPH *G = &Glyphs[c];
+        uint32_t End = (c + 1 < FONT_GLYPHS) ? Offsets[c + 1] : Used;
+        if (End == Offsets[c]) {
+            continue;
+        }
+        fprintf(f, "\t// @%u '%c' %ux%u at %u,%u%s\n\t", (unsigned)Offsets[c], FONT_FIRST_CHAR + c,
+                G->W, G->H, G->X, G->Y, G->Rle ? " RLE" : "");
+        for (uint32_t i = Offsets[c]; i < End; i++) {
+            fprintf(f, "0x%02X,%s", Data[i], (i + 1 == End) ? "\n" : ((i - Offsets[c]) % 12 == 11) ? "\n\t" : " ");
+        }
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "static const PFONT_GLYPH %s_Glyphs [] = \n{\n", Fp->Name);
+    fprintf(f, "\t// Offset, X, Y, W, H, Rle\n");
+    for (uint8_t c = 0; c < FONT_GLYPHS; c++) {
+        const PFONT_GLYPH *G = &Glyphs[c];
+        fprintf(f, "\t{ %4u, %2u, %2u, %2u, %2u, %u },\t// '%c'\n", G->Offset, G->X, G->Y, G->W, G->H,
+                G->Rle, FONT_FIRST_CHAR + c);
+    }
+    fprintf(f, "};\n\n");
+
+    fprintf(f, "static const uint16_t %s_Base [] = { ", Fp->Name);
+    for (uint32_t i = 0; i < sizeof(Base) / sizeof(Base[0]); i++) {
+        fprintf(f, "%u%s", Base[i], (i + 1 < sizeof(Base) / sizeof(Base[0])) ? ", " : " };\n\n");
+    }
+
+    fprintf(f, "static const PFONT %s_Packed = { %s_Glyphs, %s_Base, %s_Data };\n\n", Fp->Name, Fp->Name, Fp->Name, Fp->Name);
+    fprintf(f, "sFONT %s = {\n  NULL,\n  %u, /* Width */\n  %u, /* Height */\n  &%s_Packed,\n  0,\n};\n\n",
+            Fp->Name, Font->Width, Font->Height, Fp->Name);
+    fprintf(f, "// Same glyphs, advancing by the glyph width\n");
+    fprintf(f, "sFONT %sP = {\n  NULL,\n  %u, /* Width */\n  %u, /* Height */\n  &%s_Packed,\n  1,\n};\n",
+            Fp->Name, Font->Width, Font->Height, Fp->Name);
+    fclose(f);
+
+    printf("%-7s %5u -> %5u bytes (%4.1f%%), %2u RLE glyphs\n", Fp->Name, (unsigned)Plain, (unsigned)Packed,
+           100.0 * Packed / Plain, (unsigned)Rle);
+    return Packed;
+}
+
+int main(int argc, char **argv) {
+    uint32_t Plain = 0, Packed = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage : %s output directory\n", argv[0]);
+        return 2;
+    }
+    for (uint32_t i = 0; i < sizeof(FpFonts) / sizeof(FpFonts[0]); i++) {
+        const sFONT *Font = FpFonts[i].Font;
+        uint32_t Bytes = Fp_Pack(&FpFonts[i], argv[1]);
+        if (Bytes == 0) {
+            return 1;
+        }
+        Plain += (uint32_t)FONT_GLYPHS * Font->Height * ((Font->Width + 7) / 8);
+        Packed += Bytes;
+    }
+    printf("All     %5u -> %5u bytes (%4.1f%%)\n", (unsigned)Plain, (unsigned)Packed, 100.0 * Packed / Plain);
+    return 0;
+}
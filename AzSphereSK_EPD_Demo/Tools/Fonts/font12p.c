@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file    font12p.c
+  * @brief   Font12 in the packed format of fonts.h, generated by Tools/FontPack
+  *          from font12.c, do not edit. 854 bytes, 1140 in font12.c, 0 RLE glyphs.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font12_Data [] = 
+{
+	// @0 '!' 1x8 at 3,1
+	0xF9,
+	// @1 '"' 5x3 at 1,1
+	0xDC, 0xA4,
+	// @3 '#' 5x9 at 1,1
+	0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0,
+	// @9 '$' 4x9 at 1,1
+	0x27, 0x88, 0x79, 0xE2, 0x20,
+	// @14 '%' 5x8 at 1,1
+	0x45, 0x10, 0x3E, 0x08, 0xA2,
+	// @19 '&' 5x6 at 1,3
+	0x32, 0x11, 0x59, 0x34,
+	// @23 ''' 1x4 at 3,1
+	0xF0,
+	// @24 '(' 2x10 at 3,1
+	0x5A, 0xAA, 0x50,
+	// @27 ')' 2x10 at 2,1
+	0xA5, 0x55, 0xA0,
+	// @30 '*' 5x5 at 1,1
+	0x27, 0xC8, 0xA5, 0x00,
+	// @34 '+' 7x7 at 0,2
+	0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+	// @41 ',' 3x4 at 2,7
+	0x6B, 0x40,
+	// @43 '-' 5x1 at 1,5
+	0xF8,
+	// @44 '.' 2x2 at 2,7
+	0xF0,
+	// @45 '/' 5x9 at 1,1
+	0x08, 0x44, 0x22, 0x11, 0x08, 0x80,
+	// @51 '0' 5x8 at 1,1
+	0x74, 0x63, 0x18, 0xC6, 0x2E,
+	// @56 '1' 5x8 at 1,1
+	0x61, 0x08, 0x42, 0x10, 0x9F,
+	// @61 '2' 5x8 at 1,1
+	0x74, 0x42, 0x22, 0x22, 0x3F,
+	// @66 '3' 5x8 at 1,1
+	0x74, 0x42, 0x60, 0x86, 0x2E,
+	// @71 '4' 6x8 at 1,1
+	0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87,
+	// @77 '5' 5x8 at 1,1
+	0x7A, 0x10, 0xE0, 0x86, 0x2E,
+	// @82 '6' 5x8 at 1,1
+	0x3A, 0x21, 0xE8, 0xC6, 0x2E,
+	// @87 '7' 5x8 at 1,1
+	0xFC, 0x42, 0x21, 0x08, 0x84,
+	// @92 '8' 5x8 at 1,1
+	0x74, 0x62, 0xE8, 0xC6, 0x2E,
+	// @97 '9' 5x8 at 1,1
+	0x74, 0x63, 0x17, 0x84, 0x5C,
+	// @102 ':' 2x6 at 2,3
+	0xF0, 0xF0,
+	// @104 ';' 3x7 at 2,3
+	0x6C, 0x07, 0xA0,
+	// @107 '<' 6x7 at 0,2
+	0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0,
+	// @113 '=' 5x3 at 1,4
+	0xF8, 0x3E,
+	// @115 '>' 6x7 at 0,2
+	0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00,
+	// @121 '?' 4x7 at 2,2
+	0x69, 0x12, 0x40, 0xC0,
+	// @125 '@' 5x10 at 1,0
+	0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80,
+	// @132 'A' 7x8 at 0,1
+	0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77,
+	// @139 'B' 6x8 at 0,1
+	0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E,
+	// @145 'C' 5x8 at 1,1
+	0x7C, 0x61, 0x08, 0x42, 0x2E,
+	// @150 'D' 6x8 at 0,1
+	0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC,
+	// @156 'E' 6x8 at 0,1
+	0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F,
+	// @162 'F' 6x8 at 1,1
+	0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,
+	// @168 'G' 6x8 at 1,1
+	0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C,
+	// @174 'H' 7x8 at 0,1
+	0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77,
+	// @181 'I' 5x8 at 1,1
+	0xF9, 0x08, 0x42, 0x10, 0x9F,
+	// @186 'J' 5x8 at 1,1
+	0x78, 0x84, 0x29, 0x4A, 0x4C,
+	// @191 'K' 7x8 at 0,1
+	0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73,
+	// @198 'L' 5x8 at 1,1
+	0xE2, 0x10, 0x84, 0x25, 0x3F,
+	// @203 'M' 7x8 at 0,1
+	0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77,
+	// @210 'N' 7x8 at 0,1
+	0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76,
+	// @217 'O' 5x8 at 1,1
+	0x74, 0x63, 0x18, 0xC6, 0x2E,
+	// @222 'P' 5x8 at 1,1
+	0xF2, 0x52, 0x97, 0x21, 0x1C,
+	// @227 'Q' 5x9 at 1,1
+	0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38,
+	// @233 'R' 7x8 at 0,1
+	0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71,
+	// @240 'S' 5x8 at 1,1
+	0x6C, 0xE0, 0xE0, 0x87, 0x36,
+	// @245 'T' 7x8 at 0,1
+	0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C,
+	// @252 'U' 7x8 at 0,1
+	0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C,
+	// @259 'V' 7x8 at 0,1
+	0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08,
+	// @266 'W' 7x8 at 0,1
+	0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14,
+	// @273 'X' 7x8 at 0,1
+	0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63,
+	// @280 'Y' 7x8 at 0,1
+	0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C,
+	// @287 'Z' 5x8 at 1,1
+	0xFC, 0x44, 0x42, 0x22, 0x3F,
+	// @292 '[' 3x10 at 2,1
+	0xF2, 0x49, 0x24, 0x9C,
+	// @296 '\' 4x9 at 1,1
+	0x84, 0x44, 0x22, 0x11, 0x10,
+	// @301 ']' 3x10 at 2,1
+	0xE4, 0x92, 0x49, 0x3C,
+	// @305 '^' 5x4 at 1,1
+	0x21, 0x15, 0x10,
+	// @308 '_' 7x1 at 0,11
+	0xFE,
+	// @309 '`' 2x2 at 3,1
+	0x90,
+	// @310 'a' 6x6 at 1,3
+	0x72, 0x27, 0xA2, 0x89, 0xF0,
+	// @315 'b' 6x8 at 0,1
+	0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E,
+	// @321 'c' 5x6 at 1,3
+	0x7C, 0x61, 0x08, 0xB8,
+	// @325 'd' 6x8 at 1,1
+	0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F,
+	// @331 'e' 5x6 at 1,3
+	0x74, 0x7F, 0x08, 0x3C,
+	// @335 'f' 5x8 at 1,1
+	0x3A, 0x3E, 0x84, 0x21, 0x1F,
+	// @340 'g' 6x8 at 1,3
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C,
+	// @346 'h' 7x8 at 0,1
+	0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77,
+	// @353 'i' 5x8 at 1,1
+	0x20, 0x38, 0x42, 0x10, 0x9F,
+	// @358 'j' 4x10 at 1,1
+	0x20, 0xF1, 0x11, 0x11, 0x1E,
+	// @363 'k' 6x8 at 0,1
+	0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7,
+	// @369 'l' 5x8 at 1,1
+	0x61, 0x08, 0x42, 0x10, 0x9F,
+	// @374 'm' 7x6 at 0,3
+	0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0,
+	// @380 'n' 7x6 at 0,3
+	0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0,
+	// @386 'o' 5x6 at 1,3
+	0x74, 0x63, 0x18, 0xB8,
+	// @390 'p' 6x8 at 0,3
+	0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38,
+	// @396 'q' 6x8 at 1,3
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87,
+	// @402 'r' 5x6 at 1,3
+	0xDB, 0x10, 0x84, 0x7C,
+	// @406 's' 5x6 at 1,3
+	0x7C, 0x5C, 0x18, 0xF8,
+	// @410 't' 6x7 at 1,2
+	0x43, 0xE4, 0x10, 0x41, 0x13, 0x80,
+	// @416 'u' 7x6 at 0,3
+	0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0,
+	// @422 'v' 7x6 at 0,3
+	0xEE, 0x89, 0x11, 0x42, 0x82, 0x00,
+	// @428 'w' 7x6 at 0,3
+	0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00,
+	// @434 'x' 6x6 at 0,3
+	0xCD, 0x23, 0x0C, 0x4B, 0x30,
+	// @439 'y' 7x8 at 0,3
+	0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C,
+	// @446 'z' 5x6 at 1,3
+	0xFC, 0x88, 0x88, 0xFC,
+	// @450 '{' 3x10 at 2,1
+	0x29, 0x25, 0x12, 0x44,
+	// @454 '|' 1x9 at 3,1
+	0xFF, 0x80,
+	// @456 '}' 3x10 at 2,1
+	0x89, 0x24, 0x52, 0x50,
+	// @460 '~' 5x2 at 1,5
+	0x4D, 0x80,
+};
+
+static const PFONT_GLYPH Font12_Glyphs [] = 
+{
+	// Offset, X, Y, W, H, Rle
+	{    0,  0,  0,  0,  0, 0 },	// ' '
+	{    0,  3,  1,  1,  8, 0 },	// '!'
+	{    1,  1,  1,  5,  3, 0 },	// '"'
+	{    3,  1,  1,  5,  9, 0 },	// '#'
+	{    9,  1,  1,  4,  9, 0 },	// '$'
+	{   14,  1,  1,  5,  8, 0 },	// '%'
+	{   19,  1,  3,  5,  6, 0 },	// '&'
+	{   23,  3,  1,  1,  4, 0 },	// '''
+	{   24,  3,  1,  2, 10, 0 },	// '('
+	{   27,  2,  1,  2, 10, 0 },	// ')'
+	{   30,  1,  1,  5,  5, 0 },	// '*'
+	{   34,  0,  2,  7,  7, 0 },	// '+'
+	{   41,  2,  7,  3,  4, 0 },	// ','
+	{   43,  1,  5,  5,  1, 0 },	// '-'
+	{   44,  2,  7,  2,  2, 0 },	// '.'
+	{   45,  1,  1,  5,  9, 0 },	// '/'
+	{    0,  1,  1,  5,  8, 0 },	// '0'
+	{    5,  1,  1,  5,  8, 0 },	// '1'
+	{   10,  1,  1,  5,  8, 0 },	// '2'
+	{   15,  1,  1,  5,  8, 0 },	// '3'
+	{   20,  1,  1,  6,  8, 0 },	// '4'
+	{   26,  1,  1,  5,  8, 0 },	// '5'
+	{   31,  1,  1,  5,  8, 0 },	// '6'
+	{   36,  1,  1,  5,  8, 0 },	// '7'
+	{   41,  1,  1,  5,  8, 0 },	// '8'
+	{   46,  1,  1,  5,  8, 0 },	// '9'
+	{   51,  2,  3,  2,  6, 0 },	// ':'
+	{   53,  2,  3,  3,  7, 0 },	// ';'
+	{   56,  0,  2,  6,  7, 0 },	// '<'
+	{   62,  1,  4,  5,  3, 0 },	// '='
+	{   64,  0,  2,  6,  7, 0 },	// '>'
+	{   70,  2,  2,  4,  7, 0 },	// '?'
+	{    0,  1,  0,  5, 10, 0 },	// '@'
+	{    7,  0,  1,  7,  8, 0 },	// 'A'
+	{   14,  0,  1,  6,  8, 0 },	// 'B'
+	{   20,  1,  1,  5,  8, 0 },	// 'C'
+	{   25,  0,  1,  6,  8, 0 },	// 'D'
+	{   31,  0,  1,  6,  8, 0 },	// 'E'
+	{   37,  1,  1,  6,  8, 0 },	// 'F'
+	{   43,  1,  1,  6,  8, 0 },	// 'G'
+	{   49,  0,  1,  7,  8, 0 },	// 'H'
+	{   56,  1,  1,  5,  8, 0 },	// 'I'
+	{   61,  1,  1,  5,  8, 0 },	// 'J'
+	{   66,  0,  1,  7,  8, 0 },	// 'K'
+	{   73,  1,  1,  5,  8, 0 },	// 'L'
+	{   78,  0,  1,  7,  8, 0 },	// 'M'
+	{   85,  0,  1,  7,  8, 0 },	// 'N'
+	{   92,  1,  1,  5,  8, 0 },	// 'O'
+	{    0,  1,  1,  5,  8, 0 },	// 'P'
+	{    5,  1,  1,  5,  9, 0 },	// 'Q'
+	{   11,  0,  1,  7,  8, 0 },	// 'R'
+	{   18,  1,  1,  5,  8, 0 },	// 'S'
+	{   23,  0,  1,  7,  8, 0 },	// 'T'
+	{   30,  0,  1,  7,  8, 0 },	// 'U'
+	{   37,  0,  1,  7,  8, 0 },	// 'V'
+	{   44,  0,  1,  7,  8, 0 },	// 'W'
+	{   51,  0,  1,  7,  8, 0 },	// 'X'
+	{   58,  0,  1,  7,  8, 0 },	// 'Y'
+	{   65,  1,  1,  5,  8, 0 },	// 'Z'
+	{   70,  2,  1,  3, 10, 0 },	// '['
+	{   74,  1,  1,  4,  9, 0 },	// '\'
+	{   79,  2,  1,  3, 10, 0 },	// ']'
+	{   83,  1,  1,  5,  4, 0 },	// '^'
+	{   86,  0, 11,  7,  1, 0 },	// '_'
+	{    0,  3,  1,  2,  2, 0 },	// '`'
+	{    1,  1,  3,  6,  6, 0 },	// 'a'
+	{    6,  0,  1,  6,  8, 0 },	// 'b'
+	{   12,  1,  3,  5,  6, 0 },	// 'c'
+	{   16,  1,  1,  6,  8, 0 },	// 'd'
+	{   22,  1,  3,  5,  6, 0 },	// 'e'
+	{   26,  1,  1,  5,  8, 0 },	// 'f'
+	{   31,  1,  3,  6,  8, 0 },	// 'g'
+	{   37,  0,  1,  7,  8, 0 },	// 'h'
+	{   44,  1,  1,  5,  8, 0 },	// 'i'
+	{   49,  1,  1,  4, 10, 0 },	// 'j'
+	{   54,  0,  1,  6,  8, 0 },	// 'k'
+	{   60,  1,  1,  5,  8, 0 },	// 'l'
+	{   65,  0,  3,  7,  6, 0 },	// 'm'
+	{   71,  0,  3,  7,  6, 0 },	// 'n'
+	{   77,  1,  3,  5,  6, 0 },	// 'o'
+	{    0,  0,  3,  6,  8, 0 },	// 'p'
+	{    6,  1,  3,  6,  8, 0 },	// 'q'
+	{   12,  1,  3,  5,  6, 0 },	// 'r'
+	{   16,  1,  3,  5,  6, 0 },	// 's'
+	{   20,  1,  2,  6,  7, 0 },	// 't'
+	{   26,  0,  3,  7,  6, 0 },	// 'u'
+	{   32,  0,  3,  7,  6, 0 },	// 'v'
+	{   38,  0,  3,  7,  6, 0 },	// 'w'
+	{   44,  0,  3,  6,  6, 0 },	// 'x'
+	{   49,  0,  3,  7,  8, 0 },	// 'y'
+	{   56,  1,  3,  5,  6, 0 },	// 'z'
+	{   60,  2,  1,  3, 10, 0 },	// '{'
+	{   64,  3,  1,  1,  9, 0 },	// '|'
+	{   66,  2,  1,  3, 10, 0 },	// '}'
+	{   70,  1,  5,  5,  2, 0 },	// '~'
+};
+
+static const uint16_t Font12_Base [] = { 0, 51, 125, 222, 309, 390 };
+
+static const PFONT Font12_Packed = { Font12_Glyphs, Font12_Base, Font12_Data };
+
+sFONT Font12 = {
+  NULL,
+  7, /* Width */
+  12, /* Height */
+  &Font12_Packed,
+  0,
+};
+
+// Same glyphs, advancing by the glyph width
+sFONT Font12P = {
+  NULL,
+  7, /* Width */
+  12, /* Height */
+  &Font12_Packed,
+  1,
+};
@@ -0,0 +1,330 @@
+/**
+  ******************************************************************************
+  * @file    font16p.c
+  * @brief   Font16 in the packed format of fonts.h, generated by Tools/FontPack
+  *          from font16.c, do not edit. 1202 bytes, 3040 in font16.c, 8 RLE glyphs.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font16_Data [] = 
+{
+	// @0 '!' 2x10 at 4,1
+	0xFF, 0xFF, 0x30,
+	// @3 '"' 7x5 at 3,2
+	0xEF, 0xDD, 0x12, 0x24, 0x40,
+	// @8 '#' 8x11 at 2,1
+	0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C,
+	// @19 '$' 7x13 at 2,0
+	0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00,
+	// @31 '%' 8x10 at 2,1
+	0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06,
+	// @41 '&' 7x9 at 2,2
+	0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76,
+	// @49 ''' 3x5 at 5,2
+	0xFD, 0x24,
+	// @51 '(' 4x12 at 4,1
+	0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33,
+	// @57 ')' 4x12 at 3,1
+	0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC,
+	// @63 '*' 8x7 at 2,1
+	0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66,
+	// @70 '+' 7x7 at 2,3
+	0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+	// @77 ',' 3x5 at 4,9
+	0x6B, 0x48,
+	// @79 '-' 7x1 at 2,6
+	0xFE,
+	// @80 '.' 2x2 at 4,9
+	0xF0,
+	// @81 '/' 8x13 at 2,0
+	0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0,
+	0xC0,
+	// @94 '0' 7x10 at 2,1
+	0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70,
+	// @103 '1' 8x10 at 2,1
+	0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	// @113 '2' 7x10 at 2,1
+	0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC,
+	// @122 '3' 8x10 at 1,1
+	0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+	// @132 '4' 7x10 at 2,1
+	0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C,
+	// @141 '5' 7x10 at 2,1
+	0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8,
+	// @150 '6' 7x10 at 2,1
+	0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78,
+	// @159 '7' 7x10 at 1,1
+	0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,
+	// @168 '8' 7x10 at 2,1
+	0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8,
+	// @177 '9' 7x10 at 2,1
+	0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0,
+	// @186 ':' 2x7 at 4,4
+	0xF0, 0x3C,
+	// @188 ';' 4x9 at 4,4
+	0x33, 0x00, 0x06, 0x48, 0x80,
+	// @193 '<' 9x9 at 1,2 RLE
+	0x72, 0x52, 0x61, 0x62, 0x52, 0x92, 0x91, 0x92, 0x92,
+	// @202 '=' 9x3 at 1,5 RLE
+	0x09, 0x99,
+	// @204 '>' 9x9 at 1,2 RLE
+	0x02, 0x92, 0x91, 0x92, 0x92, 0x52, 0x61, 0x62, 0x52, 0x70,
+	// @214 '?' 7x9 at 2,2
+	0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30,
+	// @222 '@' 6x11 at 2,1
+	0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80,
+	// @231 'A' 10x9 at 1,2
+	0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0,
+	// @243 'B' 8x9 at 1,2
+	0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE,
+	// @252 'C' 9x9 at 1,2
+	0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00,
+	// @263 'D' 9x9 at 1,2
+	0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00,
+	// @274 'E' 8x9 at 1,2
+	0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,
+	// @283 'F' 9x9 at 1,2
+	0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00,
+	// @294 'G' 9x9 at 1,2
+	0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00,
+	// @305 'H' 9x9 at 1,2
+	0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80,
+	// @316 'I' 8x9 at 2,2
+	0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	// @325 'J' 9x9 at 1,2
+	0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00,
+	// @336 'K' 9x9 at 1,2
+	0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80,
+	// @347 'L' 9x9 at 1,2
+	0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80,
+	// @358 'M' 11x9 at 0,2
+	0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB,
+	0xE0,
+	// @371 'N' 9x9 at 1,2
+	0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00,
+	// @382 'O' 9x9 at 1,2
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00,
+	// @393 'P' 8x9 at 1,2
+	0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC,
+	// @402 'Q' 9x11 at 1,2
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF,
+	0xC0,
+	// @415 'R' 10x9 at 1,2
+	0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0,
+	// @427 'S' 7x9 at 2,2
+	0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC,
+	// @435 'T' 8x9 at 1,2
+	0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E,
+	// @444 'U' 9x9 at 1,2
+	0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00,
+	// @455 'V' 9x9 at 1,2
+	0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00,
+	// @466 'W' 11x9 at 0,2
+	0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31,
+	0x80,
+	// @479 'X' 9x9 at 1,2
+	0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80,
+	// @490 'Y' 10x9 at 1,2
+	0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00,
+	// @502 'Z' 7x9 at 2,2
+	0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE,
+	// @510 '[' 4x12 at 5,1
+	0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF,
+	// @516 '\' 8x13 at 2,0
+	0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03,
+	0x03,
+	// @529 ']' 4x12 at 3,1
+	0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,
+	// @535 '^' 7x6 at 2,0
+	0x10, 0x50, 0xA2, 0x28, 0x30, 0x40,
+	// @541 '_' 11x1 at 0,15 RLE
+	0x0B,
+	// @542 '`' 3x3 at 4,0
+	0x88, 0x80,
+	// @544 'a' 8x7 at 2,4
+	0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77,
+	// @551 'b' 9x10 at 1,1
+	0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77, 0x00,
+	// @563 'c' 8x7 at 1,4
+	0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E,
+	// @570 'd' 9x10 at 1,1
+	0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0,
+	// @582 'e' 9x7 at 1,4
+	0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC,
+	// @590 'f' 9x10 at 2,1 RLE
+	0x36, 0x22, 0x72, 0x57, 0x42, 0x72, 0x72, 0x72, 0x72, 0x57, 0x20,
+	// @601 'g' 9x10 at 1,4
+	0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00,
+	// @613 'h' 9x10 at 1,1
+	0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0,
+	// @625 'i' 8x10 at 2,1 RLE
+	0x32, 0x62, 0xC4, 0x62, 0x62, 0x62, 0x62, 0x62, 0x38,
+	// @634 'j' 6x13 at 2,1
+	0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8,
+	// @644 'k' 9x10 at 1,1
+	0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0,
+	// @656 'l' 8x10 at 2,1
+	0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	// @666 'm' 10x7 at 1,4
+	0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC,
+	// @675 'n' 9x7 at 1,4
+	0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE,
+	// @683 'o' 9x7 at 1,4
+	0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8,
+	// @691 'p' 9x10 at 1,4
+	0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00,
+	// @703 'q' 9x10 at 1,4
+	0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0,
+	// @715 'r' 9x7 at 1,4
+	0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8,
+	// @723 's' 7x7 at 2,4 RLE
+	0x18, 0x36, 0x45, 0x55, 0x38, 0x10,
+	// @729 't' 8x10 at 1,1
+	0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E,
+	// @739 'u' 9x7 at 1,4
+	0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE,
+	// @747 'v' 9x7 at 1,4
+	0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70,
+	// @755 'w' 11x7 at 0,4
+	0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60,
+	// @765 'x' 9x7 at 1,4
+	0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE,
+	// @773 'y' 10x10 at 1,4
+	0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F,
+	0x00,
+	// @786 'z' 7x7 at 2,4
+	0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80,
+	// @793 '{' 4x12 at 3,1
+	0x36, 0x66, 0x66, 0xC6, 0x66, 0x63,
+	// @799 '|' 2x12 at 5,1 RLE
+	0x0F, 0x90,
+	// @801 '}' 4x12 at 4,1
+	0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C,
+	// @807 '~' 7x3 at 2,5
+	0x61, 0x24, 0x30,
+};
+
+static const PFONT_GLYPH Font16_Glyphs [] = 
+{
+	// Offset, X, Y, W, H, Rle
+	{    0,  0,  0,  0,  0, 0 },	// ' '
+	{    0,  4,  1,  2, 10, 0 },	// '!'
+	{    3,  3,  2,  7,  5, 0 },	// '"'
+	{    8,  2,  1,  8, 11, 0 },	// '#'
+	{   19,  2,  0,  7, 13, 0 },	// '$'
+	{   31,  2,  1,  8, 10, 0 },	// '%'
+	{   41,  2,  2,  7,  9, 0 },	// '&'
+	{   49,  5,  2,  3,  5, 0 },	// '''
+	{   51,  4,  1,  4, 12, 0 },	// '('
+	{   57,  3,  1,  4, 12, 0 },	// ')'
+	{   63,  2,  1,  8,  7, 0 },	// '*'
+	{   70,  2,  3,  7,  7, 0 },	// '+'
+	{   77,  4,  9,  3,  5, 0 },	// ','
+	{   79,  2,  6,  7,  1, 0 },	// '-'
+	{   80,  4,  9,  2,  2, 0 },	// '.'
+	{   81,  2,  0,  8, 13, 0 },	// '/'
+	{    0,  2,  1,  7, 10, 0 },	// '0'
+	{    9,  2,  1,  8, 10, 0 },	// '1'
+	{   19,  2,  1,  7, 10, 0 },	// '2'
+	{   28,  1,  1,  8, 10, 0 },	// '3'
+	{   38,  2,  1,  7, 10, 0 },	// '4'
+	{   47,  2,  1,  7, 10, 0 },	// '5'
+	{   56,  2,  1,  7, 10, 0 },	// '6'
+	{   65,  1,  1,  7, 10, 0 },	// '7'
+	{   74,  2,  1,  7, 10, 0 },	// '8'
+	{   83,  2,  1,  7, 10, 0 },	// '9'
+	{   92,  4,  4,  2,  7, 0 },	// ':'
+	{   94,  4,  4,  4,  9, 0 },	// ';'
+	{   99,  1,  2,  9,  9, 1 },	// '<'
+	{  108,  1,  5,  9,  3, 1 },	// '='
+	{  110,  1,  2,  9,  9, 1 },	// '>'
+	{  120,  2,  2,  7,  9, 0 },	// '?'
+	{    0,  2,  1,  6, 11, 0 },	// '@'
+	{    9,  1,  2, 10,  9, 0 },	// 'A'
+	{   21,  1,  2,  8,  9, 0 },	// 'B'
+	{   30,  1,  2,  9,  9, 0 },	// 'C'
+	{   41,  1,  2,  9,  9, 0 },	// 'D'
+	{   52,  1,  2,  8,  9, 0 },	// 'E'
+	{   61,  1,  2,  9,  9, 0 },	// 'F'
+	{   72,  1,  2,  9,  9, 0 },	// 'G'
+	{   83,  1,  2,  9,  9, 0 },	// 'H'
+	{   94,  2,  2,  8,  9, 0 },	// 'I'
+	{  103,  1,  2,  9,  9, 0 },	// 'J'
+	{  114,  1,  2,  9,  9, 0 },	// 'K'
+	{  125,  1,  2,  9,  9, 0 },	// 'L'
+	{  136,  0,  2, 11,  9, 0 },	// 'M'
+	{  149,  1,  2,  9,  9, 0 },	// 'N'
+	{  160,  1,  2,  9,  9, 0 },	// 'O'
+	{    0,  1,  2,  8,  9, 0 },	// 'P'
+	{    9,  1,  2,  9, 11, 0 },	// 'Q'
+	{   22,  1,  2, 10,  9, 0 },	// 'R'
+	{   34,  2,  2,  7,  9, 0 },	// 'S'
+	{   42,  1,  2,  8,  9, 0 },	// 'T'
+	{   51,  1,  2,  9,  9, 0 },	// 'U'
+	{   62,  1,  2,  9,  9, 0 },	// 'V'
+	{   73,  0,  2, 11,  9, 0 },	// 'W'
+	{   86,  1,  2,  9,  9, 0 },	// 'X'
+	{   97,  1,  2, 10,  9, 0 },	// 'Y'
+	{  109,  2,  2,  7,  9, 0 },	// 'Z'
+	{  117,  5,  1,  4, 12, 0 },	// '['
+	{  123,  2,  0,  8, 13, 0 },	// '\'
+	{  136,  3,  1,  4, 12, 0 },	// ']'
+	{  142,  2,  0,  7,  6, 0 },	// '^'
+	{  148,  0, 15, 11,  1, 1 },	// '_'
+	{    0,  4,  0,  3,  3, 0 },	// '`'
+	{    2,  2,  4,  8,  7, 0 },	// 'a'
+	{    9,  1,  1,  9, 10, 0 },	// 'b'
+	{   21,  1,  4,  8,  7, 0 },	// 'c'
+	{   28,  1,  1,  9, 10, 0 },	// 'd'
+	{   40,  1,  4,  9,  7, 0 },	// 'e'
+	{   48,  2,  1,  9, 10, 1 },	// 'f'
+	{   59,  1,  4,  9, 10, 0 },	// 'g'
+	{   71,  1,  1,  9, 10, 0 },	// 'h'
+	{   83,  2,  1,  8, 10, 1 },	// 'i'
+	{   92,  2,  1,  6, 13, 0 },	// 'j'
+	{  102,  1,  1,  9, 10, 0 },	// 'k'
+	{  114,  2,  1,  8, 10, 0 },	// 'l'
+	{  124,  1,  4, 10,  7, 0 },	// 'm'
+	{  133,  1,  4,  9,  7, 0 },	// 'n'
+	{  141,  1,  4,  9,  7, 0 },	// 'o'
+	{    0,  1,  4,  9, 10, 0 },	// 'p'
+	{   12,  1,  4,  9, 10, 0 },	// 'q'
+	{   24,  1,  4,  9,  7, 0 },	// 'r'
+	{   32,  2,  4,  7,  7, 1 },	// 's'
+	{   38,  1,  1,  8, 10, 0 },	// 't'
+	{   48,  1,  4,  9,  7, 0 },	// 'u'
+	{   56,  1,  4,  9,  7, 0 },	// 'v'
+	{   64,  0,  4, 11,  7, 0 },	// 'w'
+	{   74,  1,  4,  9,  7, 0 },	// 'x'
+	{   82,  1,  4, 10, 10, 0 },	// 'y'
+	{   95,  2,  4,  7,  7, 0 },	// 'z'
+	{  102,  3,  1,  4, 12, 0 },	// '{'
+	{  108,  5,  1,  2, 12, 1 },	// '|'
+	{  110,  4,  1,  4, 12, 0 },	// '}'
+	{  116,  2,  5,  7,  3, 0 },	// '~'
+};
+
+static const uint16_t Font16_Base [] = { 0, 94, 222, 393, 542, 691 };
+
+static const PFONT Font16_Packed = { Font16_Glyphs, Font16_Base, Font16_Data };
+
+sFONT Font16 = {
+  NULL,
+  11, /* Width */
+  16, /* Height */
+  &Font16_Packed,
+  0,
+};
+
+// Same glyphs, advancing by the glyph width
+sFONT Font16P = {
+  NULL,
+  11, /* Width */
+  16, /* Height */
+  &Font16_Packed,
+  1,
+};
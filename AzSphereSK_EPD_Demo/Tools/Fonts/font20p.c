@@ -0,0 +1,380 @@
+/**
+  ******************************************************************************
+  * @file    font20p.c
+  * @brief   Font20 in the packed format of fonts.h, generated by Tools/FontPack
+  *          from font20.c, do not edit. 1570 bytes, 3800 in font20.c, 25 RLE glyphs.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font20_Data [] = 
+{
+	// @0 '!' 3x13 at 5,1
+	0xFF, 0xFF, 0xFA, 0x40, 0x7E,
+	// @5 '"' 8x6 at 3,2
+	0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42,
+	// @11 '#' 10x16 at 2,0
+	0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F,
+	0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC,
+	// @31 '$' 8x16 at 3,0 RLE
+	0x32, 0x62, 0x56, 0x19, 0x44, 0x65, 0x46, 0x65, 0x44, 0x49, 0x16, 0x52,
+	0x62, 0x62, 0x30,
+	// @46 '%' 9x13 at 2,1
+	0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42,
+	0x21, 0x10, 0x70,
+	// @61 '&' 9x11 at 3,3
+	0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF,
+	0x60,
+	// @74 ''' 3x6 at 6,2
+	0xFF, 0xA4, 0x80,
+	// @77 '(' 4x16 at 6,1
+	0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33,
+	// @85 ')' 4x16 at 4,1
+	0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC,
+	// @93 '*' 8x9 at 3,1
+	0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,
+	// @102 '+' 10x10 at 2,3 RLE
+	0x42, 0x82, 0x82, 0x82, 0x4F, 0x54, 0x28, 0x28, 0x28, 0x24,
+	// @112 ',' 4x6 at 5,11
+	0x76, 0x6C, 0xC8,
+	// @115 '-' 9x2 at 2,7 RLE
+	0x0F, 0x30,
+	// @117 '.' 3x3 at 6,11 RLE
+	0x09,
+	// @118 '/' 8x16 at 3,0
+	0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60,
+	0x60, 0x60, 0xC0, 0xC0,
+	// @134 '0' 9x13 at 2,1
+	0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+	0xCF, 0xE3, 0xE0,
+	// @149 '1' 8x13 at 3,1
+	0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+	// @162 '2' 9x13 at 2,1 RLE
+	0x25, 0x37, 0x13, 0x35, 0x52, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x6F, 0x30,
+	// @176 '3' 10x13 at 1,1 RLE
+	0x35, 0x38, 0x22, 0x43, 0x82, 0x73, 0x45, 0x55, 0x83, 0x82, 0x84, 0x5C,
+	0x27, 0x20,
+	// @190 '4' 9x13 at 2,1
+	0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0,
+	0xC1, 0xF0, 0xF8,
+	// @205 '5' 9x13 at 2,1 RLE
+	0x17, 0x27, 0x22, 0x72, 0x76, 0x37, 0x22, 0x33, 0x72, 0x72, 0x74, 0x4B,
+	0x26, 0x20,
+	// @219 '6' 9x13 at 2,1
+	0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8,
+	0xEF, 0xE1, 0xE0,
+	// @234 '7' 9x13 at 2,1 RLE
+	0x0F, 0x55, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27, 0x26, 0x27, 0x27,
+	0x23,
+	// @247 '8' 9x13 at 2,1
+	0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+	0xEF, 0xE3, 0xE0,
+	// @262 '9' 9x13 at 2,1
+	0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83,
+	0xDF, 0xCF, 0x80,
+	// @277 ':' 3x9 at 6,5 RLE
+	0x09, 0x99,
+	// @279 ';' 5x11 at 5,5
+	0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20,
+	// @286 '<' 11x11 at 1,3 RLE
+	0x92, 0x74, 0x54, 0x63, 0x63, 0x64, 0x93, 0xA3, 0x94, 0x94, 0x92,
+	// @297 '=' 11x6 at 1,5 RLE
+	0x0F, 0x7F, 0x7F, 0x70,
+	// @301 '>' 11x11 at 2,3 RLE
+	0x02, 0x94, 0x94, 0x93, 0xA3, 0x94, 0x63, 0x63, 0x64, 0x54, 0x72, 0x90,
+	// @313 '?' 8x12 at 3,2
+	0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38,
+	// @325 '@' 7x14 at 3,1
+	0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27,
+	0x80,
+	// @338 'A' 12x12 at 1,2
+	0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC,
+	0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,
+	// @356 'B' 10x12 at 2,2
+	0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFE,
+	// @371 'C' 10x12 at 2,2
+	0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC,
+	0x73, 0xF8, 0x7C,
+	// @386 'D' 11x12 at 1,2
+	0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60,
+	0xEC, 0x3B, 0xFE, 0x7F, 0x80,
+	// @403 'E' 10x12 at 2,2
+	0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFF,
+	// @418 'F' 10x12 at 2,2
+	0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18,
+	0x0F, 0xC3, 0xF0,
+	// @433 'G' 11x12 at 2,2
+	0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0,
+	0xCC, 0x19, 0xFF, 0x0F, 0x80,
+	// @450 'H' 10x12 at 2,2
+	0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98,
+	0x6F, 0x3F, 0xCF,
+	// @465 'I' 8x12 at 3,2 RLE
+	0x0F, 0x13, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x23, 0xF1,
+	// @476 'J' 11x12 at 2,2
+	0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1,
+	0x98, 0x73, 0xFC, 0x1F, 0x00,
+	// @493 'K' 11x12 at 2,2
+	0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63,
+	0x0C, 0x33, 0xE7, 0xFC, 0x70,
+	// @510 'L' 10x12 at 2,2 RLE
+	0x06, 0x46, 0x62, 0x82, 0x82, 0x82, 0x82, 0x82, 0x42, 0x22, 0x42, 0x22,
+	0x4F, 0x70,
+	// @524 'M' 12x12 at 1,2
+	0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66,
+	0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F,
+	// @542 'N' 10x12 at 2,2
+	0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98,
+	0xEF, 0xBB, 0xE6,
+	// @557 'O' 10x12 at 2,2
+	0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+	0xE3, 0xF0, 0x78,
+	// @572 'P' 10x12 at 2,2
+	0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18,
+	0x0F, 0xC3, 0xF0,
+	// @587 'Q' 10x15 at 2,2
+	0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+	0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38,
+	// @606 'R' 11x12 at 2,2
+	0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61,
+	0x8C, 0x3B, 0xE3, 0xFC, 0x30,
+	// @623 'S' 10x12 at 2,2 RLE
+	0x25, 0x12, 0x1C, 0x45, 0x65, 0x86, 0x66, 0x85, 0x65, 0x4C, 0x12, 0x15,
+	0x20,
+	// @636 'T' 10x12 at 2,2
+	0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x03, 0xF0, 0xFC,
+	// @651 'U' 10x12 at 2,2
+	0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C,
+	0xE3, 0xF0, 0x78,
+	// @666 'V' 11x12 at 1,2
+	0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B,
+	0x01, 0xC0, 0x38, 0x07, 0x00,
+	// @683 'W' 13x12 at 1,2
+	0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5,
+	0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0,
+	// @703 'X' 11x12 at 1,2
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31,
+	0x8C, 0x1B, 0xC7, 0xF8, 0xF0,
+	// @720 'Y' 10x12 at 2,2
+	0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+	0x03, 0xF0, 0xFC,
+	// @735 'Z' 8x12 at 3,2 RLE
+	0x0F, 0x34, 0x43, 0x25, 0x25, 0x26, 0x25, 0x25, 0x23, 0x44, 0xF3,
+	// @746 '[' 4x16 at 6,1
+	0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,
+	// @754 '\' 8x16 at 3,0
+	0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06,
+	0x06, 0x06, 0x03, 0x03,
+	// @770 ']' 4x16 at 4,1
+	0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,
+	// @778 '^' 9x6 at 2,1
+	0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,
+	// @785 '_' 14x2 at 0,18 RLE
+	0x0F, 0xD0,
+	// @787 '`' 4x3 at 5,1
+	0x86, 0x10,
+	// @789 'a' 10x9 at 2,5
+	0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,
+	// @801 'b' 11x13 at 1,1
+	0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60,
+	0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,
+	// @819 'c' 10x9 at 2,5
+	0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,
+	// @831 'd' 11x13 at 2,1
+	0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0,
+	0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE,
+	// @849 'e' 10x9 at 2,5 RLE
+	0x34, 0x48, 0x22, 0x42, 0x1F, 0x79, 0x25, 0x21, 0x93, 0x52,
+	// @859 'f' 9x13 at 3,1 RLE
+	0x36, 0x27, 0x22, 0x72, 0x58, 0x18, 0x32, 0x72, 0x72, 0x72, 0x72, 0x58,
+	0x18, 0x10,
+	// @873 'g' 11x13 at 2,5
+	0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+	0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,
+	// @891 'h' 10x13 at 2,1
+	0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98,
+	0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+	// @908 'i' 8x13 at 3,1 RLE
+	0x32, 0x62, 0xF4, 0x53, 0x56, 0x26, 0x26, 0x26, 0x26, 0x23, 0xF1,
+	// @919 'j' 8x17 at 2,1 RLE
+	0x42, 0x62, 0xF4, 0x71, 0x76, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+	0x25, 0xA1, 0x62,
+	// @934 'k' 10x13 at 2,1
+	0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B,
+	0x06, 0x63, 0x9F, 0xE7, 0xC0,
+	// @951 'l' 8x13 at 3,1
+	0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+	0xFF,
+	// @964 'm' 12x9 at 1,5
+	0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77,
+	0xF7, 0x70,
+	// @978 'n' 10x9 at 2,5
+	0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+	// @990 'o' 10x9 at 2,5
+	0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,
+	// @1002 'p' 11x13 at 1,5
+	0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F,
+	0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80,
+	// @1020 'q' 11x13 at 2,5
+	0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+	0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E,
+	// @1038 'r' 10x9 at 2,5
+	0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,
+	// @1050 's' 8x9 at 3,5 RLE
+	0x2F, 0x14, 0x65, 0x65, 0x64, 0xF1, 0x20,
+	// @1057 't' 10x12 at 2,2 RLE
+	0x22, 0x82, 0x82, 0x69, 0x19, 0x32, 0x82, 0x82, 0x82, 0x82, 0x42, 0x28,
+	0x35, 0x20,
+	// @1071 'u' 10x9 at 2,5
+	0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0,
+	// @1083 'v' 11x9 at 1,5
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E,
+	0x00,
+	// @1096 'w' 11x9 at 1,5
+	0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31,
+	0x80,
+	// @1109 'x' 10x9 at 2,5
+	0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,
+	// @1121 'y' 11x13 at 1,5
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C,
+	0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0,
+	// @1139 'z' 8x9 at 3,5 RLE
+	0x0F, 0x33, 0x25, 0x25, 0x25, 0x25, 0x23, 0xF3,
+	// @1147 '{' 6x16 at 4,1
+	0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7,
+	// @1159 '|' 2x16 at 6,1 RLE
+	0x0F, 0xF2,
+	// @1161 '}' 6x16 at 3,1
+	0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,
+	// @1173 '~' 10x4 at 2,6
+	0x38, 0x3F, 0x3C, 0xFC, 0x1E,
+};
+
+static const PFONT_GLYPH Font20_Glyphs [] = 
+{
+	// Offset, X, Y, W, H, Rle
+	{    0,  0,  0,  0,  0, 0 },	// ' '
+	{    0,  5,  1,  3, 13, 0 },	// '!'
+	{    5,  3,  2,  8,  6, 0 },	// '"'
+	{   11,  2,  0, 10, 16, 0 },	// '#'
+	{   31,  3,  0,  8, 16, 1 },	// '$'
+	{   46,  2,  1,  9, 13, 0 },	// '%'
+	{   61,  3,  3,  9, 11, 0 },	// '&'
+	{   74,  6,  2,  3,  6, 0 },	// '''
+	{   77,  6,  1,  4, 16, 0 },	// '('
+	{   85,  4,  1,  4, 16, 0 },	// ')'
+	{   93,  3,  1,  8,  9, 0 },	// '*'
+	{  102,  2,  3, 10, 10, 1 },	// '+'
+	{  112,  5, 11,  4,  6, 0 },	// ','
+	{  115,  2,  7,  9,  2, 1 },	// '-'
+	{  117,  6, 11,  3,  3, 1 },	// '.'
+	{  118,  3,  0,  8, 16, 0 },	// '/'
+	{    0,  2,  1,  9, 13, 0 },	// '0'
+	{   15,  3,  1,  8, 13, 0 },	// '1'
+	{   28,  2,  1,  9, 13, 1 },	// '2'
+	{   42,  1,  1, 10, 13, 1 },	// '3'
+	{   56,  2,  1,  9, 13, 0 },	// '4'
+	{   71,  2,  1,  9, 13, 1 },	// '5'
+	{   85,  2,  1,  9, 13, 0 },	// '6'
+	{  100,  2,  1,  9, 13, 1 },	// '7'
+	{  113,  2,  1,  9, 13, 0 },	// '8'
+	{  128,  2,  1,  9, 13, 0 },	// '9'
+	{  143,  6,  5,  3,  9, 1 },	// ':'
+	{  145,  5,  5,  5, 11, 0 },	// ';'
+	{  152,  1,  3, 11, 11, 1 },	// '<'
+	{  163,  1,  5, 11,  6, 1 },	// '='
+	{  167,  2,  3, 11, 11, 1 },	// '>'
+	{  179,  3,  2,  8, 12, 0 },	// '?'
+	{    0,  3,  1,  7, 14, 0 },	// '@'
+	{   13,  1,  2, 12, 12, 0 },	// 'A'
+	{   31,  2,  2, 10, 12, 0 },	// 'B'
+	{   46,  2,  2, 10, 12, 0 },	// 'C'
+	{   61,  1,  2, 11, 12, 0 },	// 'D'
+	{   78,  2,  2, 10, 12, 0 },	// 'E'
+	{   93,  2,  2, 10, 12, 0 },	// 'F'
+	{  108,  2,  2, 11, 12, 0 },	// 'G'
+	{  125,  2,  2, 10, 12, 0 },	// 'H'
+	{  140,  3,  2,  8, 12, 1 },	// 'I'
+	{  151,  2,  2, 11, 12, 0 },	// 'J'
+	{  168,  2,  2, 11, 12, 0 },	// 'K'
+	{  185,  2,  2, 10, 12, 1 },	// 'L'
+	{  199,  1,  2, 12, 12, 0 },	// 'M'
+	{  217,  2,  2, 10, 12, 0 },	// 'N'
+	{  232,  2,  2, 10, 12, 0 },	// 'O'
+	{    0,  2,  2, 10, 12, 0 },	// 'P'
+	{   15,  2,  2, 10, 15, 0 },	// 'Q'
+	{   34,  2,  2, 11, 12, 0 },	// 'R'
+	{   51,  2,  2, 10, 12, 1 },	// 'S'
+	{   64,  2,  2, 10, 12, 0 },	// 'T'
+	{   79,  2,  2, 10, 12, 0 },	// 'U'
+	{   94,  1,  2, 11, 12, 0 },	// 'V'
+	{  111,  1,  2, 13, 12, 0 },	// 'W'
+	{  131,  1,  2, 11, 12, 0 },	// 'X'
+	{  148,  2,  2, 10, 12, 0 },	// 'Y'
+	{  163,  3,  2,  8, 12, 1 },	// 'Z'
+	{  174,  6,  1,  4, 16, 0 },	// '['
+	{  182,  3,  0,  8, 16, 0 },	// '\'
+	{  198,  4,  1,  4, 16, 0 },	// ']'
+	{  206,  2,  1,  9,  6, 0 },	// '^'
+	{  213,  0, 18, 14,  2, 1 },	// '_'
+	{    0,  5,  1,  4,  3, 0 },	// '`'
+	{    2,  2,  5, 10,  9, 0 },	// 'a'
+	{   14,  1,  1, 11, 13, 0 },	// 'b'
+	{   32,  2,  5, 10,  9, 0 },	// 'c'
+	{   44,  2,  1, 11, 13, 0 },	// 'd'
+	{   62,  2,  5, 10,  9, 1 },	// 'e'
+	{   72,  3,  1,  9, 13, 1 },	// 'f'
+	{   86,  2,  5, 11, 13, 0 },	// 'g'
+	{  104,  2,  1, 10, 13, 0 },	// 'h'
+	{  121,  3,  1,  8, 13, 1 },	// 'i'
+	{  132,  2,  1,  8, 17, 1 },	// 'j'
+	{  147,  2,  1, 10, 13, 0 },	// 'k'
+	{  164,  3,  1,  8, 13, 0 },	// 'l'
+	{  177,  1,  5, 12,  9, 0 },	// 'm'
+	{  191,  2,  5, 10,  9, 0 },	// 'n'
+	{  203,  2,  5, 10,  9, 0 },	// 'o'
+	{    0,  1,  5, 11, 13, 0 },	// 'p'
+	{   18,  2,  5, 11, 13, 0 },	// 'q'
+	{   36,  2,  5, 10,  9, 0 },	// 'r'
+	{   48,  3,  5,  8,  9, 1 },	// 's'
+	{   55,  2,  2, 10, 12, 1 },	// 't'
+	{   69,  2,  5, 10,  9, 0 },	// 'u'
+	{   81,  1,  5, 11,  9, 0 },	// 'v'
+	{   94,  1,  5, 11,  9, 0 },	// 'w'
+	{  107,  2,  5, 10,  9, 0 },	// 'x'
+	{  119,  1,  5, 11, 13, 0 },	// 'y'
+	{  137,  3,  5,  8,  9, 1 },	// 'z'
+	{  145,  4,  1,  6, 16, 0 },	// '{'
+	{  157,  6,  1,  2, 16, 1 },	// '|'
+	{  159,  3,  1,  6, 16, 0 },	// '}'
+	{  171,  2,  6, 10,  4, 0 },	// '~'
+};
+
+static const uint16_t Font20_Base [] = { 0, 134, 325, 572, 787, 1002 };
+
+static const PFONT Font20_Packed = { Font20_Glyphs, Font20_Base, Font20_Data };
+
+sFONT Font20 = {
+  NULL,
+  14, /* Width */
+  20, /* Height */
+  &Font20_Packed,
+  0,
+};
+
+// Same glyphs, advancing by the glyph width
+sFONT Font20P = {
+  NULL,
+  14, /* Width */
+  20, /* Height */
+  &Font20_Packed,
+  1,
+};
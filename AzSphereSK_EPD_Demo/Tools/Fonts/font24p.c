@@ -0,0 +1,409 @@
+/**
+  ******************************************************************************
+  * @file    font24p.c
+  * @brief   Font24 in the packed format of fonts.h, generated by Tools/FontPack
+  *          from font24.c, do not edit. 1975 bytes, 6840 in font24.c, 56 RLE glyphs.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font24_Data [] = 
+{
+	// @0 '!' 3x15 at 6,2 RLE
+	0x0F, 0xC1, 0x12, 0x17, 0x60,
+	// @5 '"' 8x7 at 4,3
+	0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42,
+	// @12 '#' 11x16 at 2,2
+	0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99, 0xFF, 0xFF, 0xF8, 0xCC, 0x33,
+	0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98,
+	// @34 '$' 9x19 at 3,1 RLE
+	0x42, 0x72, 0x54, 0x12, 0x1A, 0x45, 0x46, 0x75, 0x56, 0x66, 0x55, 0x45,
+	0x3B, 0x12, 0x14, 0x62, 0x72, 0x72, 0x72, 0x30,
+	// @54 '%' 10x15 at 3,2
+	0x3C, 0x1F, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E,
+	0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0,
+	// @73 '&' 11x13 at 3,4 RLE
+	0x36, 0x47, 0x32, 0x32, 0x42, 0x92, 0xA2, 0x93, 0x75, 0x26, 0x19, 0x34,
+	0x22, 0x43, 0x3A, 0x25, 0x13,
+	// @90 ''' 3x7 at 6,3
+	0xFF, 0xA4, 0x90,
+	// @93 '(' 6x18 at 7,2
+	0x0C, 0x73, 0x9E, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E,
+	0x1C, 0x30,
+	// @107 ')' 6x18 at 3,2
+	0xC3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C,
+	0xE3, 0x00,
+	// @121 '*' 10x10 at 3,2
+	0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C,
+	0xC0,
+	// @134 '+' 12x12 at 2,4 RLE
+	0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x95, 0x2A, 0x2A, 0x2A, 0x2A, 0x25,
+	// @146 ',' 5x7 at 6,14
+	0x39, 0x9C, 0xC6, 0x63, 0x00,
+	// @151 '-' 10x2 at 3,9 RLE
+	0x0F, 0x50,
+	// @153 '.' 4x3 at 6,14 RLE
+	0x0C,
+	// @154 '/' 10x20 at 3,0 RLE
+	0x82, 0x82, 0x73, 0x72, 0x73, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72,
+	0x82, 0x72, 0x82, 0x73, 0x72, 0x73, 0x72, 0x82, 0x80,
+	// @175 '0' 10x15 at 3,2
+	0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+	0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0,
+	// @194 '1' 10x15 at 3,2 RLE
+	0x51, 0x64, 0x46, 0x43, 0x12, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+	0x82, 0x82, 0x4F, 0x50,
+	// @210 '2' 11x15 at 2,2 RLE
+	0x35, 0x49, 0x13, 0x52, 0x12, 0x74, 0x72, 0x92, 0x82, 0x82, 0x73, 0x73,
+	0x72, 0x82, 0x82, 0x8F, 0x70,
+	// @227 '3' 10x15 at 3,2 RLE
+	0x34, 0x47, 0x32, 0x33, 0x82, 0x82, 0x72, 0x54, 0x65, 0x83, 0x92, 0x82,
+	0x84, 0x5C, 0x26, 0x30,
+	// @243 '4' 11x15 at 2,2
+	0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61,
+	0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xF8,
+	// @264 '5' 11x15 at 2,2 RLE
+	0x19, 0x29, 0x22, 0x92, 0x92, 0x92, 0x14, 0x49, 0x23, 0x42, 0xA2, 0x92,
+	0x92, 0x94, 0x62, 0x1A, 0x36, 0x30,
+	// @282 '6' 10x15 at 3,2
+	0x07, 0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0,
+	0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0,
+	// @301 '7' 10x15 at 3,2 RLE
+	0x0F, 0x76, 0x45, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27, 0x37, 0x28, 0x27,
+	0x37, 0x28, 0x24,
+	// @316 '8' 10x15 at 3,2
+	0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0,
+	0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0,
+	// @335 '9' 10x15 at 3,2
+	0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0,
+	0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80,
+	// @354 ':' 4x11 at 6,6 RLE
+	0x0C, 0xF5, 0xC0,
+	// @357 ';' 6x13 at 6,6
+	0x3C, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80,
+	// @367 '<' 14x13 at 0,4 RLE
+	0xB3, 0xA4, 0x84, 0x84, 0x84, 0x84, 0x84, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+	0xB3,
+	// @380 '=' 13x6 at 1,7 RLE
+	0x0F, 0xBF, 0xBF, 0xB0,
+	// @384 '>' 14x13 at 1,4 RLE
+	0x03, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0xA3, 0xB0,
+	// @398 '?' 9x14 at 3,3 RLE
+	0x25, 0x37, 0x12, 0x45, 0x54, 0x52, 0x63, 0x53, 0x44, 0x53, 0x62, 0xF9,
+	0x36, 0x34,
+	// @412 '@' 10x17 at 3,2
+	0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3,
+	0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07, 0x0C, 0xFF, 0x1F, 0x00,
+	// @434 'A' 16x14 at 0,3 RLE
+	0x36, 0xA7, 0xD3, 0xC2, 0x12, 0xB2, 0x12, 0xA2, 0x32, 0x92, 0x32, 0x82,
+	0x42, 0x89, 0x6A, 0x62, 0x72, 0x42, 0x82, 0x26, 0x3D, 0x37,
+	// @456 'B' 13x14 at 1,3 RLE
+	0x0A, 0x3B, 0x42, 0x53, 0x32, 0x62, 0x32, 0x62, 0x32, 0x53, 0x39, 0x4A,
+	0x32, 0x63, 0x22, 0x72, 0x22, 0x72, 0x22, 0x7E, 0x1B, 0x20,
+	// @478 'C' 12x14 at 2,3 RLE
+	0x45, 0x12, 0x2A, 0x13, 0x53, 0x12, 0x74, 0x84, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xB2, 0x72, 0x13, 0x53, 0x29, 0x56, 0x20,
+	// @497 'D' 13x14 at 1,3
+	0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+	0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0,
+	// @520 'E' 12x14 at 1,3
+	0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+	0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF,
+	// @541 'F' 12x14 at 2,3
+	0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+	0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,
+	// @562 'G' 13x14 at 2,3 RLE
+	0x45, 0x12, 0x3A, 0x23, 0x53, 0x22, 0x72, 0x12, 0x82, 0x12, 0xB2, 0xB2,
+	0x49, 0x49, 0x82, 0x13, 0x72, 0x23, 0x53, 0x3A, 0x56, 0x30,
+	// @584 'H' 14x14 at 1,3 RLE
+	0x06, 0x2C, 0x26, 0x22, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x4A,
+	0x4A, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x2C, 0x26,
+	// @608 'I' 10x14 at 3,3 RLE
+	0x0F, 0x54, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x24,
+	0xF5,
+	// @621 'J' 13x14 at 2,3 RLE
+	0x3A, 0x3A, 0x82, 0xB2, 0xB2, 0xB2, 0xB2, 0x32, 0x62, 0x32, 0x62, 0x32,
+	0x62, 0x32, 0x62, 0x32, 0x52, 0x49, 0x65, 0x60,
+	// @641 'K' 15x14 at 1,3 RLE
+	0x07, 0x25, 0x17, 0x25, 0x32, 0x52, 0x62, 0x42, 0x72, 0x32, 0x82, 0x22,
+	0x92, 0x13, 0x97, 0x83, 0x23, 0x72, 0x43, 0x62, 0x52, 0x62, 0x53, 0x37,
+	0x3C, 0x35,
+	// @667 'L' 13x14 at 1,3 RLE
+	0x08, 0x58, 0x82, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x62, 0x32, 0x62,
+	0x32, 0x62, 0x32, 0x6F, 0xD0,
+	// @684 'M' 16x14 at 0,3
+	0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C,
+	0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C,
+	0xFE, 0x7F, 0xFE, 0x7F,
+	// @712 'N' 14x14 at 1,3
+	0xF1, 0xFF, 0xC7, 0xF3, 0x83, 0x0F, 0x0C, 0x3E, 0x30, 0xD8, 0xC3, 0x73,
+	0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3, 0x0F, 0x0C, 0x1C, 0xFE, 0x33, 0xF8,
+	0xC0,
+	// @737 'O' 12x14 at 2,3 RLE
+	0x44, 0x68, 0x33, 0x43, 0x22, 0x62, 0x13, 0x65, 0x84, 0x84, 0x84, 0x85,
+	0x63, 0x12, 0x62, 0x23, 0x43, 0x38, 0x64, 0x40,
+	// @757 'P' 12x14 at 2,3 RLE
+	0x0A, 0x2B, 0x32, 0x53, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22, 0x52,
+	0x39, 0x37, 0x52, 0xA2, 0xA2, 0x88, 0x48, 0x40,
+	// @777 'Q' 12x17 at 2,3 RLE
+	0x44, 0x68, 0x33, 0x43, 0x22, 0x62, 0x13, 0x65, 0x84, 0x84, 0x84, 0x85,
+	0x63, 0x12, 0x62, 0x23, 0x43, 0x38, 0x55, 0x75, 0x22, 0x2A, 0x22, 0x43,
+	0x10,
+	// @802 'R' 14x14 at 1,3 RLE
+	0x0A, 0x4B, 0x52, 0x53, 0x42, 0x62, 0x42, 0x62, 0x42, 0x53, 0x49, 0x57,
+	0x72, 0x33, 0x62, 0x43, 0x52, 0x52, 0x52, 0x53, 0x27, 0x3B, 0x43,
+	// @825 'S' 10x14 at 3,3 RLE
+	0x25, 0x12, 0x1C, 0x45, 0x64, 0x66, 0x76, 0x66, 0x76, 0x64, 0x65, 0x4C,
+	0x12, 0x15, 0x20,
+	// @840 'T' 12x14 at 2,3 RLE
+	0x0F, 0xB3, 0x23, 0x43, 0x23, 0x43, 0x23, 0x43, 0x23, 0x25, 0x2A, 0x2A,
+	0x2A, 0x2A, 0x2A, 0x27, 0x84, 0x82,
+	// @858 'U' 14x14 at 1,3
+	0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E,
+	0x00,
+	// @883 'V' 15x14 at 1,3 RLE
+	0x07, 0x1E, 0x17, 0x22, 0x72, 0x52, 0x52, 0x62, 0x52, 0x62, 0x52, 0x72,
+	0x32, 0x82, 0x32, 0x92, 0x12, 0xA2, 0x12, 0xA2, 0x12, 0xB3, 0xC3, 0xD1,
+	0x70,
+	// @908 'W' 17x14 at 0,3
+	0xFE, 0x3F, 0xFF, 0x1F, 0xCC, 0x01, 0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE,
+	0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B, 0x6C, 0x0F, 0x3E, 0x03, 0x8E, 0x01,
+	0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0,
+	// @938 'X' 14x14 at 1,3 RLE
+	0x06, 0x2C, 0x26, 0x22, 0x62, 0x52, 0x42, 0x72, 0x22, 0x94, 0xB2, 0xC2,
+	0xB4, 0x92, 0x22, 0x72, 0x42, 0x52, 0x62, 0x26, 0x2C, 0x26,
+	// @960 'Y' 14x14 at 1,3 RLE
+	0x05, 0x3B, 0x36, 0x22, 0x62, 0x52, 0x42, 0x72, 0x22, 0x82, 0x22, 0x94,
+	0xB2, 0xC2, 0xC2, 0xC2, 0xC2, 0x98, 0x68, 0x30,
+	// @980 'Z' 11x14 at 2,3
+	0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66, 0x18, 0xC6, 0x01, 0x80, 0x60, 0x18,
+	0x66, 0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
+	// @1000 '[' 5x18 at 7,2
+	0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0,
+	// @1012 '\' 10x20 at 3,0 RLE
+	0x02, 0x82, 0x83, 0x82, 0x83, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92,
+	0x82, 0x92, 0x82, 0x83, 0x82, 0x83, 0x82, 0x82,
+	// @1032 ']' 5x18 at 4,2
+	0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xC0,
+	// @1044 '^' 11x8 at 3,1
+	0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01,
+	// @1055 '_' 16x2 at 0,22 RLE
+	0x0F, 0xF2,
+	// @1057 '`' 5x4 at 6,1
+	0xC7, 0x0E, 0x30,
+	// @1060 'a' 12x11 at 2,6 RLE
+	0x26, 0x58, 0xB2, 0xA2, 0x57, 0x39, 0x23, 0x52, 0x22, 0x62, 0x22, 0x53,
+	0x3B, 0x25, 0x14,
+	// @1075 'b' 13x15 at 1,2
+	0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6,
+	0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF,
+	0x00,
+	// @1100 'c' 12x11 at 2,6 RLE
+	0x45, 0x12, 0x2A, 0x13, 0x56, 0x74, 0x84, 0xA2, 0xA3, 0x72, 0x13, 0x53,
+	0x29, 0x56, 0x20,
+	// @1115 'd' 13x15 at 2,2 RLE
+	0x74, 0x94, 0xB2, 0xB2, 0x55, 0x12, 0x3A, 0x32, 0x53, 0x22, 0x72, 0x22,
+	0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x32, 0x53, 0x3C, 0x35, 0x14,
+	// @1139 'e' 12x11 at 2,6 RLE
+	0x36, 0x4A, 0x22, 0x62, 0x12, 0x8F, 0xDA, 0x2B, 0x27, 0x21, 0xB3, 0x72,
+	// @1151 'f' 12x15 at 2,2 RLE
+	0x57, 0x48, 0x32, 0xA2, 0x7B, 0x1B, 0x42, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0x7A, 0x2A, 0x20,
+	// @1167 'g' 13x16 at 2,6
+	0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98,
+	0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x70, 0xFF,
+	0x07, 0xE0,
+	// @1193 'h' 14x15 at 1,2 RLE
+	0x04, 0xA4, 0xC2, 0xC2, 0xC2, 0x15, 0x69, 0x53, 0x43, 0x42, 0x62, 0x42,
+	0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x2C, 0x26,
+	// @1217 'i' 12x15 at 2,2 RLE
+	0x52, 0xA2, 0xFF, 0x06, 0x66, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0x5F, 0x90,
+	// @1231 'j' 9x20 at 3,2 RLE
+	0x52, 0x72, 0xF5, 0xF3, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+	0x72, 0x72, 0x72, 0x6B, 0x16, 0x30,
+	// @1249 'k' 12x15 at 2,2 RLE
+	0x04, 0x84, 0xA2, 0xA2, 0xA2, 0x25, 0x32, 0x25, 0x32, 0x22, 0x62, 0x12,
+	0x75, 0x74, 0x85, 0x72, 0x13, 0x62, 0x23, 0x34, 0x39, 0x35,
+	// @1271 'l' 12x15 at 2,2 RLE
+	0x16, 0x66, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0x5F, 0x90,
+	// @1286 'm' 16x11 at 0,6
+	0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C,
+	0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF,
+	// @1308 'n' 14x11 at 1,6
+	0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0,
+	// @1328 'o' 12x11 at 2,6 RLE
+	0x44, 0x68, 0x33, 0x43, 0x13, 0x65, 0x84, 0x84, 0x85, 0x63, 0x13, 0x43,
+	0x38, 0x64, 0x40,
+	// @1343 'p' 13x16 at 1,6
+	0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+	0x03, 0x38, 0x31, 0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8,
+	0x1F, 0xC0,
+	// @1369 'q' 13x16 at 2,6 RLE
+	0x35, 0x14, 0x1C, 0x12, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22,
+	0x72, 0x22, 0x72, 0x32, 0x53, 0x3A, 0x55, 0x12, 0xB2, 0xB2, 0xB2, 0x87,
+	0x67,
+	// @1394 'r' 12x11 at 2,6 RLE
+	0x05, 0x24, 0x15, 0x16, 0x35, 0x22, 0x33, 0x92, 0xA2, 0xA2, 0xA2, 0xA2,
+	0x7A, 0x2A, 0x20,
+	// @1409 's' 10x11 at 3,6 RLE
+	0x28, 0x1B, 0x64, 0x68, 0x58, 0x67, 0x64, 0x5C, 0x18, 0x20,
+	// @1419 't' 12x15 at 2,2 RLE
+	0x22, 0xA2, 0xA2, 0xA2, 0x8A, 0x2A, 0x42, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+	0xA2, 0x53, 0x39, 0x46, 0x20,
+	// @1436 'u' 14x11 at 1,6
+	0xF0, 0xF3, 0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0, 0xFB, 0xC0,
+	// @1456 'v' 14x11 at 1,6 RLE
+	0x05, 0x4A, 0x45, 0x22, 0x62, 0x42, 0x62, 0x52, 0x42, 0x62, 0x42, 0x72,
+	0x22, 0x82, 0x22, 0x86, 0x94, 0xA4, 0x50,
+	// @1475 'w' 13x11 at 1,6
+	0xF0, 0x7F, 0x83, 0xD8, 0x8C, 0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87,
+	0xBC, 0x38, 0xC0, 0xC6, 0x06, 0x30,
+	// @1493 'x' 12x11 at 2,6
+	0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x98,
+	0x30, 0xCF, 0x9F, 0xF9, 0xF0,
+	// @1510 'y' 15x16 at 1,6 RLE
+	0x06, 0x4B, 0x45, 0x22, 0x72, 0x52, 0x52, 0x62, 0x52, 0x72, 0x32, 0x82,
+	0x32, 0x92, 0x12, 0xA5, 0xB3, 0xD2, 0xC2, 0xD2, 0xC2, 0x98, 0x78, 0x60,
+	// @1534 'z' 10x11 at 3,6 RLE
+	0x0F, 0x75, 0x21, 0x24, 0x27, 0x27, 0x27, 0x27, 0x24, 0x21, 0x25, 0xF7,
+	// @1546 '{' 6x18 at 5,2
+	0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0C,
+	0x3C, 0x70,
+	// @1560 '|' 2x18 at 7,2 RLE
+	0x0F, 0xF6,
+	// @1562 '}' 6x18 at 5,2
+	0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x0C,
+	0xF3, 0x80,
+	// @1576 '~' 11x5 at 2,8
+	0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38,
+};
+
+static const PFONT_GLYPH Font24_Glyphs [] = 
+{
+	// Offset, X, Y, W, H, Rle
+	{    0,  0,  0,  0,  0, 0 },	// ' '
+	{    0,  6,  2,  3, 15, 1 },	// '!'
+	{    5,  4,  3,  8,  7, 0 },	// '"'
+	{   12,  2,  2, 11, 16, 0 },	// '#'
+	{   34,  3,  1,  9, 19, 1 },	// '$'
+	{   54,  3,  2, 10, 15, 0 },	// '%'
+	{   73,  3,  4, 11, 13, 1 },	// '&'
+	{   90,  6,  3,  3,  7, 0 },	// '''
+	{   93,  7,  2,  6, 18, 0 },	// '('
+	{  107,  3,  2,  6, 18, 0 },	// ')'
+	{  121,  3,  2, 10, 10, 0 },	// '*'
+	{  134,  2,  4, 12, 12, 1 },	// '+'
+	{  146,  6, 14,  5,  7, 0 },	// ','
+	{  151,  3,  9, 10,  2, 1 },	// '-'
+	{  153,  6, 14,  4,  3, 1 },	// '.'
+	{  154,  3,  0, 10, 20, 1 },	// '/'
+	{    0,  3,  2, 10, 15, 0 },	// '0'
+	{   19,  3,  2, 10, 15, 1 },	// '1'
+	{   35,  2,  2, 11, 15, 1 },	// '2'
+	{   52,  3,  2, 10, 15, 1 },	// '3'
+	{   68,  2,  2, 11, 15, 0 },	// '4'
+	{   89,  2,  2, 11, 15, 1 },	// '5'
+	{  107,  3,  2, 10, 15, 0 },	// '6'
+	{  126,  3,  2, 10, 15, 1 },	// '7'
+	{  141,  3,  2, 10, 15, 0 },	// '8'
+	{  160,  3,  2, 10, 15, 0 },	// '9'
+	{  179,  6,  6,  4, 11, 1 },	// ':'
+	{  182,  6,  6,  6, 13, 0 },	// ';'
+	{  192,  0,  4, 14, 13, 1 },	// '<'
+	{  205,  1,  7, 13,  6, 1 },	// '='
+	{  209,  1,  4, 14, 13, 1 },	// '>'
+	{  223,  3,  3,  9, 14, 1 },	// '?'
+	{    0,  3,  2, 10, 17, 0 },	// '@'
+	{   22,  0,  3, 16, 14, 1 },	// 'A'
+	{   44,  1,  3, 13, 14, 1 },	// 'B'
+	{   66,  2,  3, 12, 14, 1 },	// 'C'
+	{   85,  1,  3, 13, 14, 0 },	// 'D'
+	{  108,  1,  3, 12, 14, 0 },	// 'E'
+	{  129,  2,  3, 12, 14, 0 },	// 'F'
+	{  150,  2,  3, 13, 14, 1 },	// 'G'
+	{  172,  1,  3, 14, 14, 1 },	// 'H'
+	{  196,  3,  3, 10, 14, 1 },	// 'I'
+	{  209,  2,  3, 13, 14, 1 },	// 'J'
+	{  229,  1,  3, 15, 14, 1 },	// 'K'
+	{  255,  1,  3, 13, 14, 1 },	// 'L'
+	{  272,  0,  3, 16, 14, 0 },	// 'M'
+	{  300,  1,  3, 14, 14, 0 },	// 'N'
+	{  325,  2,  3, 12, 14, 1 },	// 'O'
+	{    0,  2,  3, 12, 14, 1 },	// 'P'
+	{   20,  2,  3, 12, 17, 1 },	// 'Q'
+	{   45,  1,  3, 14, 14, 1 },	// 'R'
+	{   68,  3,  3, 10, 14, 1 },	// 'S'
+	{   83,  2,  3, 12, 14, 1 },	// 'T'
+	{  101,  1,  3, 14, 14, 0 },	// 'U'
+	{  126,  1,  3, 15, 14, 1 },	// 'V'
+	{  151,  0,  3, 17, 14, 0 },	// 'W'
+	{  181,  1,  3, 14, 14, 1 },	// 'X'
+	{  203,  1,  3, 14, 14, 1 },	// 'Y'
+	{  223,  2,  3, 11, 14, 0 },	// 'Z'
+	{  243,  7,  2,  5, 18, 0 },	// '['
+	{  255,  3,  0, 10, 20, 1 },	// '\'
+	{  275,  4,  2,  5, 18, 0 },	// ']'
+	{  287,  3,  1, 11,  8, 0 },	// '^'
+	{  298,  0, 22, 16,  2, 1 },	// '_'
+	{    0,  6,  1,  5,  4, 0 },	// '`'
+	{    3,  2,  6, 12, 11, 1 },	// 'a'
+	{   18,  1,  2, 13, 15, 0 },	// 'b'
+	{   43,  2,  6, 12, 11, 1 },	// 'c'
+	{   58,  2,  2, 13, 15, 1 },	// 'd'
+	{   82,  2,  6, 12, 11, 1 },	// 'e'
+	{   94,  2,  2, 12, 15, 1 },	// 'f'
+	{  110,  2,  6, 13, 16, 0 },	// 'g'
+	{  136,  1,  2, 14, 15, 1 },	// 'h'
+	{  160,  2,  2, 12, 15, 1 },	// 'i'
+	{  174,  3,  2,  9, 20, 1 },	// 'j'
+	{  192,  2,  2, 12, 15, 1 },	// 'k'
+	{  214,  2,  2, 12, 15, 1 },	// 'l'
+	{  229,  0,  6, 16, 11, 0 },	// 'm'
+	{  251,  1,  6, 14, 11, 0 },	// 'n'
+	{  271,  2,  6, 12, 11, 1 },	// 'o'
+	{    0,  1,  6, 13, 16, 0 },	// 'p'
+	{   26,  2,  6, 13, 16, 1 },	// 'q'
+	{   51,  2,  6, 12, 11, 1 },	// 'r'
+	{   66,  3,  6, 10, 11, 1 },	// 's'
+	{   76,  2,  2, 12, 15, 1 },	// 't'
+	{   93,  1,  6, 14, 11, 0 },	// 'u'
+	{  113,  1,  6, 14, 11, 1 },	// 'v'
+	{  132,  1,  6, 13, 11, 0 },	// 'w'
+	{  150,  2,  6, 12, 11, 0 },	// 'x'
+	{  167,  1,  6, 15, 16, 1 },	// 'y'
+	{  191,  3,  6, 10, 11, 1 },	// 'z'
+	{  203,  5,  2,  6, 18, 0 },	// '{'
+	{  217,  7,  2,  2, 18, 1 },	// '|'
+	{  219,  5,  2,  6, 18, 0 },	// '}'
+	{  233,  2,  8, 11,  5, 0 },	// '~'
+};
+
+static const uint16_t Font24_Base [] = { 0, 175, 412, 757, 1057, 1343 };
+
+static const PFONT Font24_Packed = { Font24_Glyphs, Font24_Base, Font24_Data };
+
+sFONT Font24 = {
+  NULL,
+  17, /* Width */
+  24, /* Height */
+  &Font24_Packed,
+  0,
+};
+
+// Same glyphs, advancing by the glyph width
+sFONT Font24P = {
+  NULL,
+  17, /* Width */
+  24, /* Height */
+  &Font24_Packed,
+  1,
+};
@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file    font8p.c
+  * @brief   Font8 in the packed format of fonts.h, generated by Tools/FontPack
+  *          from font8.c, do not edit. 667 bytes, 760 in font8.c, 0 RLE glyphs.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
+#include "fonts.h"
+
+static const uint8_t Font8_Data [] = 
+{
+	// @0 '!' 1x6 at 2,0
+	0xF4,
+	// @1 '"' 3x2 at 1,0
+	0xB4,
+	// @2 '#' 5x7 at 0,0
+	0x2A, 0xBE, 0xAF, 0xAA, 0x80,
+	// @7 '$' 3x7 at 1,0
+	0x4F, 0x33, 0x90,
+	// @10 '%' 4x6 at 1,0
+	0x44, 0x3C, 0x22,
+	// @13 '&' 4x5 at 1,1
+	0x74, 0xCA, 0xF0,
+	// @16 ''' 1x3 at 2,0
+	0xE0,
+	// @17 '(' 2x7 at 2,0
+	0x6A, 0xA4,
+	// @19 ')' 2x7 at 1,0
+	0x95, 0x58,
+	// @21 '*' 3x4 at 1,0
+	0x5D, 0x50,
+	// @23 '+' 5x5 at 0,1
+	0x21, 0x3E, 0x42, 0x00,
+	// @27 ',' 2x3 at 2,4
+	0x68,
+	// @28 '-' 3x1 at 1,3
+	0xE0,
+	// @29 '.' 1x1 at 2,5
+	0x80,
+	// @30 '/' 4x7 at 0,0
+	0x12, 0x22, 0x44, 0x80,
+	// @34 '0' 3x6 at 1,0
+	0x56, 0xDA, 0x80,
+	// @37 '1' 5x6 at 0,0
+	0x61, 0x08, 0x42, 0x7C,
+	// @41 '2' 3x6 at 1,0
+	0x55, 0x29, 0xC0,
+	// @44 '3' 3x6 at 1,0
+	0x54, 0xA3, 0x80,
+	// @47 '4' 4x6 at 1,0
+	0x26, 0xAF, 0x27,
+	// @50 '5' 3x6 at 1,0
+	0xF3, 0x1A, 0x80,
+	// @53 '6' 3x6 at 1,0
+	0x73, 0x5B, 0x80,
+	// @56 '7' 3x6 at 1,0
+	0xF4, 0xA4, 0x80,
+	// @59 '8' 3x6 at 1,0
+	0x55, 0x5A, 0x80,
+	// @62 '9' 3x6 at 1,0
+	0x76, 0xB3, 0x80,
+	// @65 ':' 1x4 at 2,2
+	0x90,
+	// @66 ';' 2x4 at 2,2
+	0x46,
+	// @67 '<' 4x5 at 0,1
+	0x12, 0xC2, 0x10,
+	// @70 '=' 3x3 at 1,1
+	0xE3, 0x80,
+	// @72 '>' 4x5 at 1,1
+	0x84, 0x34, 0x80,
+	// @75 '?' 3x6 at 1,0
+	0x54, 0xA0, 0x80,
+	// @78 '@' 4x7 at 1,0
+	0x69, 0x9B, 0x98, 0x70,
+	// @82 'A' 5x6 at 0,0
+	0x61, 0x14, 0xE8, 0xEC,
+	// @86 'B' 5x6 at 0,0
+	0xF2, 0x5C, 0x94, 0xF8,
+	// @90 'C' 3x6 at 1,0
+	0xF6, 0x48, 0xC0,
+	// @93 'D' 5x6 at 0,0
+	0xF2, 0x52, 0x94, 0xF8,
+	// @97 'E' 5x6 at 0,0
+	0xFA, 0x58, 0x84, 0xFC,
+	// @101 'F' 5x6 at 0,0
+	0xFA, 0x58, 0x84, 0x70,
+	// @105 'G' 4x6 at 1,0
+	0xE8, 0x8B, 0xA6,
+	// @108 'H' 5x6 at 0,0
+	0xEA, 0x5E, 0x94, 0xF4,
+	// @112 'I' 3x6 at 1,0
+	0xE9, 0x25, 0xC0,
+	// @115 'J' 4x6 at 1,0
+	0x72, 0x2A, 0xA4,
+	// @118 'K' 5x6 at 0,0
+	0xDA, 0x98, 0xE5, 0x6C,
+	// @122 'L' 5x6 at 0,0
+	0xE2, 0x10, 0x84, 0xFC,
+	// @126 'M' 5x6 at 0,0
+	0xDE, 0xF7, 0x58, 0xEC,
+	// @130 'N' 5x6 at 0,0
+	0xDB, 0x5A, 0xB5, 0xF4,
+	// @134 'O' 4x6 at 1,0
+	0x69, 0x99, 0x96,
+	// @137 'P' 5x6 at 0,0
+	0xF2, 0x52, 0xE4, 0x70,
+	// @141 'Q' 4x7 at 1,0
+	0x69, 0x99, 0x96, 0x30,
+	// @145 'R' 5x6 at 0,0
+	0xF2, 0x52, 0xE4, 0xF4,
+	// @149 'S' 3x6 at 1,0
+	0xF5, 0x1B, 0xC0,
+	// @152 'T' 5x6 at 0,0
+	0xFD, 0x48, 0x42, 0x38,
+	// @156 'U' 5x6 at 0,0
+	0xDA, 0x52, 0x94, 0x98,
+	// @160 'V' 5x6 at 0,0
+	0xDC, 0x52, 0xA5, 0x18,
+	// @164 'W' 5x6 at 0,0
+	0xDC, 0x6B, 0x5A, 0xA8,
+	// @168 'X' 5x6 at 0,0
+	0xDA, 0x88, 0x45, 0x6C,
+	// @172 'Y' 5x6 at 0,0
+	0xDC, 0x54, 0x42, 0x38,
+	// @176 'Z' 4x6 at 1,0
+	0xF9, 0x24, 0x9F,
+	// @179 '[' 2x7 at 2,0
+	0xEA, 0xAC,
+	// @181 '\' 4x7 at 0,0
+	0x84, 0x42, 0x22, 0x10,
+	// @185 ']' 2x7 at 1,0
+	0xD5, 0x5C,
+	// @187 '^' 3x3 at 1,0
+	0x4A, 0x80,
+	// @189 '_' 5x1 at 0,7
+	0xF8,
+	// @190 '`' 2x2 at 2,0
+	0x90,
+	// @191 'a' 4x4 at 1,2
+	0x62, 0xEF,
+	// @193 'b' 5x6 at 0,0
+	0xC2, 0x1C, 0x94, 0xF8,
+	// @197 'c' 3x4 at 1,2
+	0xF2, 0x70,
+	// @199 'd' 4x6 at 1,0
+	0x31, 0x79, 0x97,
+	// @202 'e' 3x4 at 1,2
+	0xFE, 0x30,
+	// @204 'f' 3x6 at 1,0
+	0x2B, 0xA5, 0xC0,
+	// @207 'g' 4x6 at 1,2
+	0x79, 0x97, 0x16,
+	// @210 'h' 5x6 at 0,0
+	0xC2, 0x1C, 0x94, 0xF4,
+	// @214 'i' 3x6 at 1,0
+	0x43, 0x25, 0xC0,
+	// @217 'j' 3x8 at 1,0
+	0x43, 0x92, 0x4F,
+	// @220 'k' 5x6 at 0,0
+	0xC2, 0x16, 0xE5, 0x6C,
+	// @224 'l' 3x6 at 1,0
+	0xC9, 0x25, 0xC0,
+	// @227 'm' 5x4 at 0,2
+	0xD5, 0x6B, 0x50,
+	// @230 'n' 5x4 at 0,2
+	0xF2, 0x53, 0x90,
+	// @233 'o' 4x4 at 1,2
+	0x69, 0x96,
+	// @235 'p' 5x6 at 0,2
+	0xF2, 0x52, 0xE4, 0x70,
+	// @239 'q' 4x6 at 1,2
+	0x79, 0x97, 0x13,
+	// @242 'r' 4x4 at 1,2
+	0xF4, 0x4E,
+	// @244 's' 3x4 at 1,2
+	0x68, 0xE0,
+	// @246 't' 5x5 at 0,1
+	0x47, 0x90, 0x93, 0x00,
+	// @250 'u' 5x4 at 0,2
+	0xDA, 0x52, 0x70,
+	// @253 'v' 5x4 at 0,2
+	0xCA, 0x4C, 0x60,
+	// @256 'w' 5x4 at 0,2
+	0xDD, 0x6A, 0xA0,
+	// @259 'x' 4x4 at 1,2
+	0x96, 0x69,
+	// @261 'y' 5x6 at 0,2
+	0xDA, 0x94, 0x42, 0x30,
+	// @265 'z' 4x4 at 1,2
+	0xFA, 0x5F,
+	// @267 '{' 3x7 at 1,0
+	0x29, 0x64, 0x88,
+	// @270 '|' 1x7 at 2,0
+	0xFE,
+	// @271 '}' 3x7 at 1,0
+	0x89, 0x34, 0xA0,
+	// @274 '~' 4x2 at 1,3
+	0x5A,
+};
+
+static const PFONT_GLYPH Font8_Glyphs [] = 
+{
+	// Offset, X, Y, W, H, Rle
+	{    0,  0,  0,  0,  0, 0 },	// ' '
+	{    0,  2,  0,  1,  6, 0 },	// '!'
+	{    1,  1,  0,  3,  2, 0 },	// '"'
+	{    2,  0,  0,  5,  7, 0 },	// '#'
+	{    7,  1,  0,  3,  7, 0 },	// '$'
+	{   10,  1,  0,  4,  6, 0 },	// '%'
+	{   13,  1,  1,  4,  5, 0 },	// '&'
+	{   16,  2,  0,  1,  3, 0 },	// '''
+	{   17,  2,  0,  2,  7, 0 },	// '('
+	{   19,  1,  0,  2,  7, 0 },	// ')'
+	{   21,  1,  0,  3,  4, 0 },	// '*'
+	{   23,  0,  1,  5,  5, 0 },	// '+'
+	{   27,  2,  4,  2,  3, 0 },	// ','
+	{   28,  1,  3,  3,  1, 0 },	// '-'
+	{   29,  2,  5,  1,  1, 0 },	// '.'
+	{   30,  0,  0,  4,  7, 0 },	// '/'
+	{    0,  1,  0,  3,  6, 0 },	// '0'
+	{    3,  0,  0,  5,  6, 0 },	// '1'
+	{    7,  1,  0,  3,  6, 0 },	// '2'
+	{   10,  1,  0,  3,  6, 0 },	// '3'
+	{   13,  1,  0,  4,  6, 0 },	// '4'
+	{   16,  1,  0,  3,  6, 0 },	// '5'
+	{   19,  1,  0,  3,  6, 0 },	// '6'
+	{   22,  1,  0,  3,  6, 0 },	// '7'
+	{   25,  1,  0,  3,  6, 0 },	// '8'
+	{   28,  1,  0,  3,  6, 0 },	// '9'
+	{   31,  2,  2,  1,  4, 0 },	// ':'
+	{   32,  2,  2,  2,  4, 0 },	// ';'
+	{   33,  0,  1,  4,  5, 0 },	// '<'
+	{   36,  1,  1,  3,  3, 0 },	// '='
+	{   38,  1,  1,  4,  5, 0 },	// '>'
+	{   41,  1,  0,  3,  6, 0 },	// '?'
+	{    0,  1,  0,  4,  7, 0 },	// '@'
+	{    4,  0,  0,  5,  6, 0 },	// 'A'
+	{    8,  0,  0,  5,  6, 0 },	// 'B'
+	{   12,  1,  0,  3,  6, 0 },	// 'C'
+	{   15,  0,  0,  5,  6, 0 },	// 'D'
+	{   19,  0,  0,  5,  6, 0 },	// 'E'
+	{   23,  0,  0,  5,  6, 0 },	// 'F'
+	{   27,  1,  0,  4,  6, 0 },	// 'G'
+	{   30,  0,  0,  5,  6, 0 },	// 'H'
+	{   34,  1,  0,  3,  6, 0 },	// 'I'
+	{   37,  1,  0,  4,  6, 0 },	// 'J'
+	{   40,  0,  0,  5,  6, 0 },	// 'K'
+	{   44,  0,  0,  5,  6, 0 },	// 'L'
+	{   48,  0,  0,  5,  6, 0 },	// 'M'
+	{   52,  0,  0,  5,  6, 0 },	// 'N'
+	{   56,  1,  0,  4,  6, 0 },	// 'O'
+	{    0,  0,  0,  5,  6, 0 },	// 'P'
+	{    4,  1,  0,  4,  7, 0 },	// 'Q'
+	{    8,  0,  0,  5,  6, 0 },	// 'R'
+	{   12,  1,  0,  3,  6, 0 },	// 'S'
+	{   15,  0,  0,  5,  6, 0 },	// 'T'
+	{   19,  0,  0,  5,  6, 0 },	// 'U'
+	{   23,  0,  0,  5,  6, 0 },	// 'V'
+	{   27,  0,  0,  5,  6, 0 },	// 'W'
+	{   31,  0,  0,  5,  6, 0 },	// 'X'
+	{   35,  0,  0,  5,  6, 0 },	// 'Y'
+	{   39,  1,  0,  4,  6, 0 },	// 'Z'
+	{   42,  2,  0,  2,  7, 0 },	// '['
+	{   44,  0,  0,  4,  7, 0 },	// '\'
+	{   48,  1,  0,  2,  7, 0 },	// ']'
+	{   50,  1,  0,  3,  3, 0 },	// '^'
+	{   52,  0,  7,  5,  1, 0 },	// '_'
+	{    0,  2,  0,  2,  2, 0 },	// '`'
+	{    1,  1,  2,  4,  4, 0 },	// 'a'
+	{    3,  0,  0,  5,  6, 0 },	// 'b'
+	{    7,  1,  2,  3,  4, 0 },	// 'c'
+	{    9,  1,  0,  4,  6, 0 },	// 'd'
+	{   12,  1,  2,  3,  4, 0 },	// 'e'
+	{   14,  1,  0,  3,  6, 0 },	// 'f'
+	{   17,  1,  2,  4,  6, 0 },	// 'g'
+	{   20,  0,  0,  5,  6, 0 },	// 'h'
+	{   24,  1,  0,  3,  6, 0 },	// 'i'
+	{   27,  1,  0,  3,  8, 0 },	// 'j'
+	{   30,  0,  0,  5,  6, 0 },	// 'k'
+	{   34,  1,  0,  3,  6, 0 },	// 'l'
+	{   37,  0,  2,  5,  4, 0 },	// 'm'
+	{   40,  0,  2,  5,  4, 0 },	// 'n'
+	{   43,  1,  2,  4,  4, 0 },	// 'o'
+	{    0,  0,  2,  5,  6, 0 },	// 'p'
+	{    4,  1,  2,  4,  6, 0 },	// 'q'
+	{    7,  1,  2,  4,  4, 0 },	// 'r'
+	{    9,  1,  2,  3,  4, 0 },	// 's'
+	{   11,  0,  1,  5,  5, 0 },	// 't'
+	{   15,  0,  2,  5,  4, 0 },	// 'u'
+	{   18,  0,  2,  5,  4, 0 },	// 'v'
+	{   21,  0,  2,  5,  4, 0 },	// 'w'
+	{   24,  1,  2,  4,  4, 0 },	// 'x'
+	{   26,  0,  2,  5,  6, 0 },	// 'y'
+	{   30,  1,  2,  4,  4, 0 },	// 'z'
+	{   32,  1,  0,  3,  7, 0 },	// '{'
+	{   35,  2,  0,  1,  7, 0 },	// '|'
+	{   36,  1,  0,  3,  7, 0 },	// '}'
+	{   39,  1,  3,  4,  2, 0 },	// '~'
+};
+
+static const uint16_t Font8_Base [] = { 0, 34, 78, 137, 190, 235 };
+
+static const PFONT Font8_Packed = { Font8_Glyphs, Font8_Base, Font8_Data };
+
+sFONT Font8 = {
+  NULL,
+  5, /* Width */
+  8, /* Height */
+  &Font8_Packed,
+  0,
+};
+
+// Same glyphs, advancing by the glyph width
+sFONT Font8P = {
+  NULL,
+  5, /* Width */
+  8, /* Height */
+  &Font8_Packed,
+  1,
+};
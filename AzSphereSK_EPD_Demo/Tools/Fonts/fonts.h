@@ -51,12 +51,40 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
-//ASCII
+//ASCII, glyphs FONT_FIRST_CHAR .. FONT_LAST_CHAR
+#define FONT_FIRST_CHAR         ' '
+#define FONT_LAST_CHAR          '~'
+#define FONT_GLYPHS             (FONT_LAST_CHAR - FONT_FIRST_CHAR + 1)
+#define FONT_MAX_ROWS           24      // Highest sFONT, rows of a decoded glyph (up to 31 columns)
+
+//Packed glyph (Tools/FontPack) : the box of its ink inside the Width x Height cell,
+//W x H bits MSB first without row padding, or runs of background / ink in nibbles if Rle
+#define PFONT_BLOCK             16      // Glyphs sharing one PFONT.Base offset
+#define PFONT_SPACING           1       // Blank columns after a glyph in proportional text
+typedef struct
+{
+  uint32_t Offset : 11;                                 // From PFONT.Base[glyph / PFONT_BLOCK]
+  uint32_t X : 5;                                       // Box in the cell
+  uint32_t Y : 5;
+  uint32_t W : 5;                                       // Box size, 0 for a blank glyph
+  uint32_t H : 5;
+  uint32_t Rle : 1;
+} PFONT_GLYPH;
+
+typedef struct
+{
+  const PFONT_GLYPH *Glyphs;                            // FONT_GLYPHS of them
+  const uint16_t *Base;                                 // Data offset of every PFONT_BLOCK glyphs
+  const uint8_t *Data;
+} PFONT;
+
 typedef struct _tFont
 {    
-  const uint8_t *table;
+  const uint8_t *table;                                 // Plain table, NULL for a packed font
   uint16_t Width;
   uint16_t Height;
+  const PFONT *Packed;                                  // Packed glyphs, used when set
+  uint8_t Proportional;                                 // Advance by the glyph width (packed fonts only)
   
 } sFONT;
 
@@ -69,6 +97,16 @@ typedef struct                                          // 
 }CH_CN;
 
 
+//cFONT.Encoding, what CH_CN.index holds and how Paint_DrawString_CN reads the string
+#define CN_FONT_GB2312          0       // GB2312 bytes, ASCII as { c, 0 }
+#define CN_FONT_UNICODE         1       // Code point high byte first (BMP), the string is UTF-8
+
+//cFONT.IndexState, set on the first lookup
+#define CN_INDEX_NONE           0       // Not looked at yet
+#define CN_INDEX_SORTED         1       // table is sorted by index, searched directly
+#define CN_INDEX_BUILT          2       // Index holds the entries in index order
+#define CN_INDEX_LINEAR         3       // No room for an index, scanned
+
 typedef struct
 {    
   const CH_CN *table;
@@ -76,6 +114,9 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  uint8_t Encoding;                                     // CN_FONT_xxx
+  uint8_t IndexState;                                   // CN_INDEX_xxx, runtime
+  const uint16_t *Index;                                // Runtime, with CN_INDEX_BUILT
   
 }cFONT;
 
@@ -85,6 +126,13 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+//Proportional variants, in the packed fonts (fontNNp.c) only
+extern sFONT Font24P;
+extern sFONT Font20P;
+extern sFONT Font16P;
+extern sFONT Font12P;
+extern sFONT Font8P;
+
 extern cFONT Font12CN;
 extern cFONT Font24CN;
 #ifdef __cplusplus
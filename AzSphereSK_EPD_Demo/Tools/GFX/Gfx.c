@@ -9,10 +9,26 @@
 *   Achieve time display: adaptive size display time minutes and seconds
 *   Modified this lib for use with AzSphere Modules/ SKs by GS Gill (gsgill.github.io)
 *----------------
-* |	This version:   V3.0
-* | Date        :   2019-04-18
+* |	This version:   V3.1
+* | Date        :   2026-10-19
 * | Info        :
 * -----------------------------------------------------------------------------
+* V3.1(2026-10-19):
+* 1.add: Paint_SetLayout(), PAINT_LAYOUT_NATIVE keeps the image row-major in
+*    the drawing orientation, rotation is done by EPD_Display_Rotated_2in9()
+* 2.add: Paint_MapPoint(), drawing point to memory position
+* 3.Change: Paint_ClearWindows() fills whole bytes when memory rows follow drawing rows
+* 4.Change: Out of range drawing calls log through the deferred, rate limited LOG_WARN
+* 5.add: Paint_SetBand(), Paint_GetRow(), the image memory can hold a band of rows
+*    only, drawing outside the band is dropped (band rendering, see EPD_Band.c)
+* 6.add: Packed fonts (fonts.h PFONT, Tools/FontPack), decoded through a small glyph
+*    cache in the arena, Paint_DrawString_EN advances by the glyph width for
+*    proportional fonts
+* 7.Change: Paint_DrawString_CN() finds glyphs by binary search (sorted table or
+*    an index built in the arena), reads UTF-8 for CN_FONT_UNICODE fonts and
+*    draws '?' for missing glyphs
+*
+* -----------------------------------------------------------------------------
 * V3.0(2019-04-18):
 * 1.Change: 
 *    Paint_DrawPoint(..., DOT_STYLE DOT_STYLE)
@@ -69,6 +85,9 @@
 #include <string.h> //memset()
 #include <math.h>
 
+#include "../Log/Log.h"
+#include "../Arena/Arena.h"
+
 PAINT Paint;
 
 /******************************************************************************
@@ -91,11 +110,15 @@ void Paint_NewImage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Ro
 		
     Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
     Paint.HeightByte = Height;    
+    Paint.BandStart = 0;
+    Paint.BandRows = Height;
 //    //printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
 //    //printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
+ 
     Paint.Rotate = Rotate;
     Paint.Mirror = MIRROR_NONE;
+    Paint.Layout = PAINT_LAYOUT_PANEL;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
         Paint.Width = Width;
@@ -162,62 +185,159 @@ void Paint_SetMirroring(uint8_t mirror)
 }
 
 /******************************************************************************
-function: Draw Pixels
+function: Select the memory layout of the image, call after Paint_NewImage()
+parameter:
+    layout : PAINT_LAYOUT_PANEL  -> memory in panel order (default)
+             PAINT_LAYOUT_NATIVE -> memory row-major in the drawing orientation,
+                                    horizontal spans become contiguous bytes
+info:
+    The memory size is the same for both layouts. A NATIVE image has to be
+    uploaded with EPD_Display_Rotated_2in9(fd, image, Paint.Rotate, Paint.Mirror)
+******************************************************************************/
+void Paint_SetLayout(uint8_t layout)
+{
+    uint16_t Width, Height;
+
+    if(layout == PAINT_LAYOUT_NATIVE) {
+        Width = Paint.Width;
+        Height = Paint.Height;
+    } else if(layout == PAINT_LAYOUT_PANEL) {
+        Width = (Paint.Rotate == ROTATE_0 || Paint.Rotate == ROTATE_180)? Paint.Width: Paint.Height;
+        Height = (Paint.Rotate == ROTATE_0 || Paint.Rotate == ROTATE_180)? Paint.Height: Paint.Width;
+    } else {
+        Log_Debug("layout should be PAINT_LAYOUT_PANEL or PAINT_LAYOUT_NATIVE\r\n");
+        return;
+    }
+
+    Paint.Layout = layout;
+    Paint.WidthMemory = Width;
+    Paint.HeightMemory = Height;
+    Paint.HeightByte = Height;
+    Paint.BandStart = 0;
+    Paint.BandRows = Height;
+    if(Paint.Scale == 4)
+        Paint.WidthByte = (Width % 4 == 0)? (Width / 4 ): (Width / 4 + 1);
+    else
+        Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
+}
+
+/******************************************************************************
+function: Makes the image memory hold only a band of memory rows, call after
+          Paint_NewImage() / Paint_SetLayout()
+parameter:
+    Ystart : First memory row held by the image
+    Rows   : No of rows held, the image is Rows x WidthByte bytes
+info:
+    Drawing calls stay in full image coordinates, pixels outside the band
+    are dropped. Drawing the same calls once per band renders the whole
+    image through a small buffer. Paint_SetBand(0, Paint.HeightMemory)
+    goes back to a full image.
+******************************************************************************/
+void Paint_SetBand(uint16_t Ystart, uint16_t Rows)
+{
+    if(Rows == 0 || Ystart + Rows > Paint.HeightMemory) {
+        Log_Debug("ERROR : Paint_SetBand : Band %d + %d exceeds the image height %d\n", Ystart, Rows, Paint.HeightMemory);
+        return;
+    }
+    Paint.BandStart = Ystart;
+    Paint.BandRows = Rows;
+}
+
+/******************************************************************************
+function: Memory row of the image, for functions writing whole bytes
+parameter:
+    Y : Memory row, as given by Paint_MapPoint
+return:
+    First byte of the row, NULL if the row is outside the band
+******************************************************************************/
+uint8_t *Paint_GetRow(uint16_t Y)
+{
+    if(Y < Paint.BandStart || Y >= Paint.BandStart + Paint.BandRows)
+        return NULL;
+    return &Paint.Image[(uint32_t)(Y - Paint.BandStart) * Paint.WidthByte];
+}
+
+/******************************************************************************
+function: Maps a drawing point to its position in the image memory
 parameter:
     Xpoint : At point X
     Ypoint : At point Y
-    Color  : Painted colors
+    X, Y   : Memory position of the point
+return:
+    1 if the point lies in the image memory, else 0
 ******************************************************************************/
-void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
+uint8_t Paint_MapPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t *X, uint16_t *Y)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
-        Log_Debug("Exceeding display boundaries\r\n");
-        return;
-    }      
-    uint16_t X, Y;
+    if(Paint.Layout == PAINT_LAYOUT_NATIVE) {
+        // Rotation and mirroring are done by the driver at upload time
+        *X = Xpoint;
+        *Y = Ypoint;
+        return (Xpoint < Paint.WidthMemory && Ypoint < Paint.HeightMemory);
+    }
 
     switch(Paint.Rotate) {
     case 0:
-        X = Xpoint;
-        Y = Ypoint;  
+        *X = Xpoint;
+        *Y = Ypoint;  
         break;
     case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
+        *X = Paint.WidthMemory - Ypoint - 1;
+        *Y = Xpoint;
         break;
     case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
+        *X = Paint.WidthMemory - Xpoint - 1;
+        *Y = Paint.HeightMemory - Ypoint - 1;
         break;
     case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
+        *X = Ypoint;
+        *Y = Paint.HeightMemory - Xpoint - 1;
         break;
     default:
-        return;
+        return 0;
     }
     
     switch(Paint.Mirror) {
     case MIRROR_NONE:
         break;
     case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
+        *X = Paint.WidthMemory - *X - 1;
         break;
     case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
+        *Y = Paint.HeightMemory - *Y - 1;
         break;
     case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
+        *X = Paint.WidthMemory - *X - 1;
+        *Y = Paint.HeightMemory - *Y - 1;
         break;
     default:
-        return;
+        return 0;
     }
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        Log_Debug("Exceeding display boundaries\r\n");
+    return (*X < Paint.WidthMemory && *Y < Paint.HeightMemory);
+}
+
+/******************************************************************************
+function: Draw Pixels
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+******************************************************************************/
+void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
+{
+    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
+        LOG_WARN("Paint_SetPixel : (%d, %d) exceeds display boundaries", Xpoint, Ypoint);
+        return;
+    }      
+    uint16_t X, Y;
+
+    if(!Paint_MapPoint(Xpoint, Ypoint, &X, &Y)){
+        LOG_WARN("Paint_SetPixel : (%d, %d) exceeds display boundaries", Xpoint, Ypoint);
         return;
     }
+    if(Y < Paint.BandStart || Y >= Paint.BandStart + Paint.BandRows)
+        return;     // Drawn by another band
+    Y -= Paint.BandStart;
     
     if(Paint.Scale == 2){
         uint32_t Addr = X / 8 + Y * Paint.WidthByte;
@@ -237,13 +357,13 @@ void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color)
 }
 
 /******************************************************************************
-function: Clear the color of the picture
+function: Clear the color of the picture (of the band)
 parameter:
     Color : Painted colors
 ******************************************************************************/
 void Paint_Clear(uint16_t Color)
 {
-    for (uint16_t Y = 0; Y < Paint.HeightByte; Y++) {
+    for (uint16_t Y = 0; Y < Paint.BandRows; Y++) {
         for (uint16_t X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
             uint32_t Addr = X + Y*Paint.WidthByte;
             Paint.Image[Addr] = Color;
@@ -263,6 +383,40 @@ parameter:
 void Paint_ClearWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t Color)
 {
     uint16_t X, Y;
+
+    // Memory rows follow the drawing rows, so each row of the window is a contiguous span of bits
+    if (Paint.Scale == 2 && (Paint.Layout == PAINT_LAYOUT_NATIVE || Paint.Rotate == ROTATE_0 || Paint.Rotate == ROTATE_180)) {
+        if (Xend > Paint.Width) Xend = Paint.Width;
+        if (Yend > Paint.Height) Yend = Paint.Height;
+        if (Xstart >= Xend || Ystart >= Yend)
+            return;
+
+        uint8_t Fill = (Color == BLACK)? 0x00: 0xFF;
+        for (Y = Ystart; Y < Yend; Y++) {
+            uint16_t Xs, Xe, Ys, Ye;
+            Paint_MapPoint(Xstart, Y, &Xs, &Ys);
+            Paint_MapPoint(Xend - 1, Y, &Xe, &Ye);
+            if (Xs > Xe) {      // Mirrored or 180 degree, the span runs backwards in memory
+                uint16_t T = Xs; Xs = Xe; Xe = T;
+            }
+
+            uint8_t *Row = Paint_GetRow(Ys);
+            if (Row == NULL)
+                continue;
+            uint16_t Bs = Xs / 8, Be = Xe / 8;
+            uint8_t Ms = 0xFF >> (Xs % 8), Me = 0xFF << (7 - Xe % 8);
+            if (Bs == Be) {
+                Ms &= Me;
+                Row[Bs] = (Row[Bs] & ~Ms) | (Fill & Ms);
+            } else {
+                Row[Bs] = (Row[Bs] & ~Ms) | (Fill & Ms);
+                memset(&Row[Bs + 1], Fill, Be - Bs - 1);
+                Row[Be] = (Row[Be] & ~Me) | (Fill & Me);
+            }
+        }
+        return;
+    }
+
     for (Y = Ystart; Y < Yend; Y++) {
         for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
             Paint_SetPixel(X, Y, Color);
@@ -283,9 +437,7 @@ void Paint_DrawPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color,
                      DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
 {
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Log_Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
-				//printf("Xpoint = %d , Paint.Width = %d  \r\n ",Xpoint,Paint.Width);
-				//printf("Ypoint = %d , Paint.Height = %d  \r\n ",Ypoint,Paint.Height);
+        LOG_WARN("Paint_DrawPoint : (%d, %d) exceeds the display range %d x %d", Xpoint, Ypoint, Paint.Width, Paint.Height);
         return;
     }
 
@@ -324,7 +476,7 @@ void Paint_DrawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Ye
 {
     if (Xstart > Paint.Width || Ystart > Paint.Height ||
         Xend > Paint.Width || Yend > Paint.Height) {
-        Log_Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
+        LOG_WARN("Paint_DrawLine : input exceeds the normal display range");
         return;
     }
 
@@ -382,7 +534,7 @@ void Paint_DrawRectangle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16
 {
     if (Xstart > Paint.Width || Ystart > Paint.Height ||
         Xend > Paint.Width || Yend > Paint.Height) {
-        Log_Debug("Input exceeds the normal display range\r\n");
+        LOG_WARN("Paint_DrawRectangle : input exceeds the normal display range");
         return;
     }
 
@@ -414,7 +566,7 @@ void Paint_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius,
                       uint16_t Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
     if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
-        Log_Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
+        LOG_WARN("Paint_DrawCircle : (%d, %d) exceeds the normal display range", X_Center, Y_Center);
         return;
     }
 
@@ -469,6 +621,158 @@ void Paint_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius,
     }
 }
 
+/******************************************************************************
+Packed glyphs are decoded to one 32 bit row mask per box row (bit 31 is the
+left column of the box) and kept in a direct mapped cache, text mostly reuses
+a few glyphs.
+******************************************************************************/
+#ifndef PAINT_GLYPH_CACHE
+#define PAINT_GLYPH_CACHE   16      // Decoded glyphs kept, a power of two
+#endif
+
+typedef struct {
+    const PFONT *Font;              // NULL for an empty entry
+    uint8_t Glyph;
+    uint32_t Rows[FONT_MAX_ROWS];
+} PAINT_GLYPH;
+
+static PAINT_GLYPH *GlyphCache;     // PAINT_GLYPH_CACHE entries in the arena
+
+/******************************************************************************
+function: Decode a packed glyph
+parameter:
+    Font  : Packed font
+    Glyph : Glyph number, from FONT_FIRST_CHAR
+    Rows  : Row masks of its box
+******************************************************************************/
+static void Paint_DecodeGlyph(const PFONT *Font, uint8_t Glyph, uint32_t *Rows)
+{
+    const PFONT_GLYPH *G = &Font->Glyphs[Glyph];
+    const uint8_t *Data = &Font->Data[Font->Base[Glyph / PFONT_BLOCK] + G->Offset];
+    uint32_t Total = G->W * G->H;
+    uint32_t i = 0;
+
+    memset(Rows, 0, sizeof(uint32_t) * FONT_MAX_ROWS);
+    if (!G->Rle) {
+        for (; i < Total; i++) {
+            if (Data[i >> 3] & (0x80 >> (i & 7)))
+                Rows[i / G->W] |= 0x80000000u >> (i % G->W);
+        }
+        return;
+    }
+
+    //Runs of background and ink, a nibble of 15 continues the run
+    uint32_t Nibble = 0;
+    uint8_t Ink = 0;
+    while (i < Total) {
+        uint32_t Run = 0, Value;
+        do {
+            Value = (Data[Nibble >> 1] >> ((Nibble & 1) ? 0 : 4)) & 0x0F;
+            Nibble++;
+            Run += Value;
+        } while (Value == 15);
+        if (Run > Total - i)
+            Run = Total - i;
+        if (Ink) {
+            for (uint32_t End = i + Run; i < End; i++)
+                Rows[i / G->W] |= 0x80000000u >> (i % G->W);
+        } else {
+            i += Run;
+        }
+        Ink ^= 1;
+    }
+}
+
+/******************************************************************************
+function: Row masks of a packed glyph, from the cache or decoded into it
+parameter:
+    Font    : Packed font
+    Glyph   : Glyph number, from FONT_FIRST_CHAR
+    Scratch : Used when the arena had no room for the cache
+******************************************************************************/
+static const uint32_t *Paint_GetGlyph(const PFONT *Font, uint8_t Glyph, PAINT_GLYPH *Scratch)
+{
+    if (GlyphCache == NULL) {
+        GlyphCache = Arena_Alloc_Lifetime(ARENA_CACHE, sizeof(PAINT_GLYPH) * PAINT_GLYPH_CACHE);
+        if (GlyphCache != NULL) {
+            memset(GlyphCache, 0, sizeof(PAINT_GLYPH) * PAINT_GLYPH_CACHE);
+        } else {
+            LOG_WARN("Paint_GetGlyph : No room for the glyph cache, decoding every glyph");
+        }
+    }
+    PAINT_GLYPH *Entry = Scratch;
+    if (GlyphCache != NULL) {
+        Entry = &GlyphCache[(Glyph ^ ((uintptr_t)Font >> 4)) & (PAINT_GLYPH_CACHE - 1)];
+        if (Entry->Font == Font && Entry->Glyph == Glyph)
+            return Entry->Rows;
+    }
+    Paint_DecodeGlyph(Font, Glyph, Entry->Rows);
+    Entry->Font = Font;
+    Entry->Glyph = Glyph;
+    return Entry->Rows;
+}
+
+/******************************************************************************
+function: Advance of a character
+parameter:
+    Acsii_Char : The character
+    Font       : A structure pointer that displays a character size
+info:
+    Font->Width unless the font is packed and proportional, then the glyph
+    width and PFONT_SPACING (half a cell for a blank glyph)
+******************************************************************************/
+uint16_t Paint_CharWidth(const char Acsii_Char, sFONT* Font)
+{
+    uint8_t Glyph = (uint8_t)(Acsii_Char - FONT_FIRST_CHAR);
+
+    if (Font->Packed == NULL || !Font->Proportional)
+        return Font->Width;
+    if (Glyph >= FONT_GLYPHS || Font->Packed->Glyphs[Glyph].W == 0)
+        return (Font->Width + 1) / 2;
+    return Font->Packed->Glyphs[Glyph].W + PFONT_SPACING;
+}
+
+/******************************************************************************
+function: Show a character of a packed font, only the box of the glyph is
+          scanned when the background is transparent
+******************************************************************************/
+static void Paint_DrawChar_Packed(uint16_t Xpoint, uint16_t Ypoint, const char Acsii_Char,
+                                  sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    uint8_t Glyph = (uint8_t)(Acsii_Char - FONT_FIRST_CHAR);
+    PAINT_GLYPH Scratch;
+
+    if (Glyph >= FONT_GLYPHS)
+        Glyph = 0;      //Blank
+    const PFONT_GLYPH *G = &Font->Packed->Glyphs[Glyph];
+    const uint32_t *Rows = Paint_GetGlyph(Font->Packed, Glyph, &Scratch);
+    uint16_t Left = Font->Proportional ? 0 : G->X;      //Proportional text drops the left bearing
+
+    if (FONT_BACKGROUND == Color_Background) {
+        for (uint16_t Page = 0; Page < G->H; Page++) {
+            uint32_t Bits = Rows[Page];
+            while (Bits) {
+                uint16_t Column = __builtin_clz(Bits);
+                Paint_SetPixel(Xpoint + Left + Column, Ypoint + G->Y + Page, Color_Foreground);
+                Bits &= ~(0x80000000u >> Column);
+            }
+        }
+        return;
+    }
+
+    //Whole cell, as wide as the advance
+    uint16_t Width = Paint_CharWidth(Acsii_Char, Font);
+    for (uint16_t Page = 0; Page < Font->Height; Page++) {
+        uint32_t Bits = 0;
+        if (Page >= G->Y && Page < G->Y + G->H)
+            Bits = Rows[Page - G->Y];
+        for (uint16_t Column = 0; Column < Width; Column++) {
+            uint8_t Ink = Column >= Left && Column < Left + G->W && (Bits & (0x80000000u >> (Column - Left)));
+            Paint_SetPixel(Xpoint + Column, Ypoint + Page, Ink ? Color_Foreground : Color_Background);
+        }
+    }
+}
+
 /******************************************************************************
 function: Show English characters
 parameter:
@@ -485,7 +789,12 @@ void Paint_DrawChar(uint16_t Xpoint, uint16_t Ypoint, const char Acsii_Char,
     uint16_t Page, Column;
 
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Log_Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
+        LOG_WARN("Paint_DrawChar : (%d, %d) exceeds the normal display range", Xpoint, Ypoint);
+        return;
+    }
+
+    if (Font->Packed != NULL) {
+        Paint_DrawChar_Packed(Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
         return;
     }
 
@@ -535,13 +844,15 @@ void Paint_DrawString_EN(uint16_t Xstart, uint16_t Ystart, const char * pString,
     uint16_t Ypoint = Ystart;
 
     if (Xstart > Paint.Width || Ystart > Paint.Height) {
-        Log_Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
+        LOG_WARN("Paint_DrawString_EN : (%d, %d) exceeds the normal display range", Xstart, Ystart);
         return;
     }
 
     while (* pString != '\0') {
+        uint16_t Advance = Paint_CharWidth(* pString, Font);
+
         //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width ) > Paint.Width ) {
+        if ((Xpoint + Advance ) > Paint.Width ) {
             Xpoint = Xstart;
             Ypoint += Font->Height;
         }
@@ -557,104 +868,222 @@ void Paint_DrawString_EN(uint16_t Xstart, uint16_t Ystart, const char * pString,
         pString ++;
 
         //The next word of the abscissa increases the font of the broadband
-        Xpoint += Font->Width;
+        Xpoint += Advance;
     }
 }
 
 
+/******************************************************************************
+Chinese fonts are looked up by binary search on the 16 bit CH_CN.index, over
+the table itself when it is sorted or else over an index of entry numbers
+built in the arena on the first use of the font.
+******************************************************************************/
+#define CN_KEY(Entry)   ((uint16_t)(((Entry)->index[0] << 8) | (Entry)->index[1]))
+
+/******************************************************************************
+function: Look at the table of a font the first time it is used
+parameter:
+    font : Chinese font
+******************************************************************************/
+static void Paint_CN_Index(cFONT* font)
+{
+    uint16_t Num;
+
+    font->IndexState = CN_INDEX_SORTED;
+    for (Num = 1; Num < font->size; Num++) {
+        if (CN_KEY(&font->table[Num - 1]) > CN_KEY(&font->table[Num])) {
+            font->IndexState = CN_INDEX_BUILT;
+            break;
+        }
+    }
+    if (font->IndexState == CN_INDEX_SORTED)
+        return;
+
+    uint16_t *Index = Arena_Alloc_Lifetime(ARENA_CACHE, sizeof(uint16_t) * font->size);
+    if (Index == NULL) {
+        LOG_WARN("Paint_DrawString_CN : No room for the index of %u glyphs, scanning", font->size);
+        font->IndexState = CN_INDEX_LINEAR;
+        return;
+    }
+    //Shell sort, equal keys keep the table order so the first entry wins as before
+    for (Num = 0; Num < font->size; Num++)
+        Index[Num] = Num;
+    for (uint16_t Gap = font->size / 2; Gap > 0; Gap /= 2) {
+        for (uint16_t i = Gap; i < font->size; i++) {
+            uint16_t Entry = Index[i];
+            uint16_t Key = CN_KEY(&font->table[Entry]);
+            uint16_t j = i;
+            while (j >= Gap && (CN_KEY(&font->table[Index[j - Gap]]) > Key ||
+                                (CN_KEY(&font->table[Index[j - Gap]]) == Key && Index[j - Gap] > Entry))) {
+                Index[j] = Index[j - Gap];
+                j -= Gap;
+            }
+            Index[j] = Entry;
+        }
+    }
+    font->Index = Index;
+}
+
+/******************************************************************************
+function: Find a glyph
+parameter:
+    font : Chinese font
+    Key  : CH_CN.index of the glyph, high byte first
+return: The entry, NULL if the font has none
+******************************************************************************/
+static const CH_CN *Paint_CN_Find(cFONT* font, uint16_t Key)
+{
+    uint16_t Low = 0, High = font->size;
+
+    if (font->IndexState == CN_INDEX_NONE)
+        Paint_CN_Index(font);
+
+    if (font->IndexState == CN_INDEX_LINEAR) {
+        for (uint16_t Num = 0; Num < font->size; Num++) {
+            if (CN_KEY(&font->table[Num]) == Key)
+                return &font->table[Num];
+        }
+        return NULL;
+    }
+
+    //First entry with a key not below Key
+    while (Low < High) {
+        uint16_t Mid = Low + (High - Low) / 2;
+        uint16_t Num = (font->IndexState == CN_INDEX_BUILT) ? font->Index[Mid] : Mid;
+        if (CN_KEY(&font->table[Num]) < Key)
+            Low = Mid + 1;
+        else
+            High = Mid;
+    }
+    if (Low == font->size)
+        return NULL;
+    const CH_CN *Entry = &font->table[(font->IndexState == CN_INDEX_BUILT) ? font->Index[Low] : Low];
+    return (CN_KEY(Entry) == Key) ? Entry : NULL;
+}
+
+/******************************************************************************
+function: Decode the next character of a UTF-8 string
+parameter:
+    pText : The string, moved past the character
+return: Code point, 0xFFFD for a malformed sequence (one byte is skipped)
+******************************************************************************/
+static uint32_t Paint_Utf8_Next(const uint8_t **pText)
+{
+    const uint8_t *p = *pText;
+    uint32_t Code;
+    uint8_t More;
+
+    if (p[0] < 0x80) {
+        *pText = p + 1;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        Code = p[0] & 0x1F;
+        More = 1;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        Code = p[0] & 0x0F;
+        More = 2;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        Code = p[0] & 0x07;
+        More = 3;
+    } else {
+        *pText = p + 1;
+        return 0xFFFD;
+    }
+    for (uint8_t i = 1; i <= More; i++) {
+        if ((p[i] & 0xC0) != 0x80) {        //Also stops at the terminating 0
+            *pText = p + 1;
+            return 0xFFFD;
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    *pText = p + 1 + More;
+    //Overlong forms and surrogates
+    if (Code < ((More == 1) ? 0x80u : (More == 2) ? 0x800u : 0x10000u) || (Code >= 0xD800 && Code <= 0xDFFF))
+        return 0xFFFD;
+    return Code;
+}
+
+/******************************************************************************
+function: Show a glyph of a Chinese font
+******************************************************************************/
+static void Paint_DrawGlyph_CN(int x, int y, const CH_CN *Entry, cFONT* font,
+                               uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    const char* ptr = &Entry->matrix[0];
+    int i, j;
+
+    for (j = 0; j < font->Height; j++) {
+        for (i = 0; i < font->Width; i++) {
+            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
+                if (*ptr & (0x80 >> (i % 8))) {
+                    Paint_SetPixel(x + i, y + j, Color_Foreground);
+                }
+            } else {
+                if (*ptr & (0x80 >> (i % 8))) {
+                    Paint_SetPixel(x + i, y + j, Color_Foreground);
+                } else {
+                    Paint_SetPixel(x + i, y + j, Color_Background);
+                }
+            }
+            if (i % 8 == 7) {
+                ptr++;
+            }
+        }
+        if (font->Width % 8 != 0) {
+            ptr++;
+        }
+    }
+}
+
 /******************************************************************************
 function: Display the string
 parameter:
     Xstart  ：X coordinate
     Ystart  ：Y coordinate
     pString ：The first address of the Chinese string and English
-              string to be displayed
+              string to be displayed, GB2312 or UTF-8 as font->Encoding
     Font    ：A structure pointer that displays a character size
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
+info:
+    A character the font has no glyph for is drawn as '?' if the font has
+    that, else its cell is left as it is
 ******************************************************************************/
 void Paint_DrawString_CN(uint16_t Xstart, uint16_t Ystart, const char * pString, cFONT* font,
                         uint16_t Color_Foreground, uint16_t Color_Background)
 {
-    const char* p_text = pString;
+    const uint8_t* p_text = (const uint8_t*)pString;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
 
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
+        uint8_t Ascii;
+        uint16_t Key;
+
+        if (font->Encoding == CN_FONT_UNICODE) {
+            uint32_t Code = Paint_Utf8_Next(&p_text);
+            Ascii = Code < 0x80;
+            Key = (Code <= 0xFFFF) ? (uint16_t)Code : 0xFFFD;
+        } else if (*p_text < 0x80) {
+            Ascii = 1;
+            Key = (uint16_t)(*p_text << 8);
             p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if((*p_text== font->table[Num].index[0]) && (*(p_text+1) == font->table[Num].index[1])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
-            }
-            /* Point on the next character */
+        } else {
+            if (p_text[1] == 0)
+                break;      //Cut in half
+            Ascii = 0;
+            Key = (uint16_t)((p_text[0] << 8) | p_text[1]);
             p_text += 2;
-            /* Decrement the column position by 16 */
-            x += font->Width;
         }
+
+        const CH_CN *Entry = Paint_CN_Find(font, Key);
+        if (Entry == NULL)
+            Entry = Paint_CN_Find(font, (font->Encoding == CN_FONT_UNICODE) ? '?' : ('?' << 8));
+        if (Entry != NULL)
+            Paint_DrawGlyph_CN(x, y, Entry, font, Color_Foreground, Color_Background);
+
+        /* Decrement the column position by 16 */
+        x += Ascii ? font->ASCII_Width : font->Width;
     }
 }
 
@@ -678,7 +1107,7 @@ void Paint_DrawNum(uint16_t Xpoint, uint16_t Ypoint, int32_t Nummber,
     uint8_t *pStr = Str_Array;
 
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Log_Debug("Paint_DisNum Input exceeds the normal display range\r\n");
+        LOG_WARN("Paint_DisNum : (%d, %d) exceeds the normal display range", Xpoint, Ypoint);
         return;
     }
 
@@ -735,13 +1164,15 @@ parameter:
 info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
+    Only the rows of the band are copied.
 ******************************************************************************/
 void Paint_DrawBitMap(const unsigned char* image_buffer)
 {
     uint16_t x, y;
     uint32_t Addr = 0;
 
-    for (y = 0; y < Paint.HeightByte; y++) {
+    image_buffer += (uint32_t)Paint.BandStart * Paint.WidthByte;
+    for (y = 0; y < Paint.BandRows; y++) {
         for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
             Addr = x + y * Paint.WidthByte;
             Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
@@ -829,7 +1260,8 @@ void Paint_DrawBitMap_Block(const unsigned char* image_buffer, uint8_t Region)
 {
     uint16_t x, y;
     uint32_t Addr = 0;
-		for (y = 0; y < Paint.HeightByte; y++) {
+		image_buffer += (uint32_t)Paint.BandStart * Paint.WidthByte;
+		for (y = 0; y < Paint.BandRows; y++) {
 				for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
 						Addr = x + y * Paint.WidthByte ;
 						Paint.Image[Addr] = \
@@ -95,6 +95,9 @@ typedef struct {
     uint16_t WidthByte;
     uint16_t HeightByte;
     uint16_t Scale;
+    uint16_t Layout;
+    uint16_t BandStart;     // First memory row held by Image, see Paint_SetBand()
+    uint16_t BandRows;      // Memory rows held by Image, HeightMemory for a full image
 } PAINT;
 extern PAINT Paint;
 
@@ -106,6 +109,15 @@ extern PAINT Paint;
 #define ROTATE_180          180
 #define ROTATE_270          270
 
+/**
+ * Memory layout of the image
+ * PANEL  : memory is in the panel order, rotation and mirroring are applied to every pixel
+ * NATIVE : memory is row-major in the rotated (drawing) orientation, rotation and mirroring 
+ *          are applied once by the driver while uploading (see EPD_Display_Rotated_2in9)
+**/
+#define PAINT_LAYOUT_PANEL  0
+#define PAINT_LAYOUT_NATIVE 1
+
 /**
  * Display Flip
 **/
@@ -193,6 +205,10 @@ void Paint_SetRotate(uint16_t Rotate);
 void Paint_SetMirroring(uint8_t mirror);
 void Paint_SetPixel(uint16_t Xpoint, uint16_t Ypoint, uint16_t Color);
 void Paint_SetScale(uint8_t scale);
+void Paint_SetLayout(uint8_t layout);
+uint8_t Paint_MapPoint(uint16_t Xpoint, uint16_t Ypoint, uint16_t *X, uint16_t *Y);
+void Paint_SetBand(uint16_t Ystart, uint16_t Rows);
+uint8_t *Paint_GetRow(uint16_t Y);
 
 void Paint_Clear(uint16_t Color);
 void Paint_ClearWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t Color);
@@ -204,6 +220,7 @@ void Paint_DrawRectangle(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16
 void Paint_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uint16_t Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
 
 //Display string
+uint16_t Paint_CharWidth(const char Acsii_Char, sFONT* Font);
 void Paint_DrawChar(uint16_t Xstart, uint16_t Ystart, const char Acsii_Char, sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background);
 void Paint_DrawString_EN(uint16_t Xstart, uint16_t Ystart, const char * pString, sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background);
 void Paint_DrawString_CN(uint16_t Xstart, uint16_t Ystart, const char * pString, cFONT* font, uint16_t Color_Foreground, uint16_t Color_Background);
@@ -0,0 +1,180 @@
+/*****************************************************************************
+* | File      	:  	Log.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Deferred binary logging for hot paths (driver, interface, Gfx)
+* | Info        :   A log call stores its call site and integer arguments in a lock-free ring, the text
+*                   is only formatted by Log_Drain, off the hot path. Levels above LOG_LEVEL compile
+*                   to nothing and every call site is rate limited.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : LOG_ERROR / LOG_WARN / LOG_INFO / LOG_DEBUG, compile time level filter
+* 2. Added : Per call site rate limit, suppressed count reported with the next record
+* 3. Added : Lock-free multi producer ring of fixed size binary records, Log_Drain formats them
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../../HighLevelCore/applibs_versions.h"
+#include <applibs/log.h>
+
+#include "Log.h"
+
+#if (LOG_RING_SLOTS & (LOG_RING_SLOTS - 1)) != 0
+#error "LOG_RING_SLOTS must be a power of two"
+#endif
+
+// One record. Seq tells who owns the slot (bounded MPMC queue), it is kept relative to the
+// slot index so that the zero initialiazed ring is already empty :
+//   Seq == Pos - Index      free for the producer at Pos
+//   Seq == Pos - Index + 1  written, ready for the consumer at Pos
+typedef struct {
+    atomic_uint Seq;
+    const LOG_SITE *Site;
+    uint32_t TimeMs;
+    uint32_t Suppressed;
+    uint8_t Argc;
+    intptr_t Args[LOG_MAX_ARGS];
+} LOG_SLOT;
+
+static LOG_SLOT Ring[LOG_RING_SLOTS];
+static atomic_uint Head;		// Next slot to write
+static atomic_uint Tail;		// Next slot to drain
+static atomic_uint Dropped;
+
+static const char LevelTag[] = { '-', 'E', 'W', 'I', 'D' };
+
+static uint32_t Log_Now_Ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/******************************************************************************
+function    : Stores a record, never blocks. Called by the LOG_xxx macros.
+parameter   :
+       Site :   Call site
+       Args :   Integer arguments
+       Argc :   Argument count, more than LOG_MAX_ARGS are ignored
+******************************************************************************/
+void Log_Write(LOG_SITE *Site, const intptr_t *Args, uint8_t Argc) {
+    uint32_t now = Log_Now_Ms();
+    uint32_t pos;
+    LOG_SLOT *slot;
+    uint8_t i;
+
+    // Rate limit, a race between threads only blurs the counts
+    if (now - Site->WindowMs >= LOG_RATE_WINDOW_MS) {
+        Site->WindowMs = now;
+        Site->Burst = 0;
+    }
+    if (Site->Burst >= LOG_RATE_BURST) {
+        Site->Suppressed++;
+        return;
+    }
+    Site->Burst++;
+
+    // Claim a slot
+    pos = atomic_load_explicit(&Head, memory_order_relaxed);
+    for (;;) {
+        uint32_t index = pos & (LOG_RING_SLOTS - 1);
+        uint32_t seq;
+
+        slot = &Ring[index];
+        seq = atomic_load_explicit(&slot->Seq, memory_order_acquire);
+        if (seq == pos - index) {
+            if (atomic_compare_exchange_weak_explicit(&Head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if ((int32_t)(seq - (pos - index)) < 0) {
+            // Full, the drain is behind
+            atomic_fetch_add_explicit(&Dropped, 1, memory_order_relaxed);
+            Site->Suppressed++;
+            return;
+        } else {
+            pos = atomic_load_explicit(&Head, memory_order_relaxed);
+        }
+    }
+
+    if (Argc > LOG_MAX_ARGS) {
+        Argc = LOG_MAX_ARGS;
+    }
+    slot->Site = Site;
+    slot->TimeMs = now;
+    slot->Suppressed = Site->Suppressed;
+    Site->Suppressed = 0;
+    slot->Argc = Argc;
+    for (i = 0; i < Argc; i++) {
+        slot->Args[i] = Args[i];
+    }
+    atomic_store_explicit(&slot->Seq, pos - (pos & (LOG_RING_SLOTS - 1)) + 1, memory_order_release);
+}
+
+/******************************************************************************
+function    : Formats records through Log_Debug. Call it where time does not 
+              matter : between frames, from a timer, before sleeping.
+              One thread drains at a time.
+parameter   :
+       Max  :   Most records to format, 0 for all of them
+return      : Number of records formatted
+******************************************************************************/
+int Log_Drain(uint32_t Max) {
+    char text[160];
+    int n = 0;
+
+    while (Max == 0 || (uint32_t)n < Max) {
+        uint32_t pos = atomic_load_explicit(&Tail, memory_order_relaxed);
+        uint32_t index = pos & (LOG_RING_SLOTS - 1);
+        LOG_SLOT *slot = &Ring[index];
+        int a[LOG_MAX_ARGS] = { 0 };
+        uint8_t i;
+
+        if (atomic_load_explicit(&slot->Seq, memory_order_acquire) != pos - index + 1) {
+            break;
+        }
+        for (i = 0; i < slot->Argc; i++) {
+            a[i] = (int)slot->Args[i];
+        }
+        snprintf(text, sizeof(text), slot->Site->Fmt, a[0], a[1], a[2], a[3]);
+        if (slot->Suppressed != 0) {
+            Log_Debug("[%c %u] %s (+%u suppressed)\n", LevelTag[slot->Site->Level], slot->TimeMs, text, slot->Suppressed);
+        } else {
+            Log_Debug("[%c %u] %s\n", LevelTag[slot->Site->Level], slot->TimeMs, text);
+        }
+
+        atomic_store_explicit(&Tail, pos + 1, memory_order_relaxed);
+        atomic_store_explicit(&slot->Seq, pos - index + LOG_RING_SLOTS, memory_order_release);
+        n++;
+    }
+    return n;
+}
+
+/******************************************************************************
+function    : Records lost because the ring was full
+******************************************************************************/
+uint32_t Log_Dropped(void) {
+    return atomic_load_explicit(&Dropped, memory_order_relaxed);
+}
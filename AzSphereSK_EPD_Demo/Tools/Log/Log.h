@@ -0,0 +1,93 @@
+/*****************************************************************************
+* | File      	:  	Log.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Deferred binary logging for hot paths (driver, interface, Gfx)
+* | Info        :   A log call stores its call site and integer arguments in a lock-free ring, the text
+*                   is only formatted by Log_Drain, off the hot path. Levels above LOG_LEVEL compile
+*                   to nothing and every call site is rate limited.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : LOG_ERROR / LOG_WARN / LOG_INFO / LOG_DEBUG, compile time level filter
+* 2. Added : Per call site rate limit, suppressed count reported with the next record
+* 3. Added : Lock-free multi producer ring of fixed size binary records, Log_Drain formats them
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __LOG_H_
+#define __LOG_H_
+
+#include <stdint.h>
+
+// Levels, lower is more important
+#define LOG_LEVEL_NONE		0
+#define LOG_LEVEL_ERROR		1
+#define LOG_LEVEL_WARN		2
+#define LOG_LEVEL_INFO		3
+#define LOG_LEVEL_DEBUG		4
+
+// Calls above this level are compiled out, set it per build (-DLOG_LEVEL=4) or before including
+#ifndef LOG_LEVEL
+#define LOG_LEVEL			LOG_LEVEL_INFO
+#endif
+
+#define LOG_MAX_ARGS		4		// Integer arguments stored per record
+#ifndef LOG_RING_SLOTS
+#define LOG_RING_SLOTS		64		// Records in the ring, power of two
+#endif
+#ifndef LOG_RATE_BURST
+#define LOG_RATE_BURST		4		// Records per call site and window, the rest is counted
+#endif
+#ifndef LOG_RATE_WINDOW_MS
+#define LOG_RATE_WINDOW_MS	1000
+#endif
+
+// One log call site, a static made by the LOG_xxx macros
+typedef struct {
+    const char *Fmt;		// printf format, integer conversions only (%d %u %x)
+    uint8_t Level;
+    uint16_t Burst;			// Records of the current window
+    uint32_t WindowMs;		// Start of the current window
+    uint32_t Suppressed;	// Calls dropped by the rate limit, reported with the next record
+} LOG_SITE;
+
+void Log_Write(LOG_SITE *Site, const intptr_t *Args, uint8_t Argc);	// Used by the macros
+int Log_Drain(uint32_t Max);	// Formats up to Max records through Log_Debug, returns how many
+uint32_t Log_Dropped(void);		// Records lost on a full ring
+
+// Logs at Level with up to LOG_MAX_ARGS integer arguments. The format string must stay valid
+// (a literal), it is only read when the record is drained.
+#define LOG_AT(Level, Fmt, ...) do { \
+        if ((Level) <= LOG_LEVEL) { \
+            static LOG_SITE LogSite_ = { Fmt, Level, 0, 0, 0 }; \
+            const intptr_t LogArgs_[] = { 0, ##__VA_ARGS__ }; \
+            Log_Write(&LogSite_, &LogArgs_[1], (uint8_t)(sizeof(LogArgs_) / sizeof(LogArgs_[0]) - 1)); \
+        } \
+    } while (0)
+
+#define LOG_ERROR(Fmt, ...)	LOG_AT(LOG_LEVEL_ERROR, Fmt, ##__VA_ARGS__)
+#define LOG_WARN(Fmt, ...)	LOG_AT(LOG_LEVEL_WARN, Fmt, ##__VA_ARGS__)
+#define LOG_INFO(Fmt, ...)	LOG_AT(LOG_LEVEL_INFO, Fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(Fmt, ...)	LOG_AT(LOG_LEVEL_DEBUG, Fmt, ##__VA_ARGS__)
+
+#endif
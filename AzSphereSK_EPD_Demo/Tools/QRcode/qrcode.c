@@ -35,6 +35,7 @@
 #include <string.h>
 
 #include "qrcode.h"
+#include "../Arena/Arena.h"
 
 #pragma mark - Error Correction Lookup tables
 
@@ -121,22 +122,6 @@ static int8_t getAlphanumeric(char c) {
     return -1;
 }
 
-static booll isAlphanumeric(const char *text, uint16_t length) {
-    while (length != 0) {
-        if (getAlphanumeric(text[--length]) == -1) { return false; }
-    }
-    return true;
-}
-
-
-static booll isNumeric(const char *text, uint16_t length) {
-    while (length != 0) {
-        char c = text[--length];
-        if (c < '0' || c > '9') { return false; }
-    }
-    return true;
-}
-
 
 #pragma mark - Counting
 
@@ -232,48 +217,146 @@ static void bb_setBit(BitBucket *bitGrid, uint8_t x, uint8_t y, booll on) {
     }
 }
 
-static void bb_invertBit(BitBucket *bitGrid, uint8_t x, uint8_t y, booll invert) {
-    uint32_t offset = y * bitGrid->bitOffsetOrWidth + x;
-    uint8_t mask = 1 << (7 - (offset & 0x07));
-    booll on = ((bitGrid->data[offset >> 3] & (1 << (7 - (offset & 0x07)))) != 0);
-    if (on ^ invert) {
-        bitGrid->data[offset >> 3] |= mask;
-    } else {
-        bitGrid->data[offset >> 3] &= ~mask;
-    }
-}
-
 static booll bb_getBit(BitBucket *bitGrid, uint8_t x, uint8_t y) {
     uint32_t offset = y * bitGrid->bitOffsetOrWidth + x;
     return (bitGrid->data[offset >> 3] & (1 << (7 - (offset & 0x07)))) != 0;
 }
 
 
-#pragma mark - Drawing Patterns
+#pragma mark - Packed rows
 
-// XORs the data modules in this QR Code with the given mask pattern. Due to XOR's mathematical
-// properties, calling applyMask(m) twice with the same value is equivalent to no change at all.
-// This means it is possible to apply a mask, undo it, and try another mask. Note that a final
-// well-formed QR Code symbol needs exactly one mask applied (not zero, not two, etc.).
-static void applyMask(BitBucket *modules, BitBucket *isFunction, uint8_t mask) {
-    uint8_t size = modules->bitOffsetOrWidth;
+// The mask search works on the grid as rows of 64 bit words, so the masks and the penalty rules
+// handle 64 modules per operation. Module x of a row is bit (63 - x % 64) of word x / 64 (MSB first,
+// like the BitBucket) and unused bits at the end of a row are always 0.
+#define QR_MAX_ROW_WORDS    3   // 177 modules
+#define QR_ROW_WORDS(size)  (((size) + 63) / 64)
+
+// Largest alignment pattern count per side (version 40) and ECC codewords per block, so the
+// small work buffers are fixed arrays. The grid sized ones come from the arena (ARENA_QR).
+#define QR_MAX_ALIGN        7
+#define QR_MAX_BLOCK_ECC    30
+
+// Copies the grid into rows of words.
+static void rows_load(BitBucket *grid, uint64_t *rows, uint8_t words) {
+    uint8_t size = grid->bitOffsetOrWidth;
     
     for (uint8_t y = 0; y < size; y++) {
-        for (uint8_t x = 0; x < size; x++) {
-            if (bb_getBit(isFunction, x, y)) { continue; }
+        uint64_t *row = &rows[y * words];
+        memset(row, 0, words * sizeof(uint64_t));
+        
+        for (uint8_t x = 0; x < size; x += 8) {
+            uint32_t offset = y * size + x;
+            uint16_t index = offset >> 3;
+            uint16_t bits = grid->data[index] << 8;
+            if (index + 1 < grid->capacityBytes) { bits |= grid->data[index + 1]; }
+            
+            uint8_t byte = (bits << (offset & 7)) >> 8;
+            if (size - x < 8) { byte &= 0xFF << (8 - (size - x)); }
+            row[x >> 6] |= (uint64_t)byte << (56 - (x & 63));
+        }
+    }
+}
+
+// Copies rows of words back into the grid.
+static void rows_store(BitBucket *grid, const uint64_t *rows, uint8_t words) {
+    uint8_t size = grid->bitOffsetOrWidth;
+    
+    for (uint8_t y = 0; y < size; y++) {
+        const uint64_t *row = &rows[y * words];
+        
+        for (uint8_t x = 0; x < size; x += 8) {
+            uint8_t count = (size - x < 8) ? size - x : 8;
+            uint32_t offset = y * size + x;
+            uint16_t index = offset >> 3;
+            
+            // Up to 8 bits at any bit offset, spanning at most two bytes
+            uint16_t field = (uint16_t)(0xFF00 << (8 - count)) >> (offset & 7);
+            uint16_t bits = ((uint16_t)(uint8_t)(row[x >> 6] >> (56 - (x & 63))) << 8) >> (offset & 7);
+            
+            grid->data[index] = (grid->data[index] & ~(field >> 8)) | ((bits & field) >> 8);
+            if (field & 0xFF) {
+                grid->data[index + 1] = (grid->data[index + 1] & ~field) | (bits & field & 0xFF);
+            }
+        }
+    }
+}
+
+// Word w of the row shifted so that bit x holds module (x - k) of the row, 1 <= k <= 63.
+static inline uint64_t rows_back(const uint64_t *row, uint8_t w, uint8_t k) {
+    return (row[w] >> k) | (w ? row[w - 1] << (64 - k) : 0);
+}
+
+// Bits of word w for modules first <= x < size
+static inline uint64_t rows_valid(uint8_t w, uint8_t first, uint8_t size) {
+    int16_t lo = first - 64 * w, hi = size - 64 * w;
+    uint64_t m = (hi >= 64) ? ~0ULL : (hi <= 0) ? 0 : ~(~0ULL >> hi);
+    if (lo > 0) { m &= (lo >= 64) ? 0 : (~0ULL >> lo); }
+    return m;
+}
+
+// Transposes the rows into columns, 64*64 modules at a time.
+static void rows_transpose(const uint64_t *rows, uint64_t *cols, uint8_t size, uint8_t words) {
+    uint64_t a[64];
+    
+    for (uint8_t tr = 0; tr < words; tr++) {
+        for (uint8_t tc = 0; tc < words; tc++) {
+            for (uint8_t i = 0; i < 64; i++) {
+                uint16_t y = 64 * tr + i;
+                a[i] = (y < size) ? rows[y * words + tc] : 0;
+            }
             
-            booll invert = 0;
-            switch (mask) {
-                case 0:  invert = (x + y) % 2 == 0;                    break;
-                case 1:  invert = y % 2 == 0;                          break;
-                case 2:  invert = x % 3 == 0;                          break;
-                case 3:  invert = (x + y) % 3 == 0;                    break;
-                case 4:  invert = (x / 3 + y / 2) % 2 == 0;            break;
-                case 5:  invert = x * y % 2 + x * y % 3 == 0;          break;
-                case 6:  invert = (x * y % 2 + x * y % 3) % 2 == 0;    break;
-                case 7:  invert = ((x + y) % 2 + x * y % 3) % 2 == 0;  break;
+            // Swap the off diagonal 32*32, 16*16, ... 1*1 blocks
+            uint64_t m = 0x00000000FFFFFFFFULL;
+            for (uint8_t j = 32; j != 0; j >>= 1, m ^= m << j) {
+                for (uint8_t k = 0; k < 64; k = (k + j + 1) & ~j) {
+                    uint64_t t = (a[k] ^ (a[k + j] >> j)) & m;
+                    a[k] ^= t;
+                    a[k + j] ^= t << j;
+                }
+            }
+            
+            for (uint8_t i = 0; i < 64; i++) {
+                uint16_t x = 64 * tc + i;
+                if (x < size) { cols[x * words + tr] = a[i]; }
             }
-            bb_invertBit(modules, x, y, invert);
+        }
+    }
+}
+
+
+#pragma mark - Drawing Patterns
+
+// Mask condition of one module (true to invert)
+static booll getMaskBit(uint8_t mask, uint8_t x, uint8_t y) {
+    switch (mask) {
+        case 0:  return (x + y) % 2 == 0;
+        case 1:  return y % 2 == 0;
+        case 2:  return x % 3 == 0;
+        case 3:  return (x + y) % 3 == 0;
+        case 4:  return (x / 3 + y / 2) % 2 == 0;
+        case 5:  return x * y % 2 + x * y % 3 == 0;
+        case 6:  return (x * y % 2 + x * y % 3) % 2 == 0;
+        case 7:  return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+    return false;
+}
+
+// XORs the data modules of the rows with the given mask pattern. Every mask only depends on x % 6
+// within a row, so the 6 module pattern of the row is repeated across a whole word.
+static void rows_applyMask(uint64_t *rows, const uint64_t *isFunction, uint8_t size, uint8_t words, uint8_t mask) {
+    for (uint8_t y = 0; y < size; y++) {
+        uint8_t pattern = 0;    // Bit (5 - k) for x % 6 == k
+        for (uint8_t k = 0; k < 6; k++) {
+            pattern = (pattern << 1) | getMaskBit(mask, k, y);
+        }
+        
+        for (uint8_t w = 0; w < words; w++) {
+            // Rotate the pattern so its MSB is the first module of the word
+            uint8_t phase = (64 * w) % 6;
+            uint64_t p = ((pattern << phase) | (pattern >> (6 - phase))) & 0x3F;
+            uint64_t invert = (p * 0x0410410410410410ULL) | (p >> 2);
+            
+            rows[y * words + w] ^= invert & ~isFunction[y * words + w] & rows_valid(w, 0, size);
         }
     }
 }
@@ -410,7 +493,7 @@ static void drawFunctionPatterns(BitBucket *modules, BitBucket *isFunction, uint
         }
         
         uint8_t alignPositionIndex = alignCount - 1;
-        uint8_t alignPosition[alignCount];
+        uint8_t alignPosition[QR_MAX_ALIGN];
         
         alignPosition[0] = 6;
         
@@ -479,86 +562,71 @@ static void drawCodewords(BitBucket *modules, BitBucket *isFunction, BitBucket *
 #define PENALTY_N3     40
 #define PENALTY_N4     10
 
-// Calculates and returns the penalty score based on state of this QR Code's current modules.
-// This is used by the automatic mask choice algorithm to find the mask pattern that yields the lowest score.
-// @TODO: This can be optimized by working with the bytes instead of bits.
-static uint32_t getPenaltyScore(BitBucket *modules) {
+// Finder-like 1:1:3:1:1 pattern with 4 light modules on either side, oldest module in the MSB
+#define PENALTY_FINDER_A    0x05D
+#define PENALTY_FINDER_B    0x5D0
+
+// Run and finder-like penalties of one row (or column) of modules, all positions at once.
+static uint32_t getLinePenalty(const uint64_t *line, uint8_t size, uint8_t words) {
     uint32_t result = 0;
+    uint64_t same[QR_MAX_ROW_WORDS], run5[QR_MAX_ROW_WORDS];
     
-    uint8_t size = modules->bitOffsetOrWidth;
+    // Module x has the same color as module x - 1
+    for (uint8_t w = 0; w < words; w++) {
+        same[w] = ~(line[w] ^ rows_back(line, w, 1)) & rows_valid(w, 1, size);
+    }
     
-    // Adjacent modules in row having same color
-    for (uint8_t y = 0; y < size; y++) {
-        
-        booll colorX = bb_getBit(modules, 0, y);
-        for (uint8_t x = 1, runX = 1; x < size; x++) {
-            booll cx = bb_getBit(modules, x, y);
-            if (cx != colorX) {
-                colorX = cx;
-                runX = 1;
-                
-            } else {
-                runX++;
-                if (runX == 5) {
-                    result += PENALTY_N1;
-                } else if (runX > 5) {
-                    result++;
-                }
-            }
-        }
+    // Module x ends a run of 5 or more; 3 points when the run reaches 5 and 1 for every module after
+    for (uint8_t w = 0; w < words; w++) {
+        run5[w] = same[w] & rows_back(same, w, 1) & rows_back(same, w, 2) & rows_back(same, w, 3);
+    }
+    for (uint8_t w = 0; w < words; w++) {
+        uint64_t first = run5[w] & ~rows_back(run5, w, 1);
+        result += __builtin_popcountll(run5[w]) + (PENALTY_N1 - 1) * __builtin_popcountll(first);
     }
     
-    // Adjacent modules in column having same color
-    for (uint8_t x = 0; x < size; x++) {
-        booll colorY = bb_getBit(modules, x, 0);
-        for (uint8_t y = 1, runY = 1; y < size; y++) {
-            booll cy = bb_getBit(modules, x, y);
-            if (cy != colorY) {
-                colorY = cy;
-                runY = 1;
-            } else {
-                runY++;
-                if (runY == 5) {
-                    result += PENALTY_N1;
-                } else if (runY > 5) {
-                    result++;
-                }
-            }
+    // Modules x - 10 .. x match a finder-like pattern
+    for (uint8_t w = 0; w < words; w++) {
+        uint64_t a = rows_valid(w, 10, size), b = a;
+        for (uint8_t k = 0; k <= 10; k++) {
+            uint64_t m = k ? rows_back(line, w, k) : line[w];
+            a &= ((PENALTY_FINDER_A >> k) & 1) ? m : ~m;
+            b &= ((PENALTY_FINDER_B >> k) & 1) ? m : ~m;
         }
+        result += PENALTY_N3 * (__builtin_popcountll(a) + __builtin_popcountll(b));
     }
     
+    return result;
+}
+
+// Calculates and returns the penalty score based on state of this QR Code's current modules.
+// This is used by the automatic mask choice algorithm to find the mask pattern that yields the lowest score.
+// Rows and cols are the masked modules as rows of words and their transpose.
+static uint32_t getPenaltyScore(const uint64_t *rows, const uint64_t *cols, uint8_t size, uint8_t words) {
+    uint32_t result = 0;
     uint16_t black = 0;
-    for (uint8_t y = 0; y < size; y++) {
-        uint16_t bitsRow = 0, bitsCol = 0;
-        for (uint8_t x = 0; x < size; x++) {
-            booll color = bb_getBit(modules, x, y);
-
-            // 2*2 blocks of modules having same color
-            if (x > 0 && y > 0) {
-                booll colorUL = bb_getBit(modules, x - 1, y - 1);
-                booll colorUR = bb_getBit(modules, x, y - 1);
-                booll colorL = bb_getBit(modules, x - 1, y);
-                if (color == colorUL && color == colorUR && color == colorL) {
-                    result += PENALTY_N2;
-                }
+    
+    for (uint8_t i = 0; i < size; i++) {
+        // Adjacent modules in row / column having same color, finder-like patterns
+        result += getLinePenalty(&rows[i * words], size, words);
+        result += getLinePenalty(&cols[i * words], size, words);
+        
+        // 2*2 blocks of modules having same color, with the row above
+        const uint64_t *row = &rows[i * words];
+        if (i > 0) {
+            uint64_t vert[QR_MAX_ROW_WORDS];
+            for (uint8_t w = 0; w < words; w++) {
+                vert[w] = ~(row[w] ^ rows[(i - 1) * words + w]);
             }
-
-            // Finder-like pattern in rows and columns
-            bitsRow = ((bitsRow << 1) & 0x7FF) | color;
-            bitsCol = ((bitsCol << 1) & 0x7FF) | bb_getBit(modules, y, x);
-
-            // Needs 11 bits accumulated
-            if (x >= 10) {
-                if (bitsRow == 0x05D || bitsRow == 0x5D0) {
-                    result += PENALTY_N3;
-                }
-                if (bitsCol == 0x05D || bitsCol == 0x5D0) {
-                    result += PENALTY_N3;
-                }
+            for (uint8_t w = 0; w < words; w++) {
+                uint64_t block = vert[w] & rows_back(vert, w, 1) & ~(row[w] ^ rows_back(row, w, 1)) & rows_valid(w, 1, size);
+                result += PENALTY_N2 * __builtin_popcountll(block);
             }
-
-            // Balance of black and white modules
-            if (color) { black++; }
+        }
+        
+        // Balance of black and white modules
+        for (uint8_t w = 0; w < words; w++) {
+            black += __builtin_popcountll(row[w]);
         }
     }
 
@@ -574,15 +642,65 @@ static uint32_t getPenaltyScore(BitBucket *modules) {
 
 #pragma mark - Reed-Solomon Generator
 
+// GF(2^8/0x11D) tables, RS_EXP[i] = 0x02^i (repeated so a sum of two logs needs no modulo)
+// and RS_LOG[RS_EXP[i]] = i. RS_LOG[0] is unused.
+static const uint8_t RS_EXP[512] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26,
+    0x4C, 0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
+    0x9D, 0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23,
+    0x46, 0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1,
+    0x5F, 0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0,
+    0xFD, 0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2,
+    0xD9, 0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE,
+    0x81, 0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC,
+    0x85, 0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54,
+    0xA8, 0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73,
+    0xE6, 0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF,
+    0xE3, 0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41,
+    0x82, 0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6,
+    0x51, 0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09,
+    0x12, 0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16,
+    0x2C, 0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01,
+    0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1D, 0x3A, 0x74, 0xE8, 0xCD, 0x87, 0x13, 0x26, 0x4C,
+    0x98, 0x2D, 0x5A, 0xB4, 0x75, 0xEA, 0xC9, 0x8F, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x9D,
+    0x27, 0x4E, 0x9C, 0x25, 0x4A, 0x94, 0x35, 0x6A, 0xD4, 0xB5, 0x77, 0xEE, 0xC1, 0x9F, 0x23, 0x46,
+    0x8C, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0x5D, 0xBA, 0x69, 0xD2, 0xB9, 0x6F, 0xDE, 0xA1, 0x5F,
+    0xBE, 0x61, 0xC2, 0x99, 0x2F, 0x5E, 0xBC, 0x65, 0xCA, 0x89, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0xFD,
+    0xE7, 0xD3, 0xBB, 0x6B, 0xD6, 0xB1, 0x7F, 0xFE, 0xE1, 0xDF, 0xA3, 0x5B, 0xB6, 0x71, 0xE2, 0xD9,
+    0xAF, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0xBD, 0x67, 0xCE, 0x81,
+    0x1F, 0x3E, 0x7C, 0xF8, 0xED, 0xC7, 0x93, 0x3B, 0x76, 0xEC, 0xC5, 0x97, 0x33, 0x66, 0xCC, 0x85,
+    0x17, 0x2E, 0x5C, 0xB8, 0x6D, 0xDA, 0xA9, 0x4F, 0x9E, 0x21, 0x42, 0x84, 0x15, 0x2A, 0x54, 0xA8,
+    0x4D, 0x9A, 0x29, 0x52, 0xA4, 0x55, 0xAA, 0x49, 0x92, 0x39, 0x72, 0xE4, 0xD5, 0xB7, 0x73, 0xE6,
+    0xD1, 0xBF, 0x63, 0xC6, 0x91, 0x3F, 0x7E, 0xFC, 0xE5, 0xD7, 0xB3, 0x7B, 0xF6, 0xF1, 0xFF, 0xE3,
+    0xDB, 0xAB, 0x4B, 0x96, 0x31, 0x62, 0xC4, 0x95, 0x37, 0x6E, 0xDC, 0xA5, 0x57, 0xAE, 0x41, 0x82,
+    0x19, 0x32, 0x64, 0xC8, 0x8D, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xDD, 0xA7, 0x53, 0xA6, 0x51,
+    0xA2, 0x59, 0xB2, 0x79, 0xF2, 0xF9, 0xEF, 0xC3, 0x9B, 0x2B, 0x56, 0xAC, 0x45, 0x8A, 0x09, 0x12,
+    0x24, 0x48, 0x90, 0x3D, 0x7A, 0xF4, 0xF5, 0xF7, 0xF3, 0xFB, 0xEB, 0xCB, 0x8B, 0x0B, 0x16, 0x2C,
+    0x58, 0xB0, 0x7D, 0xFA, 0xE9, 0xCF, 0x83, 0x1B, 0x36, 0x6C, 0xD8, 0xAD, 0x47, 0x8E, 0x01, 0x02,
+};
+
+static const uint8_t RS_LOG[256] = {
+    0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1A, 0xC6, 0x03, 0xDF, 0x33, 0xEE, 0x1B, 0x68, 0xC7, 0x4B,
+    0x04, 0x64, 0xE0, 0x0E, 0x34, 0x8D, 0xEF, 0x81, 0x1C, 0xC1, 0x69, 0xF8, 0xC8, 0x08, 0x4C, 0x71,
+    0x05, 0x8A, 0x65, 0x2F, 0xE1, 0x24, 0x0F, 0x21, 0x35, 0x93, 0x8E, 0xDA, 0xF0, 0x12, 0x82, 0x45,
+    0x1D, 0xB5, 0xC2, 0x7D, 0x6A, 0x27, 0xF9, 0xB9, 0xC9, 0x9A, 0x09, 0x78, 0x4D, 0xE4, 0x72, 0xA6,
+    0x06, 0xBF, 0x8B, 0x62, 0x66, 0xDD, 0x30, 0xFD, 0xE2, 0x98, 0x25, 0xB3, 0x10, 0x91, 0x22, 0x88,
+    0x36, 0xD0, 0x94, 0xCE, 0x8F, 0x96, 0xDB, 0xBD, 0xF1, 0xD2, 0x13, 0x5C, 0x83, 0x38, 0x46, 0x40,
+    0x1E, 0x42, 0xB6, 0xA3, 0xC3, 0x48, 0x7E, 0x6E, 0x6B, 0x3A, 0x28, 0x54, 0xFA, 0x85, 0xBA, 0x3D,
+    0xCA, 0x5E, 0x9B, 0x9F, 0x0A, 0x15, 0x79, 0x2B, 0x4E, 0xD4, 0xE5, 0xAC, 0x73, 0xF3, 0xA7, 0x57,
+    0x07, 0x70, 0xC0, 0xF7, 0x8C, 0x80, 0x63, 0x0D, 0x67, 0x4A, 0xDE, 0xED, 0x31, 0xC5, 0xFE, 0x18,
+    0xE3, 0xA5, 0x99, 0x77, 0x26, 0xB8, 0xB4, 0x7C, 0x11, 0x44, 0x92, 0xD9, 0x23, 0x20, 0x89, 0x2E,
+    0x37, 0x3F, 0xD1, 0x5B, 0x95, 0xBC, 0xCF, 0xCD, 0x90, 0x87, 0x97, 0xB2, 0xDC, 0xFC, 0xBE, 0x61,
+    0xF2, 0x56, 0xD3, 0xAB, 0x14, 0x2A, 0x5D, 0x9E, 0x84, 0x3C, 0x39, 0x53, 0x47, 0x6D, 0x41, 0xA2,
+    0x1F, 0x2D, 0x43, 0xD8, 0xB7, 0x7B, 0xA4, 0x76, 0xC4, 0x17, 0x49, 0xEC, 0x7F, 0x0C, 0x6F, 0xF6,
+    0x6C, 0xA1, 0x3B, 0x52, 0x29, 0x9D, 0x55, 0xAA, 0xFB, 0x60, 0x86, 0xB1, 0xBB, 0xCC, 0x3E, 0x5A,
+    0xCB, 0x59, 0x5F, 0xB0, 0x9C, 0xA9, 0xA0, 0x51, 0x0B, 0xF5, 0x16, 0xEB, 0x7A, 0x75, 0x2C, 0xD7,
+    0x4F, 0xAE, 0xD5, 0xE9, 0xE6, 0xE7, 0xAD, 0xE8, 0x74, 0xD6, 0xF4, 0xEA, 0xA8, 0x50, 0x58, 0xAF,
+};
+
 static uint8_t rs_multiply(uint8_t x, uint8_t y) {
-    // Russian peasant multiplication
-    // See: https://en.wikipedia.org/wiki/Ancient_Egyptian_multiplication
-    uint16_t z = 0;
-    for (int8_t i = 7; i >= 0; i--) {
-        z = (z << 1) ^ ((z >> 7) * 0x11D);
-        z ^= ((y >> i) & 1) * x;
-    }
-    return z;
+    if (x == 0 || y == 0) { return 0; }
+    return RS_EXP[RS_LOG[x] + RS_LOG[y]];
 }
 
 static void rs_init(uint8_t degree, uint8_t *coeff) {
@@ -592,103 +710,218 @@ static void rs_init(uint8_t degree, uint8_t *coeff) {
     // Compute the product polynomial (x - r^0) * (x - r^1) * (x - r^2) * ... * (x - r^{degree-1}),
     // drop the highest term, and store the rest of the coefficients in order of descending powers.
     // Note that r = 0x02, which is a generator element of this field GF(2^8/0x11D).
-    uint16_t root = 1;
     for (uint8_t i = 0; i < degree; i++) {
         // Multiply the current product by (x - r^i)
         for (uint8_t j = 0; j < degree; j++) {
-            coeff[j] = rs_multiply(coeff[j], root);
+            coeff[j] = rs_multiply(coeff[j], RS_EXP[i]);
             if (j + 1 < degree) {
                 coeff[j] ^= coeff[j + 1];
             }
         }
-        root = (root << 1) ^ ((root >> 7) * 0x11D);  // Multiply by 0x02 mod GF(2^8/0x11D)
+    }
+    
+    // The remainder only ever multiplies by the coefficients, keep their logs (0xFF for a zero coefficient)
+    for (uint8_t j = 0; j < degree; j++) {
+        coeff[j] = coeff[j] ? RS_LOG[coeff[j]] : 0xFF;
     }
 }
 
 static void rs_getRemainder(uint8_t degree, uint8_t *coeff, uint8_t *data, uint8_t length, uint8_t *result, uint8_t stride) {
-    // Compute the remainder by performing polynomial division
-    
-    //for (uint8_t i = 0; i < degree; i++) { result[] = 0; }
-    //memset(result, 0, degree);
+    // Compute the remainder by performing polynomial division, in a contiguous buffer
+    // shifted in place and written interleaved (stride) once the block is done
+    uint8_t remainder[QR_MAX_BLOCK_ECC];
+    memset(remainder, 0, degree);
     
     for (uint8_t i = 0; i < length; i++) {
-        uint8_t factor = data[i] ^ result[0];
-        for (uint8_t j = 1; j < degree; j++) {
-            result[(j - 1) * stride] = result[j * stride];
-        }
-        result[(degree - 1) * stride] = 0;
+        uint8_t factor = data[i] ^ remainder[0];
+        memmove(remainder, remainder + 1, degree - 1);
+        remainder[degree - 1] = 0;
         
+        if (factor == 0) { continue; }
+        const uint8_t *exp = &RS_EXP[RS_LOG[factor]];
         for (uint8_t j = 0; j < degree; j++) {
-            result[j * stride] ^= rs_multiply(coeff[j], factor);
+            if (coeff[j] != 0xFF) {
+                remainder[j] ^= exp[coeff[j]];
+            }
         }
     }
+    
+    for (uint8_t j = 0; j < degree; j++) {
+        result[j * stride] = remainder[j];
+    }
 }
 
 
 
 #pragma mark - QrCode
 
-static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version) {
-    int8_t mode = MODE_BYTE;
-    
-    if (isNumeric((char*)text, length)) {
-        mode = MODE_NUMERIC;
-        bb_appendBits(dataCodewords, 1 << MODE_NUMERIC, 4);
-        bb_appendBits(dataCodewords, length, getModeBits(version, MODE_NUMERIC));
-
-        uint16_t accumData = 0;
-        uint8_t accumCount = 0;
-        for (uint16_t i = 0; i < length; i++) {
-            accumData = accumData * 10 + ((char)(text[i]) - '0');
-            accumCount++;
-            if (accumCount == 3) {
-                bb_appendBits(dataCodewords, accumData, 10);
-                accumData = 0;
-                accumCount = 0;
+#pragma mark - Segmentation
+
+// Character classes, as flags: a digit is also alphanumeric and every character is a byte
+#define CHAR_NUMERIC        (1 << MODE_NUMERIC)
+#define CHAR_ALPHANUMERIC   (1 << MODE_ALPHANUMERIC)
+#define CHAR_BYTE           (1 << MODE_BYTE)
+
+static uint8_t getCharClass(uint8_t c) {
+    if (c >= '0' && c <= '9') { return CHAR_NUMERIC | CHAR_ALPHANUMERIC | CHAR_BYTE; }
+    if (getAlphanumeric(c) != -1) { return CHAR_ALPHANUMERIC | CHAR_BYTE; }
+    return CHAR_BYTE;
+}
+
+// Bits used by the data of a segment of count characters
+static uint32_t getSegmentDataBits(uint8_t mode, uint16_t count) {
+    switch (mode) {
+        case MODE_NUMERIC:      return 10 * (count / 3) + ((count % 3) ? (count % 3) * 3 + 1 : 0);
+        case MODE_ALPHANUMERIC: return 11 * (count / 2) + 6 * (count % 2);
+        default:                return 8 * (uint32_t)count;
+    }
+}
+
+// Splits the data into numeric, alphanumeric and byte segments using the fewest bits for this
+// version (the character count field widths depend on it). The mode of every character is
+// stored in modes, a segment is a run of characters with the same mode.
+// Costs are counted in 1/6 bits so a numeric digit (10/3 bits) and an alphanumeric character
+// (11/2 bits) are whole numbers. Returns the exact number of bits of all the segments, or
+// UINT32_MAX if a segment is too long for its character count field or the arena is full.
+// See: https://www.nayuki.io/page/optimal-text-segmentation-for-qr-codes
+static uint32_t computeSegments(const uint8_t *data, uint16_t length, uint8_t version, uint8_t *modes) {
+    if (length == 0) { return 0; }
+    
+    static const uint8_t charCost[3] = { 20, 33, 48 };
+    uint32_t headCost[3], prevCost[3], curCost[3];
+    ARENA_MARK scope = Arena_Mark();
+    uint8_t (*from)[3] = Arena_Alloc(ARENA_QR, (uint32_t)length * 3);    // Mode of character i when a segment of mode m is open after it
+    if (from == NULL) { return UINT32_MAX; }
+    
+    for (uint8_t m = 0; m < 3; m++) {
+        headCost[m] = (4 + getModeBits(version, m)) * 6;
+        prevCost[m] = headCost[m];
+    }
+    
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t charClass = getCharClass(data[i]);
+        
+        // Extend the open segment of each mode the character fits in
+        for (uint8_t m = 0; m < 3; m++) {
+            curCost[m] = UINT32_MAX;
+            from[i][m] = 0xFF;
+            if (charClass & (1 << m)) {
+                curCost[m] = prevCost[m] + charCost[m];
+                from[i][m] = m;
             }
         }
         
-        // 1 or 2 digits remaining
-        if (accumCount > 0) {
-            bb_appendBits(dataCodewords, accumData, accumCount * 3 + 1);
+        // Or end it after this character and open a segment of another mode
+        uint32_t endCost[3];
+        for (uint8_t m = 0; m < 3; m++) {
+            endCost[m] = (curCost[m] == UINT32_MAX) ? UINT32_MAX : (curCost[m] + 5) / 6 * 6;
         }
-        
-    } else if (isAlphanumeric((char*)text, length)) {
-        mode = MODE_ALPHANUMERIC;
-        bb_appendBits(dataCodewords, 1 << MODE_ALPHANUMERIC, 4);
-        bb_appendBits(dataCodewords, length, getModeBits(version, MODE_ALPHANUMERIC));
-
-        uint16_t accumData = 0;
-        uint8_t accumCount = 0;
-        for (uint16_t i = 0; i  < length; i++) {
-            accumData = accumData * 45 + getAlphanumeric((char)(text[i]));
-            accumCount++;
-            if (accumCount == 2) {
-                bb_appendBits(dataCodewords, accumData, 11);
-                accumData = 0;
-                accumCount = 0;
+        for (uint8_t m = 0; m < 3; m++) {
+            for (uint8_t k = 0; k < 3; k++) {
+                if (k == m || endCost[k] == UINT32_MAX) { continue; }
+                uint32_t cost = endCost[k] + headCost[m];
+                if (cost < curCost[m]) {
+                    curCost[m] = cost;
+                    from[i][m] = k;
+                }
             }
         }
+        memcpy(prevCost, curCost, sizeof(prevCost));
+    }
+    
+    // Cheapest mode for the last character, then walk back
+    uint8_t mode = 0;
+    for (uint8_t m = 1; m < 3; m++) {
+        if (prevCost[m] < prevCost[mode]) { mode = m; }
+    }
+    for (int16_t i = length - 1; i >= 0; i--) {
+        mode = from[i][mode];
+        modes[i] = mode;
+    }
+    Arena_Release(scope);
+    
+    // Exact size of the segments
+    uint32_t bits = 0;
+    for (uint16_t start = 0, end; start < length; start = end) {
+        for (end = start + 1; end < length && modes[end] == modes[start]; end++);
+        uint8_t countBits = getModeBits(version, modes[start]);
+        if ((uint32_t)(end - start) >= ((uint32_t)1 << countBits)) { return UINT32_MAX; }
+        bits += 4 + countBits + getSegmentDataBits(modes[start], end - start);
+    }
+    return bits;
+}
+
+// Data bits available for this version and error correction (format bits order)
+static uint32_t getDataCapacityBits(uint8_t version, uint8_t eccFormatBits) {
+#if LOCK_VERSION == 0
+    return (NUM_RAW_DATA_MODULES[version - 1] / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits][version - 1]) * 8;
+#else
+    return (NUM_RAW_DATA_MODULES / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits]) * 8;
+#endif
+}
+
+
+#pragma mark - QrCode
+
+// Appends the segments found by computeSegments. Returns the mode of the first segment.
+static int8_t encodeDataCodewords(BitBucket *dataCodewords, const uint8_t *text, uint16_t length, uint8_t version, const uint8_t *modes) {
+    int8_t mode = (length > 0) ? modes[0] : MODE_BYTE;
+    
+    for (uint16_t start = 0, end; start < length; start = end) {
+        uint8_t segMode = modes[start];
+        for (end = start + 1; end < length && modes[end] == segMode; end++);
         
-        // 1 character remaining
-        if (accumCount > 0) {
-            bb_appendBits(dataCodewords, accumData, 6);
-        }
+        bb_appendBits(dataCodewords, 1 << segMode, 4);
+        bb_appendBits(dataCodewords, end - start, getModeBits(version, segMode));
         
-    } else {
-        bb_appendBits(dataCodewords, 1 << MODE_BYTE, 4);
-        bb_appendBits(dataCodewords, length, getModeBits(version, MODE_BYTE));
-        for (uint16_t i = 0; i < length; i++) {
-            bb_appendBits(dataCodewords, (char)(text[i]), 8);
+        if (segMode == MODE_NUMERIC) {
+            uint16_t accumData = 0;
+            uint8_t accumCount = 0;
+            for (uint16_t i = start; i < end; i++) {
+                accumData = accumData * 10 + ((char)(text[i]) - '0');
+                accumCount++;
+                if (accumCount == 3) {
+                    bb_appendBits(dataCodewords, accumData, 10);
+                    accumData = 0;
+                    accumCount = 0;
+                }
+            }
+            
+            // 1 or 2 digits remaining
+            if (accumCount > 0) {
+                bb_appendBits(dataCodewords, accumData, accumCount * 3 + 1);
+            }
+            
+        } else if (segMode == MODE_ALPHANUMERIC) {
+            uint16_t accumData = 0;
+            uint8_t accumCount = 0;
+            for (uint16_t i = start; i < end; i++) {
+                accumData = accumData * 45 + getAlphanumeric((char)(text[i]));
+                accumCount++;
+                if (accumCount == 2) {
+                    bb_appendBits(dataCodewords, accumData, 11);
+                    accumData = 0;
+                    accumCount = 0;
+                }
+            }
+            
+            // 1 character remaining
+            if (accumCount > 0) {
+                bb_appendBits(dataCodewords, accumData, 6);
+            }
+            
+        } else {
+            for (uint16_t i = start; i < end; i++) {
+                bb_appendBits(dataCodewords, (char)(text[i]), 8);
+            }
         }
     }
     
-    //bb_setBits(dataCodewords, length, 4, getModeBits(version, mode));
-    
     return mode;
 }
 
-static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data) {
+// Returns -1 if the arena has no room for the interleaved copy.
+static int8_t performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data) {
     
     // See: http://www.thonky.com/qr-code-tutorial/structure-final-message
     
@@ -708,10 +941,12 @@ static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data
     
     uint8_t shortDataBlockLen = shortBlockLen - blockEccLen;
     
-    uint8_t result[data->capacityBytes];
-    memset(result, 0, sizeof(result));
+    ARENA_MARK scope = Arena_Mark();
+    uint8_t *result = Arena_Alloc(ARENA_QR, data->capacityBytes);
+    if (result == NULL) { return -1; }
+    memset(result, 0, data->capacityBytes);
     
-    uint8_t coeff[blockEccLen];
+    uint8_t coeff[QR_MAX_BLOCK_ECC];
     rs_init(blockEccLen, coeff);
     
     uint16_t offset = 0;
@@ -760,6 +995,8 @@ static void performErrorCorrection(uint8_t version, uint8_t ecc, BitBucket *data
     
     memcpy(data->data, result, data->capacityBytes);
     data->bitOffsetOrWidth = moduleCount;
+    Arena_Release(scope);
+    return 0;
 }
 
 // We store the Format bits tightly packed into a single byte (each of the 4 modes is 2 bits)
@@ -773,8 +1010,8 @@ uint16_t qrcode_getBufferSize(uint8_t version) {
     return bb_getGridSizeBytes(4 * version + 17);
 }
 
-// @TODO: Return error if data is too big.
-int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
+// Encodes into modules, its work buffers are taken from the arena in the scope of qrcode_initBytes.
+static int8_t qrcode_encode(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
     uint8_t size = version * 4 + 17;
     qrcode->version = version;
     qrcode->size = size;
@@ -792,12 +1029,18 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     uint16_t dataCapacity = moduleCount / 8 - NUM_ERROR_CORRECTION_CODEWORDS[eccFormatBits];
 #endif
     
+    // Split the data into segments, and make sure they fit
+    uint8_t *modes = Arena_Alloc(ARENA_QR, length > 0 ? length : 1);
+    if (modes == NULL) { return -1; }
+    if (computeSegments(data, length, version, modes) > (uint32_t)dataCapacity * 8) { return -1; }
+    
     struct BitBucket codewords;
-    uint8_t codewordBytes[bb_getBufferSizeBytes(moduleCount)];
-    bb_initBuffer(&codewords, codewordBytes, (int32_t)sizeof(codewordBytes));
+    uint8_t *codewordBytes = Arena_Alloc(ARENA_QR, bb_getBufferSizeBytes(moduleCount));
+    if (codewordBytes == NULL) { return -1; }
+    bb_initBuffer(&codewords, codewordBytes, (int32_t)bb_getBufferSizeBytes(moduleCount));
     
     // Place the data code words into the buffer
-    int8_t mode = encodeDataCodewords(&codewords, data, length, version);
+    int8_t mode = encodeDataCodewords(&codewords, data, length, version, modes);
     
     if (mode < 0) { return -1; }
     qrcode->mode = mode;
@@ -817,26 +1060,36 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     bb_initGrid(&modulesGrid, modules, size);
     
     BitBucket isFunctionGrid;
-    uint8_t isFunctionGridBytes[bb_getGridSizeBytes(size)];
+    uint8_t *isFunctionGridBytes = Arena_Alloc(ARENA_QR, bb_getGridSizeBytes(size));
+    if (isFunctionGridBytes == NULL) { return -1; }
     bb_initGrid(&isFunctionGrid, isFunctionGridBytes, size);
     
     // Draw function patterns, draw all codewords, do masking
     drawFunctionPatterns(&modulesGrid, &isFunctionGrid, version, eccFormatBits);
-    performErrorCorrection(version, eccFormatBits, &codewords);
+    if (performErrorCorrection(version, eccFormatBits, &codewords) < 0) { return -1; }
     drawCodewords(&modulesGrid, &isFunctionGrid, &codewords);
     
-    // Find the best (lowest penalty) mask
+    // Find the best (lowest penalty) mask, on packed rows and columns
+    uint8_t words = QR_ROW_WORDS(size);
+    uint32_t rowBytes = (uint32_t)size * words * sizeof(uint64_t);
+    uint64_t *rows = Arena_Alloc(ARENA_QR, rowBytes);
+    uint64_t *cols = Arena_Alloc(ARENA_QR, rowBytes);
+    uint64_t *func = Arena_Alloc(ARENA_QR, rowBytes);
+    if (rows == NULL || cols == NULL || func == NULL) { return -1; }
+    rows_load(&isFunctionGrid, func, words);
+    
     uint8_t mask = 0;
     int32_t minPenalty = INT32_MAX;
     for (uint8_t i = 0; i < 8; i++) {
         drawFormatBits(&modulesGrid, &isFunctionGrid, eccFormatBits, i);
-        applyMask(&modulesGrid, &isFunctionGrid, i);
-        int penalty = getPenaltyScore(&modulesGrid);
+        rows_load(&modulesGrid, rows, words);
+        rows_applyMask(rows, func, size, words, i);
+        rows_transpose(rows, cols, size, words);
+        int penalty = getPenaltyScore(rows, cols, size, words);
         if (penalty < minPenalty) {
             mask = i;
             minPenalty = penalty;
         }
-        applyMask(&modulesGrid, &isFunctionGrid, i);  // Undoes the mask due to XOR
     }
     
     qrcode->mask = mask;
@@ -844,12 +1097,55 @@ int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8
     // Overwrite old format bits
     drawFormatBits(&modulesGrid, &isFunctionGrid, eccFormatBits, mask);
     
-    // Apply the final choice of mask
-    applyMask(&modulesGrid, &isFunctionGrid, mask);
+    // Apply the final choice of mask. Due to XOR's mathematical properties, applying a mask
+    // twice is no change at all, a final well-formed symbol needs exactly one mask applied.
+    rows_load(&modulesGrid, rows, words);
+    rows_applyMask(rows, func, size, words, mask);
+    rows_store(&modulesGrid, rows, words);
 
     return 0;
 }
 
+// Returns -1 if the data does not fit in this version at this error correction level, or if
+// the arena has no room for the work buffers (ARENA_QR, one scope released before returning).
+int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length) {
+    ARENA_MARK scope = Arena_Mark();
+    int8_t ret = qrcode_encode(qrcode, modules, version, ecc, data, length);
+    Arena_Release(scope);
+    return ret;
+}
+
+int8_t qrcode_selectVersion(const uint8_t *data, uint16_t length, uint8_t *ecc) {
+    if (*ecc > ECC_HIGH) { return -1; }
+    
+    // Segments only change with the character count field widths (versions 1-9, 10-26 and 27-40)
+    ARENA_MARK scope = Arena_Mark();
+    uint8_t *modes = Arena_Alloc(ARENA_QR, length > 0 ? length : 1);
+    uint32_t bits = UINT32_MAX;
+    if (modes == NULL) { return -1; }
+    
+#if LOCK_VERSION == 0
+    for (uint8_t version = 1; version <= 40; version++) {
+#else
+    for (uint8_t version = LOCK_VERSION; version <= LOCK_VERSION; version++) {
+#endif
+        if (version == 1 || version == 10 || version == 27 || version == LOCK_VERSION) {
+            bits = computeSegments(data, length, version, modes);
+        }
+        if (bits > getDataCapacityBits(version, (ECC_FORMAT_BITS >> (2 * *ecc)) & 0x03)) { continue; }
+        
+        // Use the strongest error correction that still fits in this version
+        for (uint8_t boost = *ecc + 1; boost <= ECC_HIGH; boost++) {
+            if (bits <= getDataCapacityBits(version, (ECC_FORMAT_BITS >> (2 * boost)) & 0x03)) { *ecc = boost; }
+        }
+        Arena_Release(scope);
+        return version;
+    }
+    
+    Arena_Release(scope);
+    return -1;
+}
+
 int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, const char *data) {
     return qrcode_initBytes(qrcode, modules, version, ecc, (uint8_t*)data, strlen(data));
 }
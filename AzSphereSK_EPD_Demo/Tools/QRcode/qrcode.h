@@ -83,6 +83,12 @@ extern "C"{
 
 uint16_t qrcode_getBufferSize(uint8_t version);
 
+// Smallest version that fits the data with at least the error correction level in *ecc (ECC_LOW..ECC_HIGH, -1 for any other).
+// *ecc is raised to the strongest level that still fits in that version. Returns -1 if nothing fits.
+// Size the modules buffer with qrcode_getBufferSize() of the returned version.
+// Work buffers of both come from the arena (Tools/Arena, ARENA_QR), -1 as well when it is full.
+int8_t qrcode_selectVersion(const uint8_t *data, uint16_t length, uint8_t *ecc);
+
 int8_t qrcode_initText(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, const char *data);
 int8_t qrcode_initBytes(QRCode *qrcode, uint8_t *modules, uint8_t version, uint8_t ecc, uint8_t *data, uint16_t length);
 
@@ -0,0 +1,265 @@
+/*****************************************************************************
+* | File      	:  	qrcode_cache.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Small cache of generated QR codes for payloads shown again and again
+*                   (enrollment link, support URL, asset tag ...)
+* | Info        :   Keeps the module grid and optionally the drawn bitmap, a repeated 
+*                   draw is then a copy of the bitmap into the Paint image.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Bounded LRU cache of QR module grids and drawn bitmaps
+* 2. Changed : Entries live in the arena (ARENA_CACHE), taken on the first use
+* 3. Changed : Band aware bitmap copy, only whole symbols are kept as bitmaps
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <string.h>
+
+#include "qrcode_cache.h"
+#include "../Arena/Arena.h"
+
+// One cached QR code
+typedef struct {
+    uint64_t Key;           // FNV-1a hash of the payload
+    uint16_t Length;        // Payload length, 0 for a free entry
+    uint8_t Version;        // Requested version (0 = automatic) and ECC, part of the key
+    uint8_t Ecc;
+    uint32_t LastUse;
+    QRCode Code;
+    uint8_t Modules[QRCODE_CACHE_GRID_BYTES];
+#if QRCODE_CACHE_BITMAP_BYTES > 0
+    // Drawn symbol as it is in the image memory, valid for this drawing setup only
+    uint8_t HasBitmap;
+    uint8_t Scale;
+    uint8_t QuietZone;
+    uint8_t Phase;          // Bit position of the first pixel in the first byte of a row
+    uint16_t Rotate;
+    uint8_t Mirror;
+    uint8_t Layout;
+    uint16_t RowBytes;
+    uint8_t Bitmap[QRCODE_CACHE_BITMAP_BYTES];
+#endif
+} QRCODE_CACHE_ENTRY;
+
+static QRCODE_CACHE_ENTRY *QrCache;		// QRCODE_CACHE_ENTRIES entries in the arena
+static uint32_t QrCacheClock;
+
+/******************************************************************************
+function    : Takes the entries from the arena the first time, they stay for 
+              the life of the app
+return      : 0 on Success, -1 if the arena is full
+******************************************************************************/
+static int8_t QR_Cache_Init(void) {
+    if (QrCache == NULL) {
+        QrCache = Arena_Alloc_Lifetime(ARENA_CACHE, sizeof(QRCODE_CACHE_ENTRY) * QRCODE_CACHE_ENTRIES);
+        if (QrCache == NULL) {
+            Log_Debug("ERROR : QR_Cache_Init : No room for the cache entries\n");
+            return -1;
+        }
+        memset(QrCache, 0, sizeof(QRCODE_CACHE_ENTRY) * QRCODE_CACHE_ENTRIES);
+    }
+    return 0;
+}
+
+/******************************************************************************
+function    : 64 bit FNV-1a hash of the payload
+******************************************************************************/
+static uint64_t QR_Cache_Hash(const uint8_t *data, uint16_t length) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (uint16_t i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/******************************************************************************
+function    : Finds the entry of the payload, encoding it into the least 
+              recently used entry on a miss.
+parameter   :
+       data    :   Payload
+       length  :   Payload length in bytes
+       version :   QR version, 0 to use the smallest one that fits
+       ecc     :   ECC_LOW .. ECC_HIGH (minimum level when version is 0)
+return      : Cache entry, or NULL if it can not be encoded or is bigger than 
+              QRCODE_CACHE_MAX_VERSION
+******************************************************************************/
+static QRCODE_CACHE_ENTRY *QR_Cache_Find(const uint8_t *data, uint16_t length, uint8_t version, uint8_t ecc) {
+    if (QR_Cache_Init() < 0) {
+        return NULL;
+    }
+    uint64_t key = QR_Cache_Hash(data, length);
+    QRCODE_CACHE_ENTRY *entry = &QrCache[0];
+
+    QrCacheClock++;
+    for (uint8_t i = 0; i < QRCODE_CACHE_ENTRIES; i++) {
+        QRCODE_CACHE_ENTRY *e = &QrCache[i];
+        if (e->Length == length && length > 0 && e->Key == key && e->Version == version && e->Ecc == ecc) {
+            e->LastUse = QrCacheClock;
+            return e;
+        }
+        // Free entries have LastUse 0 and go first
+        if (e->LastUse < entry->LastUse) {
+            entry = e;
+        }
+    }
+
+    // Miss, encode into the least recently used entry
+    uint8_t codeEcc = ecc;
+    int8_t codeVersion = version ? (int8_t)version : qrcode_selectVersion(data, length, &codeEcc);
+    if (length == 0 || codeVersion < 1 || codeVersion > QRCODE_CACHE_MAX_VERSION) {
+        Log_Debug("ERROR : qrcode_cacheGet : Payload does not fit a cached QR Code\n");
+        return NULL;
+    }
+
+    memset(entry, 0, sizeof(QRCODE_CACHE_ENTRY));
+    if (qrcode_initBytes(&entry->Code, entry->Modules, codeVersion, codeEcc, (uint8_t *)data, length) < 0) {
+        Log_Debug("ERROR : qrcode_cacheGet : Payload does not fit version %d\n", codeVersion);
+        return NULL;
+    }
+    entry->Key = key;
+    entry->Length = length;
+    entry->Version = version;
+    entry->Ecc = ecc;
+    entry->LastUse = QrCacheClock;
+    return entry;
+}
+
+/******************************************************************************
+function    : Returns the encoded QR code of the payload, from the cache or 
+              encoded on a miss. Parameters as QR_Cache_Find.
+return      : QR code, valid till the entry is replaced, or NULL on Error
+******************************************************************************/
+QRCode *qrcode_cacheGet(const uint8_t *data, uint16_t length, uint8_t version, uint8_t ecc) {
+    QRCODE_CACHE_ENTRY *entry = QR_Cache_Find(data, length, version, ecc);
+    return entry ? &entry->Code : NULL;
+}
+
+/******************************************************************************
+function    : Draws a cached QR code into the selected Paint image, see 
+              Paint_DrawQRCode. When the entry holds a bitmap drawn with the same 
+              scale, quiet zone and Paint orientation, the draw is a copy of the 
+              bitmap rows; else it is drawn and the result is kept as the bitmap.
+parameter   :
+       data, length, version, ecc : Payload and encoding, see qrcode_cacheGet
+       Xstart, Ystart, Scale, QuietZone : See Paint_DrawQRCode
+return      : 0 on Success, -1 on Error
+******************************************************************************/
+int8_t Paint_DrawQRCodeCached(const uint8_t *data, uint16_t length, uint8_t version, uint8_t ecc, uint16_t Xstart, uint16_t Ystart, uint8_t Scale, uint8_t QuietZone) {
+    QRCODE_CACHE_ENTRY *entry = QR_Cache_Find(data, length, version, ecc);
+    if (entry == NULL) {
+        return -1;
+    }
+    QRCode *code = &entry->Code;
+
+#if QRCODE_CACHE_BITMAP_BYTES > 0
+    uint16_t Side = QRCODE_GFX_SIDE(code, Scale, QuietZone);
+    if (Paint.Scale != 2 || Scale == 0 || Xstart + Side > Paint.Width || Ystart + Side > Paint.Height) {
+        return Paint_DrawQRCode(code, Xstart, Ystart, Scale, QuietZone);
+    }
+
+    // Top left of the symbol in the image memory, from two opposite corners
+    uint16_t ax, ay, bx, by;
+    Paint_MapPoint(Xstart, Ystart, &ax, &ay);
+    Paint_MapPoint(Xstart + Side - 1, Ystart + Side - 1, &bx, &by);
+    uint16_t Xmem = (ax < bx) ? ax : bx;
+    uint16_t Ymem = (ay < by) ? ay : by;
+
+    uint16_t Bs = Xmem / 8, RowBytes = (Xmem + Side - 1) / 8 - Bs + 1;
+    uint8_t Ms = 0xFF >> (Xmem % 8);
+    uint8_t Me = 0xFF << (7 - (Xmem + Side - 1) % 8);
+    if (RowBytes == 1) {
+        Ms &= Me;
+    }
+
+    if (entry->HasBitmap && entry->RowBytes == RowBytes && entry->Scale == Scale && entry->QuietZone == QuietZone && entry->Phase == Xmem % 8 &&
+        entry->Rotate == Paint.Rotate && entry->Mirror == Paint.Mirror && entry->Layout == Paint.Layout) {
+        // Hit, one copy per memory row
+        const uint8_t *src = entry->Bitmap;
+        for (uint16_t t = 0; t < Side; t++, src += RowBytes) {
+            uint8_t *Row = Paint_GetRow(Ymem + t);
+            if (Row == NULL) {
+                continue;   // Outside the band
+            }
+            Row += Bs;
+            Row[0] = (Row[0] & ~Ms) | (src[0] & Ms);
+            if (RowBytes > 1) {
+                memcpy(&Row[1], &src[1], RowBytes - 2);
+                Row[RowBytes - 1] = (Row[RowBytes - 1] & ~Me) | (src[RowBytes - 1] & Me);
+            }
+        }
+        return 0;
+    }
+
+    if (Paint_DrawQRCode(code, Xstart, Ystart, Scale, QuietZone) < 0) {
+        return -1;
+    }
+
+    // Keep the drawn rows for the next time, if they fit
+    entry->HasBitmap = 0;
+    // and if the whole symbol was drawn, not only the rows of a band
+    if ((uint32_t)RowBytes * Side <= QRCODE_CACHE_BITMAP_BYTES && Ymem >= Paint.BandStart && Ymem + Side <= Paint.BandStart + Paint.BandRows) {
+        uint8_t *dst = entry->Bitmap;
+        for (uint16_t t = 0; t < Side; t++, dst += RowBytes) {
+            memcpy(dst, Paint_GetRow(Ymem + t) + Bs, RowBytes);
+        }
+        entry->HasBitmap = 1;
+        entry->Scale = Scale;
+        entry->QuietZone = QuietZone;
+        entry->Phase = Xmem % 8;
+        entry->Rotate = Paint.Rotate;
+        entry->Mirror = Paint.Mirror;
+        entry->Layout = Paint.Layout;
+        entry->RowBytes = RowBytes;
+    }
+    return 0;
+#else
+    return Paint_DrawQRCode(code, Xstart, Ystart, Scale, QuietZone);
+#endif
+}
+
+/******************************************************************************
+function    : Drops every cached QR code of the payload
+******************************************************************************/
+void qrcode_cacheEvict(const uint8_t *data, uint16_t length) {
+    uint64_t key = QR_Cache_Hash(data, length);
+
+    if (QrCache == NULL) {
+        return;
+    }
+    for (uint8_t i = 0; i < QRCODE_CACHE_ENTRIES; i++) {
+        if (QrCache[i].Length == length && QrCache[i].Key == key) {
+            memset(&QrCache[i], 0, sizeof(QRCODE_CACHE_ENTRY));
+        }
+    }
+}
+
+/******************************************************************************
+function    : Drops all the cached QR codes
+******************************************************************************/
+void qrcode_cacheClear(void) {
+    if (QrCache != NULL) {
+        memset(QrCache, 0, sizeof(QRCODE_CACHE_ENTRY) * QRCODE_CACHE_ENTRIES);
+    }
+    QrCacheClock = 0;
+}
@@ -0,0 +1,65 @@
+/*****************************************************************************
+* | File      	:  	qrcode_cache.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Small cache of generated QR codes for payloads shown again and again
+*                   (enrollment link, support URL, asset tag ...)
+* | Info        :   Keeps the module grid and optionally the drawn bitmap, a repeated 
+*                   draw is then a copy of the bitmap into the Paint image.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Bounded LRU cache of QR module grids and drawn bitmaps
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __QRCODE_CACHE_H_
+#define __QRCODE_CACHE_H_
+
+#include <stdint.h>
+
+#include "qrcode.h"
+#include "qrcode_gfx.h"
+
+// No of cached QR codes, the least recently used one is replaced when full
+#ifndef QRCODE_CACHE_ENTRIES
+#define QRCODE_CACHE_ENTRIES        4
+#endif
+
+// Biggest version that can be cached, sets the grid size of every entry
+#ifndef QRCODE_CACHE_MAX_VERSION
+#define QRCODE_CACHE_MAX_VERSION    10
+#endif
+#define QRCODE_CACHE_GRID_BYTES     (((4 * QRCODE_CACHE_MAX_VERSION + 17) * (4 * QRCODE_CACHE_MAX_VERSION + 17) + 7) / 8)
+
+// Drawn bitmap kept with every entry, 0 to only cache the module grid.
+// 2048 bytes hold a 124 x 124 px symbol (16 bytes x 124 rows)
+#ifndef QRCODE_CACHE_BITMAP_BYTES
+#define QRCODE_CACHE_BITMAP_BYTES   2048
+#endif
+
+QRCode *qrcode_cacheGet(const uint8_t *data, uint16_t length, uint8_t version, uint8_t ecc);
+int8_t Paint_DrawQRCodeCached(const uint8_t *data, uint16_t length, uint8_t version, uint8_t ecc, uint16_t Xstart, uint16_t Ystart, uint8_t Scale, uint8_t QuietZone);
+void qrcode_cacheEvict(const uint8_t *data, uint16_t length);
+void qrcode_cacheClear(void);
+
+#endif  /* __QRCODE_CACHE_H_ */
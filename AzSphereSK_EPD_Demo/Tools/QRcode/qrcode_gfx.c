@@ -0,0 +1,215 @@
+/*****************************************************************************
+* | File      	:  	qrcode_gfx.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Renders a QRCode (ricmoo QRCode lib) into the selected Paint image.
+* | Info        :   Every image memory row of the symbol is expanded once per module from a lookup 
+*                   table and copied for the remaining Scale - 1 rows.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Paint_DrawQRCode, draws the module grid straight into the Paint image at an integer scale
+* 2. Changed : Only the rows of the Paint band are written (Paint_SetBand)
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <string.h>
+
+#include "qrcode_gfx.h"
+
+/******************************************************************************
+function    : Gathers one line of modules (a row, or a column when the image 
+              memory is transposed) as pixel bits, 1 = white (light module or 
+              quiet zone), 0 = black. 
+parameter   :
+       qrcode    :   Generated QR code
+       Line      :   Row / column index, quiet zone included
+       Column    :   1 to gather a column instead of a row
+       Reverse   :   1 to gather the modules in reverse order
+       QuietZone :   Quiet zone in modules
+       Out       :   Output, (size + 2 * QuietZone) bits MSB first
+return      : NONE
+******************************************************************************/
+static void QR_Gather_Line(const QRCode *qrcode, int16_t Line, uint8_t Column, uint8_t Reverse, uint8_t QuietZone, uint8_t *Out) {
+    uint16_t Count = qrcode->size + 2 * QuietZone;
+    int16_t q = Line - QuietZone;
+
+    memset(Out, 0xFF, (Count + 7) / 8);
+    if (q < 0 || q >= qrcode->size) {
+        return;     // Quiet zone line
+    }
+
+    for (uint8_t m = 0; m < qrcode->size; m++) {
+        uint32_t offset = Column ? (uint32_t)m * qrcode->size + q : (uint32_t)q * qrcode->size + m;
+        if (qrcode->modules[offset >> 3] & (0x80 >> (offset & 0x07))) {
+            uint16_t j = Reverse ? Count - 1 - QuietZone - m : QuietZone + m;
+            Out[j >> 3] &= ~(0x80 >> (j & 0x07));
+        }
+    }
+}
+
+/******************************************************************************
+function    : Expands every module bit to Scale pixel bits. The output starts 
+              Offset bits into Out[0] so it lines up with the image memory bytes.
+parameter   :
+       Mods   :   Module bits from QR_Gather_Line
+       Count  :   No of modules
+       Scale  :   Pixels per module
+       Offset :   Bit position of the first pixel in Out[0]
+       Out    :   Output
+return      : NONE
+******************************************************************************/
+static void QR_Expand_Line(const uint8_t *Mods, uint16_t Count, uint8_t Scale, uint8_t Offset, uint8_t *Out) {
+    uint64_t acc = 0;
+    uint8_t nbits = Offset;
+    uint16_t n = 0;
+
+    if (Scale <= 8) {
+        // 4 modules -> 4 * Scale pixel bits in one lookup
+        uint32_t Lut[16];
+        for (uint8_t v = 0; v < 16; v++) {
+            uint32_t e = 0;
+            for (int8_t b = 3; b >= 0; b--) {
+                e = (e << Scale) | (((v >> b) & 1) ? ((1u << Scale) - 1) : 0);
+            }
+            Lut[v] = e;
+        }
+
+        for (uint16_t i = 0; i < Count; i += 4) {
+            uint8_t v = (Mods[i >> 3] >> ((i & 4) ? 0 : 4)) & 0x0F;
+            acc = (acc << (4 * Scale)) | Lut[v];
+            nbits += 4 * Scale;
+            while (nbits >= 8) {
+                nbits -= 8;
+                Out[n++] = (uint8_t)(acc >> nbits);
+            }
+        }
+    } else {
+        for (uint16_t i = 0; i < Count; i++) {
+            uint32_t v = (Mods[i >> 3] & (0x80 >> (i & 7))) ? 0xFFFFFF : 0;
+            for (uint8_t left = Scale; left > 0; ) {
+                uint8_t k = (left > 24) ? 24 : left;
+                acc = (acc << k) | (v >> (24 - k));
+                nbits += k;
+                left -= k;
+                while (nbits >= 8) {
+                    nbits -= 8;
+                    Out[n++] = (uint8_t)(acc >> nbits);
+                }
+            }
+        }
+    }
+    if (nbits) {
+        Out[n] = (uint8_t)(acc << (8 - nbits));
+    }
+}
+
+/******************************************************************************
+function    : Draws a QR code into the selected Paint image. Each module is a 
+              Scale x Scale square, dark modules are BLACK and light modules and
+              the quiet zone are WHITE.
+              The symbol is mapped to the image memory once, then every memory 
+              row is written as a byte span, so rotation, mirroring and the 
+              Paint layout cost nothing per pixel.
+parameter   :
+       qrcode    :   Generated QR code
+       Xstart    :   Top left X of the symbol (quiet zone included)
+       Ystart    :   Top left Y of the symbol (quiet zone included)
+       Scale     :   Pixels per module
+       QuietZone :   White border in modules (the standard asks for 4)
+return      : 0 on Success, -1 if the symbol does not fit
+******************************************************************************/
+int8_t Paint_DrawQRCode(QRCode *qrcode, uint16_t Xstart, uint16_t Ystart, uint8_t Scale, uint8_t QuietZone) {
+    uint16_t Count = qrcode->size + 2 * QuietZone;
+    uint16_t Side = Count * Scale;
+
+    if (Scale == 0 || Xstart + Side > Paint.Width || Ystart + Side > Paint.Height) {
+        Log_Debug("ERROR : Paint_DrawQRCode : QR Code exceeds the image\n");
+        return -1;
+    }
+
+    if (Paint.Scale != 2) {
+        // Gray scale image, no byte spans, one window per module
+        for (uint16_t y = 0; y < Count; y++) {
+            for (uint16_t x = 0; x < Count; x++) {
+                int16_t qx = x - QuietZone, qy = y - QuietZone;
+                booll dark = (qx >= 0 && qy >= 0 && qx < qrcode->size && qy < qrcode->size) && qrcode_getModule(qrcode, qx, qy);
+                Paint_ClearWindows(Xstart + x * Scale, Ystart + y * Scale, Xstart + (x + 1) * Scale, Ystart + (y + 1) * Scale, dark ? BLACK : WHITE);
+            }
+        }
+        return 0;
+    }
+
+    // Corners of the symbol in the image memory, they tell the orientation of the symbol in memory
+    uint16_t ox, oy, ux, uy, vx, vy;
+    Paint_MapPoint(Xstart, Ystart, &ox, &oy);
+    Paint_MapPoint(Xstart + Side - 1, Ystart, &ux, &uy);
+    Paint_MapPoint(Xstart, Ystart + Side - 1, &vx, &vy);
+
+    uint8_t Column = (uy != oy);    // Symbol rows run along memory columns 
+    uint16_t Xmem = (ox < ux) ? ox : ux;
+    uint16_t Ymem = (oy < uy) ? oy : uy;
+    Xmem = (vx < Xmem) ? vx : Xmem;
+    Ymem = (vy < Ymem) ? vy : Ymem;
+
+    // Direction of the memory rows (Down) and of the bits in a row (Reverse) on the symbol
+    uint8_t Down = Column ? (uy > oy) : (vy > oy);
+    uint8_t Reverse = Column ? !(vx > ox) : !(ux > ox);
+    if (Side == 1) {
+        Down = 1;
+        Reverse = 0;
+    }
+
+    uint16_t Bs = Xmem / 8, Be = (Xmem + Side - 1) / 8;
+    if (Be - Bs + 1 > QRCODE_GFX_LINE_BYTES) {
+        Log_Debug("ERROR : Paint_DrawQRCode : QR Code row exceeds QRCODE_GFX_LINE_BYTES\n");
+        return -1;
+    }
+    uint8_t Ms = 0xFF >> (Xmem % 8);
+    uint8_t Me = 0xFF << (7 - (Xmem + Side - 1) % 8);
+    if (Bs == Be) {
+        Ms &= Me;
+    }
+
+    uint8_t Mods[(177 + 2 * 255 + 7) / 8];
+    uint8_t Pixels[QRCODE_GFX_LINE_BYTES + 4];
+
+    for (uint16_t Line = 0; Line < Count; Line++) {
+        QR_Gather_Line(qrcode, Line, Column, Reverse, QuietZone, Mods);
+        QR_Expand_Line(Mods, Count, Scale, Xmem % 8, Pixels);
+
+        // Scale memory rows share the same pixels 
+        uint16_t t0 = Down ? Line * Scale : Side - (Line + 1) * Scale;
+        for (uint16_t t = t0; t < t0 + Scale; t++) {
+            uint8_t *Row = Paint_GetRow(Ymem + t);
+            if (Row == NULL) {
+                continue;   // Outside the band
+            }
+            Row[Bs] = (Row[Bs] & ~Ms) | (Pixels[0] & Ms);
+            if (Be > Bs) {
+                memcpy(&Row[Bs + 1], &Pixels[1], Be - Bs - 1);
+                Row[Be] = (Row[Be] & ~Me) | (Pixels[Be - Bs] & Me);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+/*****************************************************************************
+* | File      	:  	qrcode_gfx.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Renders a QRCode (ricmoo QRCode lib) into the selected Paint image.
+* | Info        :   Works with every Paint rotation, mirroring and layout
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Paint_DrawQRCode, draws the module grid straight into the Paint image at an integer scale
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __QRCODE_GFX_H_
+#define __QRCODE_GFX_H_
+
+#include <stdint.h>
+
+#include "qrcode.h"
+#include "../GFX/Gfx.h"
+
+// Longest image memory row a QR code can cover, in bytes (296 px panel = 37 bytes)
+#ifndef QRCODE_GFX_LINE_BYTES
+#define QRCODE_GFX_LINE_BYTES 48
+#endif
+
+// Side of the drawn symbol in pixels, quiet zone included
+#define QRCODE_GFX_SIDE(qr, Scale, QuietZone) (((qr)->size + 2 * (QuietZone)) * (Scale))
+
+int8_t Paint_DrawQRCode(QRCode *qrcode, uint16_t Xstart, uint16_t Ystart, uint8_t Scale, uint8_t QuietZone);
+
+#endif  /* __QRCODE_GFX_H_ */
@@ -0,0 +1,357 @@
+/*****************************************************************************
+* | File      	:  	Widget.c
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Widgets with a fixed box and a bound value : label, value, bar, icon, QR code and clock
+* | Info        :   A widget is drawn again only when the hash of its bound value changed. The boxes
+*                   drawn are mapped to panel RAM rectangles, overlapping ones merged, and only
+*                   those are uploaded for the partial update.
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Label, value, bar, icon, QR and clock widgets, change detection, changed box upload
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "../../HighLevelCore/applibs_versions.h"
+
+#include <applibs/log.h>
+
+#include "Widget.h"
+#include "../QRcode/qrcode_cache.h"
+
+// Errors of the upload are the driver ExitCodes
+typedef enum {
+    ExitCode_Success = 0,
+
+    ExitCode_Widget_Paint = 10
+} ExitCode;
+
+/******************************************************************************
+function    : 32 bit FNV-1a hash, continued from Hash
+******************************************************************************/
+static uint32_t Widget_Hash(uint32_t Hash, const void *Data, uint32_t Len) {
+    const uint8_t *p = (const uint8_t *)Data;
+    for (uint32_t i = 0; i < Len; i++) {
+        Hash = (Hash ^ p[i]) * 0x01000193u;
+    }
+    return Hash;
+}
+
+/******************************************************************************
+function    : Hash of what the widget shows, its type included
+******************************************************************************/
+static uint32_t Widget_Value_Hash(const WIDGET *W) {
+    uint32_t hash = Widget_Hash(0x811C9DC5u, &W->Type, 1);
+
+    if (W->Bind == NULL) {
+        return hash;
+    }
+    switch (W->Type) {
+    case WIDGET_LABEL:
+    case WIDGET_QR:
+        return Widget_Hash(hash, W->Bind, (uint32_t)strlen((const char *)W->Bind));
+    case WIDGET_CLOCK: {
+        const PAINT_TIME *t = (const PAINT_TIME *)W->Bind;
+        uint8_t hms[3] = { t->Hour, t->Min, t->Sec };
+        return Widget_Hash(hash, hms, sizeof(hms));
+    }
+    default:
+        return Widget_Hash(hash, W->Bind, sizeof(int32_t));
+    }
+}
+
+/******************************************************************************
+function    : Draws a text from the left of the box, the characters that do not 
+              fit are left out
+******************************************************************************/
+static void Widget_Draw_Text(const WIDGET *W, const char *Text) {
+    uint16_t x = W->X;
+
+    if (W->Font == NULL || W->Font->Height > W->H) {
+        return;
+    }
+    for (; *Text != '\0'; Text++) {
+        uint16_t advance = Paint_CharWidth(*Text, W->Font);
+        if (x + advance > W->X + W->W) {
+            break;
+        }
+        Paint_DrawChar(x, W->Y, *Text, W->Font, W->Color, W->Back);
+        x += advance;
+    }
+}
+
+/******************************************************************************
+function    : Clears the box of the widget and draws its value
+parameter   :
+       W    :   Widget
+return      : NONE
+******************************************************************************/
+static void Widget_Draw(const WIDGET *W) {
+    Paint_ClearWindows(W->X, W->Y, W->X + W->W, W->Y + W->H, W->Back);
+    if (W->Bind == NULL) {
+        return;
+    }
+
+    switch (W->Type) {
+    case WIDGET_LABEL:
+        Widget_Draw_Text(W, (const char *)W->Bind);
+        break;
+
+    case WIDGET_VALUE: {
+        char text[WIDGET_TEXT_MAX];
+        snprintf(text, sizeof(text), (W->Format != NULL) ? W->Format : "%ld", (long)*(const int32_t *)W->Bind);
+        Widget_Draw_Text(W, text);
+        break;
+    }
+
+    case WIDGET_BAR: {
+        int32_t value = *(const int32_t *)W->Bind;
+        if (W->W < 5 || W->H < 5 || W->Max <= W->Min) {
+            break;
+        }
+        if (value < W->Min) value = W->Min;
+        if (value > W->Max) value = W->Max;
+        // Outline and a fill one pixel inside it
+        Paint_DrawRectangle(W->X, W->Y, W->X + W->W - 1, W->Y + W->H - 1, W->Color, DOT_PIXEL_1X1, DRAW_FILL_EMPTY);
+        uint16_t fill = (uint16_t)((int64_t)(W->W - 4) * (value - W->Min) / (W->Max - W->Min));
+        if (fill > 0) {
+            Paint_DrawRectangle(W->X + 2, W->Y + 2, W->X + 1 + fill, W->Y + W->H - 2, W->Color, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+        }
+        break;
+    }
+
+    case WIDGET_ICON: {
+        int32_t index = *(const int32_t *)W->Bind;
+        if (W->Icons == NULL || index < 0 || index >= W->IconCount || W->Icons[index] == NULL) {
+            break;
+        }
+        const uint8_t *icon = W->Icons[index];
+        uint16_t rowBytes = (W->W + 7) / 8;
+        for (uint16_t y = 0; y < W->H; y++) {
+            for (uint16_t x = 0; x < W->W; x++) {
+                if (icon[y * rowBytes + x / 8] & (0x80 >> (x % 8))) {
+                    Paint_SetPixel(W->X + x, W->Y + y, W->Color);
+                }
+            }
+        }
+        break;
+    }
+
+    case WIDGET_QR: {
+        const char *payload = (const char *)W->Bind;
+        uint16_t length = (uint16_t)strlen(payload);
+        uint8_t scale = W->Scale ? W->Scale : 1;
+        // Symbol and quiet zone have to fit the box, else they are drawn over the neighbours
+        QRCode *code = qrcode_cacheGet((const uint8_t *)payload, length, W->Version, W->Ecc);
+        if (code == NULL) {
+            Log_Debug("ERROR : Widget_Draw : QR code of %d bytes could not be encoded\n", (int)length);
+            break;
+        }
+        uint16_t side = QRCODE_GFX_SIDE(code, scale, 1);
+        if (side > W->W || side > W->H) {
+            Log_Debug("ERROR : Widget_Draw : QR code of %d px does not fit the %d x %d box\n", side, W->W, W->H);
+            break;
+        }
+        if (Paint_DrawQRCodeCached((const uint8_t *)payload, length, W->Version, W->Ecc, W->X, W->Y, scale, 1) < 0) {
+            Log_Debug("ERROR : Widget_Draw : QR code of %d bytes could not be drawn\n", (int)length);
+        }
+        break;
+    }
+
+    case WIDGET_CLOCK:
+        if (W->Font != NULL) {
+            // Paint_DrawTime takes the colors the other way round, like Paint_DrawString_EN
+            Paint_DrawTime(W->X, W->Y, (PAINT_TIME *)W->Bind, W->Font, W->Back, W->Color);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function    : Panel RAM rectangle holding the box of a widget, clipped to the image
+return      : 1, or 0 if no part of the box is in the image
+******************************************************************************/
+static uint8_t Widget_Area(const WIDGET *W, EPD_RECT *Rect) {
+    uint16_t x0, y0, x1, y1;
+
+    if (W->W == 0 || W->H == 0 || W->X >= Paint.Width || W->Y >= Paint.Height) {
+        return 0;
+    }
+    uint16_t xe = (W->X + W->W > Paint.Width) ? Paint.Width : W->X + W->W;
+    uint16_t ye = (W->Y + W->H > Paint.Height) ? Paint.Height : W->Y + W->H;
+    if (!Paint_MapPoint(W->X, W->Y, &x0, &y0) || !Paint_MapPoint(xe - 1, ye - 1, &x1, &y1)) {
+        return 0;
+    }
+    if (x0 > x1) { uint16_t t = x0; x0 = x1; x1 = t; }
+    if (y0 > y1) { uint16_t t = y0; y0 = y1; y1 = t; }
+    Rect->Xbyte = x0 / 8;
+    Rect->WidthByte = x1 / 8 - x0 / 8 + 1;
+    Rect->Ystart = y0;
+    Rect->Height = y1 - y0 + 1;
+    return 1;
+}
+
+/******************************************************************************
+function    : Grows Into to also hold Rect
+******************************************************************************/
+static void Widget_Rect_Union(EPD_RECT *Into, const EPD_RECT *Rect) {
+    uint16_t xe = Into->Xbyte + Into->WidthByte, ye = Into->Ystart + Into->Height;
+
+    if (Rect->Xbyte + Rect->WidthByte > xe) xe = Rect->Xbyte + Rect->WidthByte;
+    if (Rect->Ystart + Rect->Height > ye) ye = Rect->Ystart + Rect->Height;
+    if (Rect->Xbyte < Into->Xbyte) Into->Xbyte = Rect->Xbyte;
+    if (Rect->Ystart < Into->Ystart) Into->Ystart = Rect->Ystart;
+    Into->WidthByte = xe - Into->Xbyte;
+    Into->Height = ye - Into->Ystart;
+}
+
+static uint8_t Widget_Rect_Overlap(const EPD_RECT *A, const EPD_RECT *B) {
+    return A->Xbyte < B->Xbyte + B->WidthByte && B->Xbyte < A->Xbyte + A->WidthByte &&
+           A->Ystart < B->Ystart + B->Height && B->Ystart < A->Ystart + A->Height;
+}
+
+/******************************************************************************
+function    : Draws the widgets whose bound value changed since they were drawn last
+parameter   :
+       Widgets :   Screen
+       Count   :   No of Widgets
+       Rects   :   Output, WIDGET_MAX_RECTS panel RAM rectangles that changed, 
+                   overlapping boxes merged, or their union if there are more
+       Union   :   Output, one rectangle holding all of them, may be NULL
+return      : No of Rects, 0 if nothing changed
+******************************************************************************/
+uint8_t Widget_Render(WIDGET *Widgets, uint8_t Count, EPD_RECT *Rects, EPD_RECT *Union) {
+    EPD_RECT all = { 0, 0, 0, 0 };
+    uint8_t n = 0, overflow = 0;
+
+    for (uint8_t i = 0; i < Count; i++) {
+        WIDGET *W = &Widgets[i];
+        uint32_t hash = Widget_Value_Hash(W);
+        if (W->Drawn && hash == W->Hash) {
+            continue;
+        }
+        Widget_Draw(W);
+        W->Hash = hash;
+        W->Drawn = 1;
+
+        EPD_RECT rect;
+        if (!Widget_Area(W, &rect)) {
+            continue;
+        }
+        if (all.Height == 0) {
+            all = rect;
+        } else {
+            Widget_Rect_Union(&all, &rect);
+        }
+
+        // Merge with the boxes it overlaps, the result can overlap others again
+        uint8_t merged = 1;
+        while (merged) {
+            merged = 0;
+            for (uint8_t r = 0; r < n; r++) {
+                if (Widget_Rect_Overlap(&Rects[r], &rect)) {
+                    Widget_Rect_Union(&rect, &Rects[r]);
+                    Rects[r] = Rects[--n];
+                    merged = 1;
+                    break;
+                }
+            }
+        }
+        if (n < WIDGET_MAX_RECTS) {
+            Rects[n++] = rect;
+        } else {
+            overflow = 1;
+        }
+    }
+
+    if (overflow) {
+        Rects[0] = all;
+        n = 1;
+    }
+    if (Union != NULL) {
+        *Union = all;
+    }
+    return n;
+}
+
+/******************************************************************************
+function    : Draws the changed widgets into the Paint image and shows them with a 
+              partial update of their boxes only. The first time, when no widget 
+              was drawn yet, the whole frame is uploaded.
+              When the upload fails every widget is invalidated, so the next call 
+              draws them again and uploads the whole frame.
+parameter   :
+       fd      :   SPI File Discripter used for read/Write() functions
+       Widgets :   Screen, drawn into the selected Paint image
+       Count   :   No of Widgets
+return      : Success Signal / Error Code, Success without an update if nothing changed
+******************************************************************************/
+int Widget_Refresh(int fd, WIDGET *Widgets, uint8_t Count) {
+    EPD_RECT rects[WIDGET_MAX_RECTS];
+    uint8_t first = 1;
+
+    if (Paint.Image == NULL || Paint.Layout != PAINT_LAYOUT_PANEL || Paint.Scale != 2 ||
+        Paint.WidthMemory != EPD_2in9_WIDTH || Paint.HeightMemory != EPD_2in9_HEIGHT || Paint.BandRows != Paint.HeightMemory) {
+        Log_Debug("ERROR : Widget_Refresh : Paint has to hold a whole frame in the panel layout\n");
+        return ExitCode_Widget_Paint;
+    }
+
+    for (uint8_t i = 0; i < Count; i++) {
+        if (Widgets[i].Drawn) {
+            first = 0;
+            break;
+        }
+    }
+
+    uint8_t n = Widget_Render(Widgets, Count, rects, NULL);
+    if (n == 0) {
+        return ExitCode_Success;
+    }
+    if (first) {
+        EPD_RECT frame = { 0, 0, EPD_WidthByte, EPD_HeightByte };
+        rects[0] = frame;
+        n = 1;
+    }
+    int ret = EPD_Display_Rects_2in9(fd, Paint.Image, rects, n);
+    if (ret != ExitCode_Success) {
+        // The panel RAM may hold part of the update only, draw and upload everything next time
+        Widget_Invalidate(Widgets, Count);
+    }
+    return ret;
+}
+
+/******************************************************************************
+function    : Makes the next Widget_Render draw every widget, after the image was 
+              cleared or the layout changed
+******************************************************************************/
+void Widget_Invalidate(WIDGET *Widgets, uint8_t Count) {
+    for (uint8_t i = 0; i < Count; i++) {
+        Widgets[i].Drawn = 0;
+    }
+}
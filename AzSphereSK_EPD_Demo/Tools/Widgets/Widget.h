@@ -0,0 +1,83 @@
+/*****************************************************************************
+* | File      	:  	Widget.h
+* | Author      :   GS Gill (gsgill112.github.io) @ TechNervers
+* | Function    :   Widgets with a fixed box and a bound value : label, value, bar, icon, QR code and clock
+* | Info        :   Widget_Render redraws only the widgets whose bound value changed and reports their
+*                   boxes in panel RAM, Widget_Refresh uploads just those (EPD_Display_Rects_2in9).
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-19
+* | Info        :
+* -----------------------------------------------------------------------------
+* Change Log V1.0 (2026-10-19):
+* 1. Added : Label, value, bar, icon, QR and clock widgets, change detection, changed box upload
+*-------------------------------------------------------------------------------
+*
+*  INFO : Please check Readme to understand how to include this library in your project and test.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documnetation files (the "Software"), for
+# non-commercial use.
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS OR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+#
+******************************************************************************/
+#ifndef __WIDGET_H_
+#define __WIDGET_H_
+
+#include <stdint.h>
+
+#include "../../HighLevelCore/applibs_versions.h"
+#include "../../EPD/IL3820_2in9_Driver.h"
+#include "../GFX/Gfx.h"
+
+// Widget types, with what Bind points to
+#define WIDGET_LABEL		0		// const char, the text
+#define WIDGET_VALUE		1		// int32_t, printed with Format (default "%ld")
+#define WIDGET_BAR			2		// int32_t, Min .. Max fills the box from the left
+#define WIDGET_ICON			3		// int32_t, index into Icons
+#define WIDGET_QR			4		// const char, the payload, drawn through the QR cache
+#define WIDGET_CLOCK		5		// PAINT_TIME, hh:mm:ss
+
+// Changed boxes uploaded one by one, more than this are uploaded as their union
+#ifndef WIDGET_MAX_RECTS
+#define WIDGET_MAX_RECTS	8
+#endif
+#define WIDGET_TEXT_MAX		48		// Longest text of a VALUE widget
+
+// One widget of a screen, a screen is an array of them. Everything above Bind is layout and is
+// not looked at for changes, call Widget_Invalidate after changing it.
+typedef struct {
+    uint8_t Type;					// WIDGET_xxx
+    uint16_t X, Y;					// Box in drawing coordinates, Paint set up as for drawing
+    uint16_t W, H;
+    uint16_t Color;					// Ink
+    uint16_t Back;					// The box is cleared to it before drawing
+    sFONT *Font;					// LABEL, VALUE, CLOCK
+    const char *Format;				// VALUE
+    int32_t Min, Max;				// BAR range
+    const uint8_t *const *Icons;	// ICON, W x H bitmaps, rows of (W + 7) / 8 bytes, 1 is ink
+    uint8_t IconCount;
+    uint8_t Version, Ecc;			// QR, as qrcode_initText
+    uint8_t Scale;					// QR module size in pixels, quiet zone of one module. The box needs 
+									// (4 * Version + 19) * Scale px a side, the symbol is not drawn else
+    const void *Bind;				// Bound value, see the types
+    uint32_t Hash;					// Of the value drawn last
+    uint8_t Drawn;					// 0 till the widget is drawn
+} WIDGET;
+
+// User Functions
+uint8_t Widget_Render(WIDGET *Widgets, uint8_t Count, EPD_RECT *Rects, EPD_RECT *Union);	// Draws the changed widgets
+int Widget_Refresh(int fd, WIDGET *Widgets, uint8_t Count);	// Draws them and updates the display with their boxes only
+void Widget_Invalidate(WIDGET *Widgets, uint8_t Count);	// Everything is drawn again next time
+
+#endif